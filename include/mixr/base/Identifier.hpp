@@ -16,6 +16,22 @@ namespace base {
 // Note: When setting the identifier, any spaces will be replaced
 //       with underscores.
 //
+// Interned symbols:
+//    Each identifier is also interned into a global, thread-safe symbol
+//    table when its text is set (e.g., when a Pair is created).  All
+//    identifiers with the same text share the same symbol pointer, so
+//    comparing two identifiers is a pointer compare, without any locking
+//    (see PairStream::findByName() and SlotTable::index()).  Symbols are
+//    never removed from the table.
+//
+//    The symbol is kept current by setStr(), catStr(), setChar() and
+//    empty(); text modified through the 'char*' conversion operator is
+//    not re-interned.
+//
+//    static const char* intern(const char* const name)
+//       Returns the unique symbol for 'name', adding it to the table
+//       if needed (returns nullptr for null or empty names).
+//
 // Factory name: Identifier
 //------------------------------------------------------------------------------
 class Identifier : public String
@@ -26,10 +42,55 @@ public:
     Identifier(const char*);
     Identifier();
 
+    const char* getSymbol() const      { return sym; }   // Interned symbol (nullptr if empty)
+
     void setStr(const char*) override;
     void catStr(const char*) override;
+    void setChar(const unsigned int index, const char c) override;
+    void empty() override;
+
+    static const char* intern(const char* const name);
+
+private:
+    void updateSymbol();
+
+    const char* sym {};     // interned symbol
 };
 
+//------------------------------------------------------------------------------
+// Comparison operators: == and != (symbol compare)
+//------------------------------------------------------------------------------
+inline bool operator==(const Identifier& s1, const Identifier& s2)
+{
+   return (s1.getSymbol() == s2.getSymbol());
+}
+
+inline bool operator!=(const Identifier& s1, const Identifier& s2)
+{
+   return (s1.getSymbol() != s2.getSymbol());
+}
+
+// text compares against C strings (use the String operators)
+inline bool operator==(const Identifier& s1, const char* s2)
+{
+   return (static_cast<const String&>(s1) == s2);
+}
+
+inline bool operator==(const char* s1, const Identifier& s2)
+{
+   return (s1 == static_cast<const String&>(s2));
+}
+
+inline bool operator!=(const Identifier& s1, const char* s2)
+{
+   return (static_cast<const String&>(s1) != s2);
+}
+
+inline bool operator!=(const char* s1, const Identifier& s2)
+{
+   return (s1 != static_cast<const String&>(s2));
+}
+
 }
 }
 
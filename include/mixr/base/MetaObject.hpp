@@ -3,6 +3,9 @@
 #define __mixr_base_MetaObject_H__
 
 #include <string>
+#include <atomic>
+#include <cstddef>
+#include <iosfwd>
 
 namespace mixr {
 namespace base {
@@ -12,12 +15,28 @@ class SlotTable;
 // Class: MetaObject
 // Description: MetaObject about class attributes and object instances.  This includes its name,
 //              slot table, and even the number of them in existance
+//
+// Instance and memory accounting:
+//
+//    'count', 'mc' and 'tc' are maintained by the STANDARD_CONSTRUCTOR() and
+//    STANDARD_DESTRUCTOR() macros at every level of the class hierarchy, so
+//    they include the instances of all derived classes.  getExactCount() is
+//    the number of live instances whose most derived class is this class.
+//
+//    getApproxBytes() is the exact count times the size of the class plus any
+//    memory owned by the instances (e.g., dynamically sized arrays), which
+//    classes report using addOwnedBytes().
+//
+//    updateAllocationRates() computes the number of instances created per
+//    second since its last call, and printStatistics() prints a table of all
+//    classes with live instances.
 //------------------------------------------------------------------------------
 class MetaObject
 {
 public:
    MetaObject() = default;
-   MetaObject(const char* const, const char* const, const SlotTable* const, const MetaObject* const);
+   MetaObject(const char* const, const char* const, const SlotTable* const, const MetaObject* const,
+              const std::size_t size = 0);
    MetaObject(const MetaObject&) = delete;
    MetaObject& operator=(const MetaObject&) = delete;
 
@@ -26,6 +45,25 @@ public:
 //   const std::string& getClassName() const        { return class_name; }
 //   const std::string& getFactoryName() const      { return factory_name; }
 
+   std::size_t getInstanceSize() const     { return size; }         // sizeof() the class
+   int getExactCount() const;                                       // live instances of exactly this class
+   long getOwnedBytes() const              { return ownedBytes; }   // memory owned by the live instances
+   std::size_t getApproxBytes() const;                              // exact count * size + owned bytes
+   double getAllocationRate() const        { return allocRate; }    // instances created per second
+
+   // Adds (or removes, if negative) memory owned by an instance of this class
+   void addOwnedBytes(const long n)        { ownedBytes += n; }
+
+   // List of all meta-objects
+   const MetaObject* getNext() const       { return next; }
+   static const MetaObject* getFirst();
+
+   // Computes the allocation rates of all classes over the last 'dt' seconds
+   static void updateAllocationRates(const double dt);
+
+   // Prints the statistics of all classes with live instances
+   static void printStatistics(std::ostream& sout);
+
    const SlotTable* const slottable {};         // pointer to the SlotTable
    const MetaObject* const baseMetaObject {};   // pointer to the base object's MetaObject
    int count {};                                // current number of object instances
@@ -35,6 +73,14 @@ public:
 private:
    const std::string class_name;                // class name from 'type_info'
    const std::string factory_name;              // factory name
+   const std::size_t size {};                   // sizeof() the class
+
+   std::atomic<long> ownedBytes {};             // memory owned by the live instances (bytes)
+   int lastTc {};                               // 'tc' at the last updateAllocationRates()
+   double allocRate {};                         // instances created per second
+
+   MetaObject* next {};                         // next meta-object in the list of all meta-objects
+   static MetaObject* first;                    // first meta-object in the list
 };
 
 }
@@ -20,6 +20,7 @@
 
 namespace mixr {
 namespace base {
+class Identifier;
 
 //------------------------------------------------------------------------------
 // Class: Object
@@ -297,8 +298,10 @@ class Object : public Referenced
    public: static const SlotTable& getSlotTable();
    protected: virtual bool setSlotByIndex(const int slotindex, Object* const obj);
    public: bool setSlotByName(const char* const slotname, Object* const obj);
+   public: bool setSlotByName(const Identifier& slotname, Object* const obj);
    public: const char* slotIndex2Name(const int slotindex) const;
    public: int slotName2Index(const char* const slotname) const;
+   public: int slotName2Index(const Identifier& slotname) const;
 
 public:
    // standard message types
@@ -32,6 +32,10 @@ class Identifier;
 //   Finds a pair by name (const version)
 //     const Pair* findByName(const char* const slotname) const;
 //
+//   Finds a pair by an interned name (symbol compare)
+//     Pair* findByName(const Identifier& slotname);
+//     const Pair* findByName(const Identifier& slotname) const;
+//
 //   Finds the name associated with an object
 //     const Identifier* findName(const Object* const obj) const;
 //
@@ -77,6 +81,10 @@ public:
    // Finds a pair by name (const version)
    const Pair* findByName(const char* const slotname) const;
 
+   // Finds a pair by an interned name (symbol compare)
+   Pair* findByName(const Identifier& slotname);
+   const Pair* findByName(const Identifier& slotname) const;
+
    // Finds the name associated with an object
    const Identifier* findName(const Object* const obj) const;
 
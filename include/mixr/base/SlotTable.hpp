@@ -4,6 +4,7 @@
 
 namespace mixr {
 namespace base {
+class Identifier;
 
 //------------------------------------------------------------------------------
 // Class: SlotTable
@@ -21,6 +22,11 @@ namespace base {
 // Slot tables are usually defined using the macros BEGIN_SLOTTABLE and
 // END_SLOTTABLE (see macros.hpp).
 //
+// The slot names are interned as Identifier symbols when the table is
+// constructed, so index() of an Identifier (e.g., a Pair's slot name, which
+// was interned when the Pair was created) is a pointer compare down the base
+// class chain, without touching the symbol table.
+//
 //------------------------------------------------------------------------------
 class SlotTable
 {
@@ -38,13 +44,20 @@ public:
    // Returns the index, [ 1 .. n() ], for slot name 'slotname', or zero if not found
    int index(const char* const slotname) const;
 
+   // Returns the index, [ 1 .. n() ], for slot name 'slotname' (symbol compare), or zero if not found
+   int index(const Identifier& slotname) const;
+
    // Returns the name of the slot at index 'slotindex', range [ 1 .. n() ],
    // or zero is returned if the index is out of range.
    const char* name(const int slotindex) const;
 
 private:
+   void initSymbols();
+   int indexBySymbol(const char* const sym) const;
+
    SlotTable* baseTable {};   // Pointer to base class's slot table
    char** slots1 {};          // Array of slot names
+   const char** syms1 {};     // Array of interned slot name symbols
    int nslots1 {};            // Number of slots in table
 };
 
@@ -22,6 +22,9 @@ namespace base {
 //      Comparison Operators:     <  <=  ==  >=  >  !=
 //      iostream Operations:      <<  >>
 //
+// Note: Strings shorter than SSO_SIZE characters are stored in a small
+//       internal buffer, so short names never touch the heap.
+//
 // Factory name: String
 //------------------------------------------------------------------------------
 class String : public Object
@@ -31,6 +34,7 @@ class String : public Object
 public:
     enum class Justify { NONE, LEFT, RIGHT, CENTER };
     static const int MAX_STRING_LENGTH {512};   // only by setString()
+    static const std::size_t SSO_SIZE {24};     // size of the small string buffer (incl. null)
 
 public:
     String(const char*);
@@ -74,9 +78,13 @@ public:
     virtual void setString(const String& str, const std::size_t w, const Justify j = Justify::NONE);
 
 private:
+    bool isHeapStr() const    { return (str != nullptr && str != sbuf); }
+    void freeStr();
+
     char* str {};         // the character string
     std::size_t n {};     // length of this string
     std::size_t nn {};    // length of the memory allocated for this string
+    char sbuf[SSO_SIZE] {};  // small string buffer (used when length < SSO_SIZE)
 };
 
 //------------------------------------------------------------------------------
@@ -0,0 +1,92 @@
+
+#ifndef __mixr_base_TimerWheel_H__
+#define __mixr_base_TimerWheel_H__
+
+#include <cstdint>
+#include <vector>
+
+namespace mixr {
+namespace base {
+
+class Timer;
+
+//------------------------------------------------------------------------------
+// Class: TimerWheel
+//
+// Description: Hierarchical timing wheel used to run the interval timers
+//              (see Timers.hpp).
+//
+//    The wheel keeps a clock (seconds) that is advanced by advance(); running
+//    timers compute their current time from this clock, so advancing the wheel
+//    does not touch the timers themselves.  Timers that have a pending alarm
+//    are scheduled into the wheel, and only timers that reach their alarm time
+//    are visited when the wheel is advanced (see Timer::onAlarm()).
+//
+//    The wheel has LEVELS levels of SLOTS slots each, with a resolution of
+//    TICK seconds at the lowest level; each higher level covers SLOTS times
+//    the span of the one below it.  Timers are kept in intrusive lists, so
+//    schedule() and cancel() are O(1) and there is no limit on the number of
+//    timers.  Alarms beyond the span of the wheel are parked in the top level
+//    and re-scheduled as the wheel turns.
+//
+//    There is one wheel per update thread (see Timer::Wheel); schedule(),
+//    cancel() and advance() are protected by the wheel's semaphore.
+//
+// Public methods:
+//
+//    double getClock() const
+//       Returns the wheel's clock (seconds)
+//
+//    unsigned int getNumScheduled() const
+//       Returns the number of timers that are waiting on an alarm
+//
+//    void advance(const double dt)
+//       Advances the clock by 'dt' seconds and calls Timer::onAlarm() for
+//       each timer that reached its alarm time.
+//
+//    void schedule(Timer* const timer, const double delay)
+//       Schedules the alarm of 'timer' to expire 'delay' seconds from now;
+//       any previously scheduled alarm of 'timer' is cancelled.
+//
+//    void cancel(Timer* const timer)
+//       Cancels the scheduled alarm of 'timer', if any.
+//
+//------------------------------------------------------------------------------
+class TimerWheel
+{
+public:
+   static const unsigned int LEVELS {4};
+   static const unsigned int SLOT_BITS {6};
+   static const unsigned int SLOTS {1 << SLOT_BITS};
+   static const double TICK;
+
+public:
+   TimerWheel() = default;
+   TimerWheel(const TimerWheel&) = delete;
+   TimerWheel& operator=(const TimerWheel&) = delete;
+   ~TimerWheel() = default;
+
+   double getClock() const                { return clock; }
+   unsigned int getNumScheduled() const   { return nScheduled; }
+
+   void advance(const double dt);
+   void schedule(Timer* const timer, const double delay);
+   void cancel(Timer* const timer);
+
+private:
+   void insert(Timer* const timer);
+   void unlink(Timer* const timer);
+   void cascade(const unsigned int level);
+
+   Timer* slots[LEVELS][SLOTS] {};   // Slot list heads
+   std::uint64_t tick {};            // Current tick
+   double clock {};                  // Current clock (seconds)
+   unsigned int nScheduled {};       // Number of scheduled timers
+   std::vector<Timer*> expired;      // Expired timers (reused)
+   long semaphore {};                // Semaphore for the wheel
+};
+
+}
+}
+
+#endif
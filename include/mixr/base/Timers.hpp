@@ -4,11 +4,15 @@
 
 #include "mixr/base/Object.hpp"
 
+#include <cstdint>
+
 namespace mixr {
 namespace base {
 
+class Identifier;
 class Number;
 class Time;
+class TimerWheel;
 
 //------------------------------------------------------------------------------
 // Class: Timer
@@ -16,9 +20,22 @@ class Time;
 // Description: General purpose up/down timer.
 //
 // Slots:
-//    timerValue  <Time>      ! Timer interval (default: 0)
-//    alarmTime   <Time>      ! Alarm time (default: 0)
-//    active      <Boolean>   ! Sets timer active (running) flag (default: false)
+//    timerValue  <Time>        ! Timer interval (default: 0)
+//    alarmTime   <Time>        ! Alarm time (default: 0)
+//    active      <Boolean>     ! Sets timer active (running) flag (default: false)
+//    wheel       <Identifier>  ! Timer wheel (i.e., update thread): TC or BG (default: TC)
+//
+// Notes:
+//    1) Timers are run by a timer wheel (see TimerWheel.hpp); there's one
+//       wheel for the time-critical (TC) thread and one for the background
+//       (BG) thread, and each is advanced by updateTimers().  A running
+//       timer's current time is computed from its wheel's clock, so there
+//       is no limit on the number of timers and the cost of updateTimers()
+//       doesn't depend on the number of timers.
+//
+//    2) Running timers with a pending alarm are scheduled in their wheel,
+//       and onAlarm() is called, from the thread that updates the wheel,
+//       when the timer reaches its alarm time.
 //
 //------------------------------------------------------------------------------
 class Timer : public Object
@@ -27,8 +44,7 @@ class Timer : public Object
 
 public:
     enum class Type { UP, DOWN };        // Timer type/direction
-
-    static  const unsigned int MAX_TIMERS {MIXR_CONFIG_MAX_INTERVAL_TIMERS};
+    enum class Wheel { TC, BG };         // Timer wheel (update thread)
 
 public:
     Timer();
@@ -39,6 +55,9 @@ public:
     double getAlarmTime() const;     // Alarm time (seconds)
     double getTimerValue() const;    // Timer interval (i.e., reset value) (seconds)
 
+    Wheel getWheel() const;          // Timer wheel
+    virtual bool setWheel(const Wheel);
+
     bool isRunning() const;    // Return true of the timer is active.
     bool isNotRunning() const; // Return true of the timer is not active.
 
@@ -81,40 +100,55 @@ public:
     virtual bool setAlarmTime(const double sec);      // Set the alarm time (sec)
     virtual bool setTimerValue(const double sec);     // Set the interval time (i.e., reset value) (sec)
 
-    // Updates all of the instances of Timer.
-    // ---Called by the main application routine.
-    static void updateTimers(const double dt);
+    // Updates all of the instances of Timer on timer wheel 'w'.
+    // ---Called by the main application routine (or Station) from the
+    //    thread that owns the wheel.
+    static void updateTimers(const double dt, const Wheel w = Wheel::TC);
 
-    // Updates this timer.  Usually called by updateTimers().
+    // Returns the timer wheel 'w'
+    static TimerWheel& getTimerWheel(const Wheel w);
+
+    // Manually advances this timer by 'dt' seconds (in addition to its wheel)
     virtual void update(const double dt);
 
+    // Called by the timer wheel when this timer reaches its alarm time
+    virtual void onAlarm();
+
 private:
-    void initData();
+    friend class TimerWheel;
+
+    double wheelClock() const;      // Clock of our timer wheel
+    void sync();                    // Folds the elapsed wheel time into 'ctime'
+    void scheduleAlarm();           // (Re)schedules our alarm with our wheel
+    void alarmExpired();            // Called by the wheel
 
-    double ctime {};           // Current time (seconds).
+    double ctime {};           // Current time (seconds) at 'refClock'.
+    double refClock {};        // Wheel clock at the last sync (seconds).
     double alarmTime {};       // Alarm time (seconds).
     double timerValue {};      // Timer value (seconds).
     bool   active {};          // Active flag.
     Type dir {Type::DOWN};     // Direction up/down.
+    Wheel wheel {Wheel::TC};   // Our timer wheel
 
-    static bool frz;                   // Freeze all timers (freeze time)
-    static Timer* timers[MAX_TIMERS];  // List of timers
-    static unsigned int nTimers;       // Number of timers in the list
-    static long semaphore;             // Semaphore for the timer list
+    // timer wheel links (managed by TimerWheel)
+    Timer* wPrev {};
+    Timer* wNext {};
+    Timer** wSlot {};
+    std::uint64_t wExpire {};
 
-    static void addToTimerList(Timer*);
-    static void removeFromTimerList(Timer*);
+    static bool frz;                   // Freeze all timers (freeze time)
 
 private:
     // slot table helper methods
     bool setSlotTimerValue(const Time* const);      // Sets the timer value
     bool setSlotAlarmTime(const Time* const);       // Sets the alarm value
     bool setSlotTimerActive(const Number* const);   // Sets the timer active (running) flag
+    bool setSlotWheel(const Identifier* const);     // Sets the timer wheel
 };
 
 //
 inline Timer::Type Timer::getType() const       { return dir; }
-inline double Timer::getCurrentTime() const     { return ctime; }
+inline Timer::Wheel Timer::getWheel() const     { return wheel; }
 inline double Timer::getAlarmTime() const       { return alarmTime; }
 inline double Timer::getTimerValue() const      { return timerValue; }
 inline bool Timer::isRunning() const            { return active; }
@@ -38,6 +38,10 @@ class Number;
 //       result is clamped at the last known dependent value.  If the extrapolate
 //       flag is true, we'll extrapolate beyond the given data table.
 //
+//    4) Once loaded, tables are treated as immutable: the classes that hold
+//       them keep const pointers and share them by reference (ref()) with
+//       their clones instead of cloning the table data.
+//
 // Exceptions:
 //      ExpInvalidTable
 //          Thrown by Table derived classes' lfi(), minX(), maxX(), minY(),
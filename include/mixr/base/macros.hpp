@@ -150,7 +150,7 @@
 #define IMPLEMENT_SUBCLASS(ThisType, FACTORYNAME)                                      \
     ::mixr::base::MetaObject ThisType::metaObject(                                     \
       typeid(ThisType).name(), FACTORYNAME,                                            \
-        &ThisType::slottable, BaseClass::getMetaObject()                               \
+        &ThisType::slottable, BaseClass::getMetaObject(), sizeof(ThisType)             \
     );                                                                                 \
     const ::mixr::base::MetaObject* ThisType::getMetaObject() { return &metaObject; }  \
     const char* ThisType::getFactoryName() { return metaObject.getFactoryName(); }     \
@@ -188,7 +188,7 @@
 #define IMPLEMENT_PARTIAL_SUBCLASS(ThisType, FACTORYNAME)                              \
     ::mixr::base::MetaObject ThisType::metaObject(                                     \
       typeid(ThisType).name(), FACTORYNAME,                                            \
-        &ThisType::slottable, BaseClass::getMetaObject()                               \
+        &ThisType::slottable, BaseClass::getMetaObject(), sizeof(ThisType)             \
     );                                                                                 \
     const ::mixr::base::MetaObject* ThisType::getMetaObject() { return &metaObject; }  \
     const char* ThisType::getFactoryName() { return metaObject.getFactoryName(); }     \
@@ -209,7 +209,7 @@
 #define IMPLEMENT_ABSTRACT_SUBCLASS(ThisType, FACTORYNAME)                             \
     ::mixr::base::MetaObject ThisType::metaObject(                                     \
       typeid(ThisType).name(), FACTORYNAME,                                            \
-        &ThisType::slottable, BaseClass::getMetaObject()                               \
+        &ThisType::slottable, BaseClass::getMetaObject(), sizeof(ThisType)             \
     );                                                                                 \
     const ::mixr::base::MetaObject* ThisType::getMetaObject() { return &metaObject; }  \
     const char* ThisType::getFactoryName() { return metaObject.getFactoryName(); }     \
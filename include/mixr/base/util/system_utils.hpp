@@ -68,6 +68,11 @@ bool convertNtp2Sec(
 // doesFileExist -- returns true if file exists
 bool doesFileExist(const char* const fullname);
 
+// Returns true if the CPU supports the AVX (or AVX2) instructions; always
+// false if the compiler can't tell (i.e., other than GCC or Clang on x86)
+bool isCpuAvxSupported();
+bool isCpuAvx2Supported();
+
 }
 }
 
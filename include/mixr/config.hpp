@@ -15,32 +15,23 @@
 #define MIXR_VERSION 170600
 #endif
 
-// Max number of interval timers (see Timers.hpp)
-#ifndef MIXR_CONFIG_MAX_INTERVAL_TIMERS
-#define MIXR_CONFIG_MAX_INTERVAL_TIMERS 500
-#endif
-
-// Max number of "player's of interest" (see Gimbal.hpp)
-#ifndef MIXR_CONFIG_MAX_PLAYERS_OF_INTEREST
-#define MIXR_CONFIG_MAX_PLAYERS_OF_INTEREST 4000
-#endif
-
 // Max size of the RF emission queues (see RfSystem.hpp)
 #ifndef MIXR_CONFIG_RF_MAX_EMISSIONS
 #define MIXR_CONFIG_RF_MAX_EMISSIONS 800
 #endif
 
-// Max tracks (see TrackManager.hpp)
+// Default max tracks; run time 'maxTracks' slot (see TrackManager.hpp)
 #ifndef MIXR_CONFIG_MAX_TRACKS
 #define MIXR_CONFIG_MAX_TRACKS 200
 #endif
 
-// Max number of radar reports (see Radar.hpp and TrackManager.hpp)
+// Default max number of radar reports; run time 'maxReports' slot (see Radar.hpp and TrackManager.hpp)
 #ifndef MIXR_CONFIG_MAX_REPORTS
 #define MIXR_CONFIG_MAX_REPORTS 200
 #endif
 
-// Max number of networked entites (see NetIO.hpp)
+// Max number of networked entites for fixed size tables (see hla/NetIO.hpp);
+// the common NetIO NIB lists grow as needed
 #ifndef MIXR_CONFIG_MAX_NETIO_ENTITIES
 #define MIXR_CONFIG_MAX_NETIO_ENTITIES 5000
 #endif
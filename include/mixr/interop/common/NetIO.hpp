@@ -6,6 +6,7 @@
 
 #include "mixr/base/String.hpp"
 #include <array>
+#include <vector>
 
 namespace mixr {
 namespace base { class Angle; class Distance; class Identifier; class String; class Time; }
@@ -278,7 +279,8 @@ public:
    virtual bool addNib2InputList(Nib* const);
 
 protected:
-   // Maximum number of active objects
+   // Maximum number of active objects for fixed size protocol tables
+   // (the NIB input and output lists below grow as needed)
    static const int MAX_OBJECTS = MIXR_CONFIG_MAX_NETIO_ENTITIES;
 
    // Create NIB unique to protocol (pure functions!)
@@ -424,12 +426,12 @@ private:
 
 private: // Nib related private
    // input tables
-   std::array<Nib*, MAX_OBJECTS> inputList {};  // Table of input objects in name order
-   unsigned int nInNibs {};                     // Number of input objects in both tables
+   std::vector<Nib*> inputList;    // Table of input objects in name order (grows as needed)
+   unsigned int nInNibs {};        // Number of input objects in both tables
 
    // output tables
-   std::array<Nib*, MAX_OBJECTS> outputList {}; // Table of output objects in name order
-   unsigned int nOutNibs {};                    // Number of output objects in both tables
+   std::vector<Nib*> outputList;   // Table of output objects in name order (grows as needed)
+   unsigned int nOutNibs {};       // Number of output objects in both tables
 
    // NIB quick lookup key
    struct NibKey {
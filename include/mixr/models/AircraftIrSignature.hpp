@@ -4,8 +4,12 @@
 
 #include "mixr/models/IrSignature.hpp"
 
+#include <deque>
+#include <map>
+#include <vector>
+
 namespace mixr {
-namespace base { class Number; class List; class Table1; class Table2;
+namespace base { class Angle; class Number; class List; class Table1; class Table2;
                  class Table3; class Table4; class Table5; }
 namespace models {
 class AirVehicle;
@@ -26,10 +30,21 @@ class IrShape;
 //    plumeWavebandFactorTable        <Table2>      !
 //    hotPartsSignatureTable          <Table5>      !
 //    hotPartsWavebandFactorTable     <Table2>      !
+//    aspectTolerance                 <Angle>       ! Aspect bin size of the signature cache; zero
+//                                    <Number>      ! for no cache (default: 0) (Number: radians)
 //
 // Public member functions:
 //      double getIrSignature(IrQueryMsg* msg)
 //          Computes the IR signature for the emission.
+//
+// Notes:
+//    1) When 'aspectTolerance' is greater than zero, the signatures by waveband
+//       are cached for each frame (executive time).  The query's azimuth and
+//       elevation angles of incidence are binned by 'aspectTolerance', and the
+//       signatures are computed at the center of the bin, once for each bin and
+//       sensor waveband; the other queries in the frame, from any sensor and
+//       any thread, reuse them.  The airframe, plume and hot parts signatures
+//       are then approximate to the size of the bins.
 //------------------------------------------------------------------------------
 class AircraftIrSignature : public IrSignature
 {
@@ -40,6 +55,14 @@ public:
 
    bool getIrSignature(IrQueryMsg* const) override;
 
+   double getAspectTolerance() const              { return aspectTol; }   // radians
+   virtual bool setAspectTolerance(const double radians);
+
+   // Signature cache statistics
+   unsigned long getNumCacheLookups() const;
+   unsigned long getNumCacheHits() const;
+   double getCacheHitRate() const;                // Hits / lookups [ 0 .. 1 ]
+
 protected:
    virtual double* getHeatSignature(IrQueryMsg*);
 
@@ -72,6 +95,17 @@ protected:
    virtual double getPLA(const AirVehicle* const airModel);
 
 private:
+   // Aspect bin and sensor waveband of a cached signature
+   struct CacheKey {
+      long long az {};              // Azimuth bin
+      long long el {};              // Elevation bin
+      double lower {};              // Sensor lower wavelength (microns)
+      double upper {};              // Sensor upper wavelength (microns)
+      bool operator<(const CacheKey& k) const;
+   };
+
+   double* getCachedHeatSignature(IrQueryMsg* const);
+
    const base::Table4* airframeSignatureTable {};
             // mapping of
             // signature  x is the velocity (in mach #) and y is altitude (in sim prevailing units --
@@ -122,6 +156,16 @@ private:
    double* plumeSigs {};         // 2 dimensions i = bin, j = lower wavelength, upper wavelength, signature
    double* hotPartsSigs {};      // 2 dimensions i = bin, j = lower wavelength, upper wavelength, signature
 
+   // Signature cache
+   double aspectTol {};                               // Aspect bin size (radians; zero if no cache)
+   mutable long cacheLock {};                         // Cache lock
+   double cacheTime {-1.0};                           // Executive time of the cached signatures (seconds)
+   std::map<CacheKey, unsigned int> cacheIndex;       // Index of each key's signatures
+   std::deque< std::vector<double> > cacheSigs;       // Signatures (same layout as airframeSig)
+   unsigned int numCacheSigs {};                      // Number of 'cacheSigs' in use this frame
+   unsigned long cacheLookups {};                     // Number of lookups
+   unsigned long cacheHits {};                        // Number of hits
+
 private:
    // slot table helper methods
    bool setSlotAirframeSignatureTable(const base::Table4* const);
@@ -130,6 +174,8 @@ private:
    bool setSlotPlumeWavebandFactorTable(const base::Table2* const);
    bool setSlotHotPartsSignatureTable(const base::Table5* const);
    bool setSlotHotPartsWavebandFactorTable(const base::Table2* const);
+   bool setSlotAspectTolerance(const base::Angle* const);
+   bool setSlotAspectTolerance(const base::Number* const);
 };
 
 }
@@ -0,0 +1,71 @@
+
+#ifndef __mixr_models_ElevationBatch_H__
+#define __mixr_models_ElevationBatch_H__
+
+#include "mixr/base/Object.hpp"
+#include "mixr/base/safe_ptr.hpp"
+
+#include <vector>
+
+namespace mixr {
+namespace base { class PairStream; }
+namespace terrain { class Terrain; }
+namespace models {
+class Player;
+
+//------------------------------------------------------------------------------
+// Class: ElevationBatch
+// Description: Terrain elevation queries of the players, gathered each
+//              background frame and evaluated together (see WorldModel).
+//
+//    build() gathers the players that need their terrain elevation from the
+//    terrain database -- the active (and pre-release) players that don't get
+//    it from the IG system (see Player::isTerrainElevationRequired()) -- and
+//    sorts their queries by terrain tile (one degree cell) and then by post
+//    cell (three arc-seconds) within the tile, so the queries that use the
+//    same posts are evaluated together.
+//
+//    evaluate() looks up the elevations of a part of the sorted queries and
+//    writes them back to their players (Player::setTerrainElevation()); the
+//    background threads each evaluate their own part.
+//
+//    The batch holds a reference to the player list it was built from, so its
+//    players remain valid until the next build().
+//
+// Factory name: ElevationBatch
+//------------------------------------------------------------------------------
+class ElevationBatch : public base::Object
+{
+   DECLARE_SUBCLASS(ElevationBatch, base::Object)
+
+public:
+   ElevationBatch();
+
+   // Gathers and sorts the players' queries from the list of players
+   // (base::PairStream of Players)
+   virtual void build(base::PairStream* const players);
+
+   // Evaluates part 'idx' of 'n' parts of the queries, idx: [ 1 .. n ]
+   virtual void evaluate(const terrain::Terrain* const terrain, const unsigned int idx, const unsigned int n) const;
+
+   unsigned int getNumQueries() const     { return static_cast<unsigned int>(queries.size()); }
+
+private:
+   struct Query {
+      unsigned long long key {};    // Tile and cell (sort key)
+      Player* player {};            // Player (not ref()'d; held by the player list)
+      double lat {};                // Player's latitude (degs)
+      double lon {};                // Player's longitude (degs)
+      bool interp {};               // Interpolate the posts
+   };
+
+   static unsigned long long computeKey(const double lat, const double lon);
+
+   std::vector<Query> queries;                      // Sorted queries
+   base::safe_ptr<const base::PairStream> plist;    // Player list the batch was built from
+};
+
+}
+}
+
+#endif
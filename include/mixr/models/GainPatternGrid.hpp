@@ -0,0 +1,92 @@
+
+#ifndef __mixr_models_GainPatternGrid_H__
+#define __mixr_models_GainPatternGrid_H__
+
+#include "mixr/models/UniformGrid.hpp"
+
+#include "mixr/base/Object.hpp"
+#include "mixr/base/safe_ptr.hpp"
+
+namespace mixr {
+namespace base { class Function; class Func1; class Func2; }
+namespace models {
+
+//------------------------------------------------------------------------------
+// Class: GainPatternGrid
+// Description: Antenna gain pattern compiled into a dense, uniformly spaced
+//              grid of linear gains, with bilinear (or linear) lookups.
+//
+//    A 2D gain pattern (base::Func2 of azimuth and elevation off boresight) is
+//    sampled over [ -PI, PI ] azimuth by [ -PI/2, PI/2 ] elevation, and a 1D
+//    gain pattern (base::Func1 of the angle off boresight) is sampled over
+//    [ 0, PI ] (see UniformGrid).  The lookups are clamped to the grid.
+//
+//    The pattern's gains (dB) are converted to linear gains when the grid is
+//    built, so the lookups return linear gains.  The grid's nodes are exact;
+//    between them, the gains are interpolated in linear units.  build()
+//    samples the pattern halfway between the nodes to find the worst-case
+//    error (dB) of the grid; see getMaxError().
+//
+//    The grid isn't changed after it's built, so it can be shared between
+//    antennas (e.g., clones) and used by multiple threads.
+//
+// Factory name: GainPatternGrid
+//------------------------------------------------------------------------------
+class GainPatternGrid : public base::Object
+{
+   DECLARE_SUBCLASS(GainPatternGrid, base::Object)
+
+public:
+   GainPatternGrid();
+
+   // Builds the grid from the gain pattern (dB) with a max node spacing of
+   // 'resolution' radians; 'degrees' is true if the pattern's independent
+   // variables are in degrees.  Returns false if the pattern isn't a
+   // base::Func1 or base::Func2, or the resolution isn't positive.
+   virtual bool build(const base::Function* const pattern, const bool degrees, const double resolution);
+
+   // True if the grid was built from this pattern, units and resolution
+   bool isBuiltFrom(const base::Function* const pattern, const bool degrees, const double resolution) const;
+
+   bool isValid() const                         { return !gains.isEmpty(); }
+   bool is2D() const                            { return twoD; }
+   double getResolution() const                 { return resolution; }    // Max node spacing (radians)
+   unsigned int getNumPoints() const            { return gains.getNumPoints(); }
+
+   // Worst-case error (dB) found by build(), and where it was found (radians;
+   // az & el, or angle off boresight & zero)
+   double getMaxError() const                   { return maxErr; }
+   double getMaxErrorAngle1() const             { return maxErrAngle1; }
+   double getMaxErrorAngle2() const             { return maxErrAngle2; }
+
+   // Linear gain at 'angle' off boresight (1D) or at 'az' and 'el' off
+   // boresight (2D) (radians)
+   double getGain(const double angle) const;
+   double getGain(const double az, const double el) const;
+
+   // Linear gains of 'n' targets
+   void getGains(const double* const angles, double* const gains, const unsigned int n) const;
+   void getGains(const double* const az, const double* const el, double* const gains, const unsigned int n) const;
+
+private:
+   double evaluate(const double a1, const double a2) const;   // Pattern's gain (dB)
+   void checkError(const double a1, const double a2);
+
+   UniformGrid gains;               // Linear gains; azimuth (or angle off boresight) by elevation
+   bool twoD {};                    // 2D pattern
+
+   base::safe_ptr<const base::Function> pattern;  // Source gain pattern
+   const base::Func1* func1 {};     // Source pattern as a Func1
+   const base::Func2* func2 {};     // Source pattern as a Func2
+   bool degrees {};                 // Source pattern is in degrees
+   double resolution {};            // Max node spacing (radians)
+
+   double maxErr {};                // Worst-case error (dB)
+   double maxErrAngle1 {};          // ... at this angle (radians)
+   double maxErrAngle2 {};          // ... and this angle (radians)
+};
+
+}
+}
+
+#endif
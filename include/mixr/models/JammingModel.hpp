@@ -0,0 +1,134 @@
+
+#ifndef __mixr_models_JammingModel_H__
+#define __mixr_models_JammingModel_H__
+
+#include "mixr/base/Object.hpp"
+#include "mixr/base/osg/Vec3d"
+
+#include <vector>
+
+namespace mixr {
+namespace base { class Distance; class Frequency; }
+namespace models {
+class Player;
+class RfSystem;
+
+//------------------------------------------------------------------------------
+// Class: JammingModel
+// Description: Aggregated noise jamming of the players' radars (see WorldModel)
+//
+//    When the world model has a jamming model, the active noise jammers (see
+//    Jammer) register with the model each transmit phase, instead of sending
+//    their noise emissions to each of the players.  At the end of the transmit
+//    phase, build() bins the jammers by their NED position, 'cellSize' cells
+//    in x and y, and by their center frequency, 'frequencyBand' bands.  Each
+//    bin keeps its summed jamming strength, its strength weighted centroid and
+//    the frequency span of its jammers.
+//
+//    getJamSignal() then returns, in a single query, a receiver's summed noise
+//    jamming signal from all of the jammers that are in its band: the jammers
+//    of the bins within one cell of the receiver are summed one by one, and
+//    the jammers of the farther bins are summed at their bin's centroid.  Each
+//    jammer's signal follows RfSystem::computeReceivedSignal(): its power,
+//    transmit loss and range loss, the receiver's antenna gain and pattern
+//    gain toward the jammer (toward the centroid for the farther bins) and
+//    signal process loss, and the ratio of the receiver's and the jammer's
+//    bandwidths.
+//
+// Factory name: JammingModel
+// Slots:
+//    cellSize        <base::Distance>   ! Size of the jammers' spatial cells (default: 10 km)
+//    frequencyBand   <base::Frequency>  ! Width of the jammers' frequency bands (default: 100 MHz)
+//
+// Notes:
+//    1) The jammers' antennas are treated as isotropic at their peak 'gain'
+//       (no gain patterns), so every receiver gets their main-lobe noise,
+//       even where the jammers' own antennas are pointed elsewhere.  The
+//       receivers' gain patterns are applied.  Polarization is matched;
+//       there are no atmospheric losses and no terrain occulting checks.
+//       The jammers' antennas' 'maxRange2PlayersOfInterest' limits their
+//       range.
+//
+//    2) The registered jammers don't send any emissions, so they aren't
+//       detected by the other players' RWRs and ESM systems.
+//
+//    3) Jammers register from any thread (locked); the model is built between
+//       the transmit and receive phases, and is read only during the receive
+//       phase.
+//------------------------------------------------------------------------------
+class JammingModel : public base::Object
+{
+   DECLARE_SUBCLASS(JammingModel, base::Object)
+
+public:
+   JammingModel();
+
+   double getCellSize() const                { return cellSize; }      // meters
+   double getFrequencyBand() const           { return freqBand; }      // hertz
+
+   virtual bool setCellSize(const double meters);
+   virtual bool setFrequencyBand(const double hz);
+
+   // Registers an active noise jammer for this frame (transmit phase)
+   virtual void addJammer(const RfSystem* const jammer);
+
+   // Bins this frame's jammers (end of the transmit phase)
+   virtual void build();
+
+   // Clears the jammers and bins
+   virtual void clear();
+
+   // Returns the receiver's summed noise jamming signal (watts) from this
+   // frame's jammers (receive phase)
+   virtual double getJamSignal(const RfSystem* const receiver) const;
+
+   unsigned int getNumJammers() const        { return static_cast<unsigned int>(jammers.size()); }
+   unsigned int getNumBins() const           { return static_cast<unsigned int>(bins.size()); }
+
+private:
+   struct Source {
+      const Player* player {};   // Jammer's player (not ref()'d)
+      base::Vec3d pos;           // Position; NED (meters)
+      double freqStart {};       // Start of the jammer's band (hertz)
+      double freqEnd {};         // End of the jammer's band (hertz)
+      double strength {};        // Jamming strength: power * gain * (lambda^2 / 4PI) / bandwidth
+      double loss {};            // Transmit loss
+      double maxRange {};        // Max range (meters) or zero for all
+      int ix {};                 // Cell (x)
+      int iy {};                 // Cell (y)
+      int band {};               // Frequency band
+   };
+
+   struct Bin {
+      base::Vec3d centroid;      // Strength weighted centroid; NED (meters)
+      double freqStart {};       // Start of the bin's frequency span (hertz)
+      double freqEnd {};         // End of the bin's frequency span (hertz)
+      double strength {};        // Summed jamming strength / transmit loss (jammers with losses only)
+      double minLoss {};         // Smallest transmit loss of the bin's jammers
+      double maxRange {};        // Max range (meters) of the bin's jammers, or zero for all
+      int ix {};                 // Cell (x)
+      int iy {};                 // Cell (y)
+      std::size_t first {};      // First of the bin's jammers
+      std::size_t last {};       // Last (+1) of the bin's jammers
+   };
+
+   static double rangeLoss(const double range);
+
+   double cellSize {10000.0};             // Size of the spatial cells (meters)
+   double freqBand {100.0e6};             // Width of the frequency bands (hertz)
+
+   std::vector<Source> pending;           // Jammers registered this frame
+   std::vector<Source> jammers;           // Binned jammers, sorted by bin
+   std::vector<Bin> bins;                 // Bins
+   mutable long pendingLock {};           // Lock for the registered jammers
+
+private:
+   // slot table helper methods
+   bool setSlotCellSize(const base::Distance* const);
+   bool setSlotFrequencyBand(const base::Frequency* const);
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,183 @@
+
+#ifndef __mixr_models_PlayerIndex_H__
+#define __mixr_models_PlayerIndex_H__
+
+#include "mixr/base/Object.hpp"
+#include "mixr/base/safe_ptr.hpp"
+#include "mixr/base/osg/Vec3d"
+
+#include <vector>
+
+namespace mixr {
+namespace base { class PairStream; }
+namespace models {
+class Player;
+
+//------------------------------------------------------------------------------
+// Class: PlayerIndex
+// Description: Spatial index of the players, used for range and cone queries
+//              (e.g., players of interest, collision and detonation checks)
+//              in place of a linear scan of the player list.
+//
+//    The players' geocentric (ECEF) positions, and separately their gaming
+//    area (NED) positions, are binned into uniform grids of cubic cells, and
+//    only the occupied cells are stored (sorted by cell).  A query, in either
+//    coordinate system, either probes the cells that overlap its bounds or,
+//    if that's fewer, scans the occupied cells; in both cases, whole cells are
+//    culled before their players are tested.
+//
+//    The index is built once per frame by the WorldModel, at the end of the
+//    dynamics phase, and it's not changed after that, so any number of threads
+//    may query it.  The WorldModel replaces it with a new index each frame (see
+//    WorldModel::getPlayerIndex()).
+//
+//    The index holds a reference to the player list it was built from, so its
+//    players remain valid for as long as the index is referenced.
+//
+// Factory name: PlayerIndex
+//
+// Notes:
+//    1) The query results are the players whose indexed positions pass the
+//       range and angle tests.  They're returned in player list order (local
+//       players first), and they include all players (e.g., inactive players
+//       and our own player), so callers should still apply their own filters.
+//
+//    2) The indexed positions are from the end of the last dynamics phase;
+//       callers outside of the transmit, receive and process phases should
+//       pad their ranges by the distance that the players could have closed
+//       since then (see getMaxClosure()).  Callers that compare gaming area
+//       (NED) positions query the NED grid, so their ranges need no padding
+//       for the flat earth projection.
+//
+//    3) findPlayers() pads the range, and falls back to the full player list
+//       when the index can't be used, so it's a drop-in replacement for a scan
+//       of the player list followed by a range check.
+//
+//    4) The query results are appended to the caller's 'list' and 'slots'
+//       vectors, which are the query's only buffers; callers that keep these
+//       vectors, and clear() them between queries, don't allocate.
+//------------------------------------------------------------------------------
+class PlayerIndex : public base::Object
+{
+   DECLARE_SUBCLASS(PlayerIndex, base::Object)
+
+public:
+   static const double DEFAULT_CELL_SIZE;       // Default cell size (meters)
+
+public:
+   PlayerIndex();
+   PlayerIndex(const double cellSize);
+
+   // Builds the index from the list of players (base::PairStream of Players),
+   // where 'time' is the executive time (sec) of the player positions
+   virtual void build(base::PairStream* const list, const double time);
+
+   const base::PairStream* getPlayers() const          { return plist; }    // Player list the index was built from
+   unsigned int getNumPlayers() const                  { return static_cast<unsigned int>(byOrder.size()); }
+   unsigned int getNumCells() const                    { return static_cast<unsigned int>(geoc.cells.size()); }
+   double getCellSize() const                          { return cellSize; } // Cell size (meters)
+   double getTimeStamp() const                         { return timeStamp; }// Executive time of the positions (sec)
+   double getMaxSpeed() const                          { return maxSpeed; } // Max speed of the indexed players (m/s)
+
+   // Max distance (meters) that any two of the indexed players could have
+   // closed between the time of the index and executive time 'time' (sec)
+   double getMaxClosure(const double time) const;
+
+   // Finds the players within 'range' meters of the position 'pos', which is
+   // geocentric (ECEF) or, if 'ecef' is false, gaming area (NED); the players
+   // are appended to 'list', in player list order, their positions in the
+   // player list (i.e., their PlayerStateTable slots) are appended to 'slots',
+   // and the number of players found is returned.
+   unsigned int findInRange(
+         const base::Vec3d& pos,
+         const double range,
+         const bool ecef,
+         std::vector<Player*>& list,
+         std::vector<unsigned int>& slots
+      ) const;
+
+   // Finds the players within 'angle' radians of the unit vector 'dir' from
+   // the position 'pos' (ECEF or, if 'ecef' is false, NED) and, if 'range' is
+   // greater than zero, within 'range' meters; the players and slots are
+   // appended as with findInRange(), and the number of players found is returned.
+   unsigned int findInCone(
+         const base::Vec3d& pos,
+         const base::Vec3d& dir,
+         const double angle,
+         const double range,
+         const bool ecef,
+         std::vector<Player*>& list,
+         std::vector<unsigned int>& slots
+      ) const;
+
+   // Appends to 'list', in player list order, the players of 'players' that
+   // could be within 'range' meters of the position 'pos' at executive time
+   // 'time' (sec), where 'pos' is geocentric (ECEF) or, if 'ecef' is false,
+   // gaming area (NED), as used by the caller's range check.  Uses 'index' if
+   // it was built from 'players' and 'range' is greater than zero, else it
+   // appends all of the players.  Their positions in 'players' are appended
+   // to 'slots'.  Returns the number of players appended.
+   static unsigned int findPlayers(
+         const PlayerIndex* const index,
+         base::PairStream* const players,
+         const base::Vec3d& pos,
+         const double range,
+         const bool ecef,
+         const double time,
+         std::vector<Player*>& list,
+         std::vector<unsigned int>& slots
+      );
+
+private:
+   struct Entry {
+      base::Vec3d pos;           // Position (ECEF or NED) (meters)
+      unsigned int order {};     // Position in the player list
+      unsigned long long key {}; // Cell key
+   };
+
+   struct Cell {
+      unsigned long long key {}; // Cell key
+      base::Vec3d center;        // Position of the cell's center (meters)
+      unsigned int first {};     // First entry
+      unsigned int n {};         // Number of entries
+   };
+
+   // Players binned by their ECEF or NED positions
+   struct Grid {
+      std::vector<Entry> entries;   // Indexed players, sorted by cell
+      std::vector<Cell> cells;      // Occupied cells, sorted by key
+   };
+
+   // Range and cone query parameters
+   struct Query {
+      base::Vec3d pos;           // Position of the query (ECEF or NED) (meters)
+      base::Vec3d dir;           // Cone axis (unit vector)
+      double range {};           // Range (meters) or zero for no range limit
+      double cosAngle {-1.0};    // Cosine of the cone's half angle
+      double angle {};           // Cone's half angle (radians)
+      bool cone {};              // Cone query
+   };
+
+   unsigned long long computeKey(const int ix, const int iy, const int iz) const;
+   int computeIndex(const double x) const;
+   void buildGrid(Grid& grid) const;
+   bool cellPasses(const Query& q, const Cell& cell) const;
+   bool entryPasses(const Query& q, const Entry& e) const;
+   unsigned int find(const Grid& grid, const Query& q, std::vector<Player*>& list, std::vector<unsigned int>& slots) const;
+
+   double cellSize {DEFAULT_CELL_SIZE};         // Cell size (meters)
+   double cellRadius {};                        // Radius of a cell's bounding sphere (meters)
+   double timeStamp {};                         // Executive time of the positions (sec)
+   double maxSpeed {};                          // Max speed of the indexed players (m/s)
+
+   std::vector<Player*> byOrder;                // Indexed players, in player list order (not ref()'d)
+   Grid geoc;                                   // Players by geocentric (ECEF) position
+   Grid ned;                                    // Players by gaming area (NED) position
+
+   base::safe_ptr<const base::PairStream> plist;   // Player list the index was built from
+};
+
+}
+}
+
+#endif
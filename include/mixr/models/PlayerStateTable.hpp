@@ -0,0 +1,150 @@
+
+#ifndef __mixr_models_PlayerStateTable_H__
+#define __mixr_models_PlayerStateTable_H__
+
+#include "mixr/base/Object.hpp"
+#include "mixr/base/safe_ptr.hpp"
+#include "mixr/base/osg/Vec3d"
+#include "mixr/base/osg/Matrixd"
+
+#include <utility>
+#include <vector>
+
+namespace mixr {
+namespace base { class PairStream; }
+namespace models {
+class Player;
+
+//------------------------------------------------------------------------------
+// Class: PlayerStateTable
+// Description: Snapshot of the players' kinematic states (positions,
+//              velocities, orientations, types, modes, etc.) stored as a
+//              structure of arrays, so loops over many players stream through
+//              a few contiguous arrays instead of each player's object.
+//
+//    Each player has a slot, which is its position in the player list that the
+//    table was built from; each of the table's columns is an array indexed by
+//    slot (see getColumn()).
+//
+//    The table is built once per frame by the WorldModel, at the end of the
+//    dynamics phase, and it's not changed after that, so any number of threads
+//    may read it.  The WorldModel replaces it with a new table each frame (see
+//    WorldModel::getPlayerStateTable()).
+//
+//    The table holds a reference to the player list it was built from, so its
+//    players remain valid for as long as the table is referenced.
+//
+// Factory name: PlayerStateTable
+//
+// Notes:
+//    1) The states are from the end of the last dynamics phase; they're the
+//       players' current states during the transmit, receive and process
+//       phases.
+//
+//    2) The world and rotational matrices are rotations only, so only their
+//       upper 3x3 elements are stored.
+//
+//    3) A player's slot changes when the player list changes; use findSlot()
+//       or check getPlayer(slot) before using a slot that was saved from an
+//       earlier frame.
+//------------------------------------------------------------------------------
+class PlayerStateTable : public base::Object
+{
+   DECLARE_SUBCLASS(PlayerStateTable, base::Object)
+
+public:
+   static const unsigned int INVALID_SLOT;
+
+   // Columns of doubles
+   enum Column : unsigned int {
+      GEOC_POS_X, GEOC_POS_Y, GEOC_POS_Z,    // Geocentric (ECEF) position (meters)
+      GEOC_VEL_X, GEOC_VEL_Y, GEOC_VEL_Z,    // Geocentric (ECEF) velocity (m/s)
+      POS_N, POS_E, POS_D,                   // Gaming area (NED) position (meters)
+      VEL_N, VEL_E, VEL_D,                   // Gaming area (NED) velocity (m/s)
+      LATITUDE, LONGITUDE, ALTITUDE,         // Latitude and longitude (degrees) and altitude HAE (meters)
+      WM_00, WM_01, WM_02,                   // World matrix (ECEF to NED), by row
+      WM_10, WM_11, WM_12,
+      WM_20, WM_21, WM_22,
+      RM_00, RM_01, RM_02,                   // Rotational matrix (NED to body), by row
+      RM_10, RM_11, RM_12,
+      RM_20, RM_21, RM_22,
+      NUM_COLUMNS
+   };
+
+   // State flags
+   enum Flags : unsigned int {
+      ACTIVE         = 0x01,                 // Player's mode is ACTIVE
+      LOCAL          = 0x02,                 // Local player (not networked)
+      POSITION_VALID = 0x04,                 // Gaming area (NED) position is valid
+      NET_OUTPUT     = 0x08                  // Network output is enabled
+   };
+
+public:
+   PlayerStateTable();
+
+   // Builds the table from the list of players (base::PairStream of Players),
+   // where 'time' is the executive time (sec) of the states
+   virtual void build(base::PairStream* const players, const double time);
+
+   const base::PairStream* getPlayers() const       { return plist; }     // Player list the table was built from
+   unsigned int getNumPlayers() const               { return n; }         // Number of players (slots)
+   double getTimeStamp() const                      { return timeStamp; } // Executive time of the states (sec)
+
+   // The player in slot 'slot'
+   Player* getPlayer(const unsigned int slot) const { return players[slot]; }
+
+   // Returns the slot of the player or INVALID_SLOT if it's not in the table
+   unsigned int findSlot(const Player* const player) const;
+
+   // A column (array of getNumPlayers() doubles indexed by slot)
+   const double* getColumn(const Column c) const    { return data.data() + c * n; }
+
+   // Integer columns
+   const unsigned int* getMajorTypes() const        { return majorTypes.data(); }
+   const unsigned int* getModes() const             { return modes.data(); }
+   const unsigned int* getSides() const             { return sides.data(); }
+   const unsigned int* getFlags() const             { return flags.data(); }
+   const int* getNetworkIDs() const                 { return networkIDs.data(); }
+
+   // Single player access
+   double get(const Column c, const unsigned int slot) const   { return data[c * n + slot]; }
+   bool isMajorType(const unsigned int slot, const unsigned int mask) const { return (majorTypes[slot] & mask) != 0; }
+   bool isActive(const unsigned int slot) const                { return (flags[slot] & ACTIVE) != 0; }
+   bool isLocalPlayer(const unsigned int slot) const           { return (flags[slot] & LOCAL) != 0; }
+   bool isNetworkedPlayer(const unsigned int slot) const       { return (flags[slot] & LOCAL) == 0; }
+   bool isPositionVectorValid(const unsigned int slot) const   { return (flags[slot] & POSITION_VALID) != 0; }
+   bool isNetOutputEnabled(const unsigned int slot) const      { return (flags[slot] & NET_OUTPUT) != 0; }
+   int getNetworkID(const unsigned int slot) const             { return networkIDs[slot]; }
+
+   base::Vec3d getGeocPosition(const unsigned int slot) const;
+   base::Vec3d getGeocVelocity(const unsigned int slot) const;
+   base::Vec3d getPosition(const unsigned int slot) const;
+   base::Vec3d getVelocity(const unsigned int slot) const;
+   base::Matrixd getWorldMat(const unsigned int slot) const;
+   base::Matrixd getRotMat(const unsigned int slot) const;
+
+private:
+   base::Vec3d getVec3(const Column c, const unsigned int slot) const;
+   base::Matrixd getMat3(const Column c, const unsigned int slot) const;
+   void setMat3(const Column c, const unsigned int slot, const base::Matrixd& m);
+
+   unsigned int n {};                           // Number of players
+   double timeStamp {};                         // Executive time of the states (sec)
+
+   std::vector<double> data;                    // Columns of doubles (NUM_COLUMNS by 'n')
+   std::vector<unsigned int> majorTypes;        // Player::MajorType
+   std::vector<unsigned int> modes;             // Player::Mode
+   std::vector<unsigned int> sides;             // Player::Side
+   std::vector<unsigned int> flags;             // Flags (bit-wise or'd)
+   std::vector<int> networkIDs;                 // Network IDs
+   std::vector<Player*> players;                // Players by slot (not ref()'d; held by the player list)
+
+   std::vector< std::pair<const Player*, unsigned int> > lookup;  // Slots sorted by player (for findSlot())
+
+   base::safe_ptr<const base::PairStream> plist;   // Player list the table was built from
+};
+
+}
+}
+
+#endif
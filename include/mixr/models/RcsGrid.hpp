@@ -0,0 +1,85 @@
+
+#ifndef __mixr_models_RcsGrid_H__
+#define __mixr_models_RcsGrid_H__
+
+#include "mixr/models/UniformGrid.hpp"
+
+#include "mixr/base/Object.hpp"
+#include "mixr/base/safe_ptr.hpp"
+
+namespace mixr {
+namespace base { class Table2; }
+namespace models {
+class SigAzEl;
+
+//------------------------------------------------------------------------------
+// Class: RcsGrid
+// Description: Az/el RCS signature (see SigAzEl) compiled into a dense,
+//              uniformly spaced grid of RCS values (meters squared), with
+//              bilinear lookups.
+//
+//    The signature's table is sampled over [ -PI, PI ] azimuth by
+//    [ -PI/2, PI/2 ] elevation angles of incidence, using the signature's
+//    order, units and decibel flags, so the grid's values are always in
+//    radians and meters squared (see UniformGrid).  The lookups are clamped
+//    to the grid.
+//
+//    The grid's nodes are exact; between them, the RCS is interpolated in
+//    meters squared.  build() samples the table halfway between the nodes
+//    to find the worst-case error (dB) of the grid; see getMaxError().
+//
+//    The grid isn't changed after it's built, so it can be shared between
+//    signatures (e.g., clones) and used by multiple threads.
+//
+// Factory name: RcsGrid
+//------------------------------------------------------------------------------
+class RcsGrid : public base::Object
+{
+   DECLARE_SUBCLASS(RcsGrid, base::Object)
+
+public:
+   RcsGrid();
+
+   // Builds the grid from the signature's table with a max node spacing of
+   // 'resolution' radians.  Returns false if the signature's table isn't
+   // valid, or the resolution isn't positive.
+   virtual bool build(const SigAzEl* const sig, const double resolution);
+
+   // True if the grid was built from this signature's table, flags and resolution
+   bool isBuiltFrom(const SigAzEl* const sig, const double resolution) const;
+
+   bool isValid() const                         { return !values.isEmpty(); }
+   double getResolution() const                 { return resolution; }    // Max node spacing (radians)
+   unsigned int getNumPoints() const            { return values.getNumPoints(); }
+
+   // Worst-case error (dB) found by build(), and where it was found (radians)
+   double getMaxError() const                   { return maxErr; }
+   double getMaxErrorAzimuth() const            { return maxErrAz; }
+   double getMaxErrorElevation() const          { return maxErrEl; }
+
+   // RCS (meters squared) at the azimuth and elevation angles of incidence (radians)
+   double getRCS(const double az, const double el) const;
+
+   // RCS (meters squared) of 'n' pairs of angles of incidence
+   void getRCS(const double* const az, const double* const el, double* const rcs, const unsigned int n) const;
+
+private:
+   void checkError(const SigAzEl* const sig, const double az, const double el);
+
+   UniformGrid values;              // RCS (meters squared); azimuth by elevation
+
+   base::safe_ptr<const base::Table2> table;  // Source table
+   bool swapOrder {};               // Source table's flags (see SigAzEl)
+   bool degrees {};
+   bool decibel {};
+   double resolution {};            // Max node spacing (radians)
+
+   double maxErr {};                // Worst-case error (dB)
+   double maxErrAz {};              // ... at this azimuth (radians)
+   double maxErrEl {};              // ... and this elevation (radians)
+};
+
+}
+}
+
+#endif
@@ -3,12 +3,14 @@
 #define __mixr_models_Signature_H__
 
 #include "mixr/base/Component.hpp"
+#include "mixr/base/safe_ptr.hpp"
 #include "mixr/base/util/constants.hpp"
 
 namespace mixr {
-namespace base { class Number; class Table2; }
+namespace base { class Angle; class Number; class Table2; }
 namespace models {
 class Emission;
+class RcsGrid;
 
 //------------------------------------------------------------------------------
 // Class: RfSignature
@@ -153,6 +155,9 @@ public:
 // Factory name: SigSwitch
 // Note:
 //  1) First pair (1:) is camouflage type 0, the second (2:) is camouflage type 1, etc.
+//
+//  2) The subcomponent signatures are reset with us, so their SigAzEl tables
+//     are compiled into their RCS grids (see SigAzEl's 'gridResolution').
 //------------------------------------------------------------------------------
 class SigSwitch : public RfSignature
 {
@@ -182,6 +187,9 @@ public:
 //    inDecibel  <base::Number>   ! True if the dependent data is in decibel meters
 //                                ! squared instead of the default meters squared (default: false)
 //
+//    gridResolution <base::Angle>  ! RCS grid's max node spacing; zero to look up the
+//                   <base::Number> ! table directly (default: 0) (Number: radians)
+//
 // Notes:
 //  1) Must provide a base::Table2 (2 dimensional) table, where ...
 //       -- Azimuth is the first independent variable (radians),
@@ -196,6 +204,12 @@ public:
 //
 //  4) If 'inDecibel' is set true then the dependent data is in decibel meters
 //     squared instead of the default meters squared
+//
+//  5) When 'gridResolution' is greater than zero, the table is compiled, on
+//     reset(), into an RcsGrid of meters squared over all azimuth and elevation
+//     angles of incidence, and getRCS() is a bilinear lookup in the grid instead
+//     of the table lookup, unit conversions and pow10.  The grid is shared with
+//     our clones, and its worst-case error is reported when MSG_INFO is enabled.
 //------------------------------------------------------------------------------
 class SigAzEl : public RfSignature
 {
@@ -215,20 +229,37 @@ public:
    bool isDecibel() const                       { return dbFlg; }
    virtual bool setDecibel(const bool);
 
+   double getGridResolution() const             { return gridRes; }     // radians
+   virtual bool setGridResolution(const double radians);
+   const RcsGrid* getGrid() const               { return grid; }        // (if built)
+
+   const base::Table2* getTable() const         { return tbl; }
+
+   // RCS (meters squared) from the table at the azimuth and elevation angles
+   // of incidence (radians)
+   double getTableRCS(const double az, const double el) const;
+
    double getRCS(const Emission* const em) override;
 
+   void reset() override;
+
 protected:
    const base::Table2* tbl {};      // The table
    bool swapOrderFlg {};            // Swap independent data order from az/el to el/az
    bool degFlg {};                  // independent data in degrees
    bool dbFlg {};                   // dependent data in decibels
 
+   double gridRes {};               // RCS grid's max node spacing (radians; zero if none)
+   base::safe_ptr<const RcsGrid> grid;  // Compiled table (shared with our clones)
+
 private:
    // slot table helper methods
    bool setSlotTable(const base::Table2* const);
    bool setSlotSwapOrder(const base::Number* const);
    bool setSlotInDegrees(const base::Number* const);
    bool setSlotDecibel(const base::Number* const);
+   bool setSlotGridResolution(const base::Angle* const);
+   bool setSlotGridResolution(const base::Number* const);
 };
 
 }
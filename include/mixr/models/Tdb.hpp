@@ -4,6 +4,9 @@
 
 #include "mixr/models/system/System.hpp"
 #include "mixr/base/osg/Vec3d"
+#include "mixr/base/osg/Matrixd"
+
+#include <vector>
 
 namespace mixr {
 namespace models {
@@ -48,6 +51,20 @@ class Player;
 //       must be completed before the LOS vectors, ranges, angles, etc. are
 //       computed and used).
 //
+// Target data arrays:
+//       All of the per-target arrays are carved from a single contiguous
+//       block of memory (structure of arrays), which is allocated when the
+//       size changes and kept otherwise, so a TDB can be reused from frame
+//       to frame; processPlayers() clears the previous target list.
+//
+//       computeBoresightData() gathers the targets' vectors into component
+//       arrays and runs its normalize and transform stages on whole arrays,
+//       four targets at a time with AVX2, when the CPU has it.
+//
+//       Both tasks read the targets' states from the world's player state
+//       table (see WorldModel::getPlayerStateTable()), when it's available,
+//       instead of from the target players.
+//
 // Gimbal coordinates:
 //       X+ is along the gimbal/sensor boresight
 //       Y+ is to the right of the gimbal boresight
@@ -81,6 +98,13 @@ public:
    // Number of active targets
    unsigned int getNumberOfTargets() const            { return numTgts; }
 
+   // Max number of targets (i.e., size of the target data arrays)
+   unsigned int getMaxTargets() const                 { return maxTargets; }
+
+   // Number of targets that passed all of the filters, but didn't fit
+   // in the target arrays (see Gimbal's 'maxPlayersOfInterest' slot)
+   unsigned int getNumberOfOverflows() const          { return numOverflows; }
+
    // The array of target pointer
    Player** getTargets()                              { return targets; }
 
@@ -123,6 +147,56 @@ public:
    // Compute elevation off boresight (radians)
    const double* getBoresightElevationErrors() const        { return aelr; }
 
+   //------------------------------------------------------------------------------
+   // computeBoresightData() kernels --- normalizeLos() and transformLos() use
+   // the AVX2 versions when they're available (see isAvx2LosAvailable()), and
+   // the scalar versions otherwise; both give the same results, bit-for-bit.
+   //------------------------------------------------------------------------------
+
+   // Normalizes the 'n' vectors [ x y z ], and computes their lengths ('rng')
+   // and the dot products of the normalized vectors with [ vx vy vz ] ('rdot')
+   static void normalizeLos(
+         const unsigned int n,
+         double* const x, double* const y, double* const z,
+         const double* const vx, const double* const vy, const double* const vz,
+         double* const rng, double* const rdot);
+
+   // Transforms the 'n' vectors [ x y z ] by the matrix 'm' (m * v) into
+   // [ tx ty tz ]; the input and output arrays must not overlap
+   static void transformLos(
+         const unsigned int n,
+         const base::Matrixd& m,
+         const double* const x, const double* const y, const double* const z,
+         double* const tx, double* const ty, double* const tz);
+
+   // True if the AVX2 kernels were built (GCC or Clang on x86) and the CPU
+   // supports them
+   static bool isAvx2LosAvailable();
+
+   static void normalizeLosScalar(
+         const unsigned int n,
+         double* const x, double* const y, double* const z,
+         const double* const vx, const double* const vy, const double* const vz,
+         double* const rng, double* const rdot);
+
+   static void normalizeLosAvx2(      // requires isAvx2LosAvailable()
+         const unsigned int n,
+         double* const x, double* const y, double* const z,
+         const double* const vx, const double* const vy, const double* const vz,
+         double* const rng, double* const rdot);
+
+   static void transformLosScalar(
+         const unsigned int n,
+         const base::Matrixd& m,
+         const double* const x, const double* const y, const double* const z,
+         double* const tx, double* const ty, double* const tz);
+
+   static void transformLosAvx2(      // requires isAvx2LosAvailable()
+         const unsigned int n,
+         const base::Matrixd& m,
+         const double* const x, const double* const y, const double* const z,
+         double* const tx, double* const ty, double* const tz);
+
 protected:
    // Sets our Gimbal
    virtual void setGimbal(const Gimbal* const gimbal); 
@@ -142,8 +216,10 @@ protected:
                                  //   local gaming area position is not valid
 
    Player**    targets {};       // Target pointer
+   unsigned int* targetSlots {}; // Target's slot in the world's player state table (see PlayerStateTable)
    unsigned int maxTargets {};   // Max number of targets (i.e., size of the arrays)
    unsigned int numTgts {};      // Number of targets
+   unsigned int numOverflows {}; // Number of targets that didn't fit in the arrays
 
    base::Vec3d* losG {};         // Normalized LOS vector (gimbal to target) in Gimbal coord 
    base::Vec3d* losO2T {};       // Ownship to target normalized LOS vector (ownship's NED)
@@ -161,6 +237,18 @@ protected:
    double* za {};
    double* ra2 {};
    double* ra {};
+   double* wx {};            // LOS vector components
+   double* wy {};
+   double* wz {};
+   double* vx {};            // Relative velocity components
+   double* vy {};
+   double* vz {};
+
+private:
+   unsigned char* block {};  // Memory block of all of the target data arrays
+
+   std::vector<Player*> candidateBuf;            // processPlayers()' candidate players (reused)
+   std::vector<unsigned int> candidateSlotBuf;   // ... and their player list positions
 };
 
 }
@@ -0,0 +1,78 @@
+
+#ifndef __mixr_models_UniformGrid_H__
+#define __mixr_models_UniformGrid_H__
+
+#include <vector>
+
+namespace mixr {
+namespace models {
+
+//------------------------------------------------------------------------------
+// Class: UniformGrid
+// Description: Dense, uniformly spaced 2D grid of values, with bilinear (or,
+//              along the first axis only, linear) lookups; used by the
+//              compiled gain pattern and RCS grids (see GainPatternGrid and
+//              RcsGrid).
+//
+//    Each axis spans [ lo, hi ] with the fewest nodes that are no more than
+//    'resolution' apart.  An axis with a single point (lo == hi) has that
+//    node twice, with a zero step, so that the lookups always have a cell;
+//    a 1D grid is a 2D grid with a single point second axis.  The lookups
+//    are clamped to the grid.
+//
+//    The values are stored with the first axis varying fastest; the owner
+//    fills them, using node() for the nodes' coordinates.
+//------------------------------------------------------------------------------
+class UniformGrid
+{
+public:
+   // Grid axis
+   struct Axis {
+      double lo {};                 // First node
+      double hi {};                 // Last node
+      double step {};               // Node spacing (zero for a single point)
+      double invStep {};            // 1 / step (zero for a single point)
+      unsigned int n {};            // Number of nodes (at least two)
+
+      void set(const double a, const double b, const double resolution);
+      double node(const unsigned int i) const    { return lo + i * step; }
+
+      // Cell index and fraction of 'x' (clamped to the axis)
+      void locate(const double x, unsigned int* const i, double* const t) const;
+   };
+
+public:
+   // Sets the axes, [ lo1 hi1 ] by [ lo2 hi2 ], with a max node spacing of
+   // 'resolution', and sizes the values (zeros)
+   void set(const double lo1, const double hi1, const double lo2, const double hi2, const double resolution);
+
+   // Removes the values
+   void clear();
+
+   bool isEmpty() const                         { return values.empty(); }
+   unsigned int getNumPoints() const            { return static_cast<unsigned int>(values.size()); }
+   long getNumBytes() const                     { return static_cast<long>(sizeof(double) * values.size()); }
+
+   const Axis& getAxis1() const                 { return ax1; }
+   const Axis& getAxis2() const                 { return ax2; }
+
+   // Value at node [ i j ]
+   double& value(const unsigned int i, const unsigned int j)         { return values[j * ax1.n + i]; }
+   double value(const unsigned int i, const unsigned int j) const    { return values[j * ax1.n + i]; }
+
+   // Linear lookup along the first axis, at the second axis' first node
+   double lookup(const double x) const;
+
+   // Bilinear lookup
+   double lookup(const double x, const double y) const;
+
+private:
+   Axis ax1;                        // First axis (varies fastest)
+   Axis ax2;                        // Second axis
+   std::vector<double> values;      // Values at the nodes
+};
+
+}
+}
+
+#endif
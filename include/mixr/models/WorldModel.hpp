@@ -3,11 +3,16 @@
 #define __mixr_models_WorldModel_H__
 
 #include "mixr/simulation/Simulation.hpp"
+#include "mixr/base/safe_ptr.hpp"
 
 namespace mixr {
-namespace terrain { class Terrain; }
+namespace terrain { class LosCache; class Terrain; class Viewshed; }
 namespace models {
 class AbstractAtmosphere;
+class ElevationBatch;
+class JammingModel;
+class PlayerIndex;
+class PlayerStateTable;
 
 //------------------------------------------------------------------------------
 // Class: WorldModel
@@ -43,6 +48,22 @@ class AbstractAtmosphere;
 //    terrain        <terrain:Terrain>        ! Terrain elevation database (default: nullptr)
 //    atmosphere     <Atmosphere>             ! Atmosphere
 //
+//    playerIndexCellSize <base::Distance>    ! Cell size of the player index, or zero to disable the index
+//                                            ! (default: PlayerIndex::DEFAULT_CELL_SIZE)
+//
+//    terrainLosCache <terrain::LosCache>     ! Terrain line-of-sight cache shared by the players' sensors
+//                                            ! (default: nullptr -- no cache)
+//
+//    terrainViewshed <terrain::Viewshed>     ! Viewshed parameters of the stationary players
+//                                            ! (default: nullptr -- no viewsheds)
+//
+//    terrainElevationBatch <base::Number>    ! If true, the players' terrain elevations are looked up
+//                                            ! together, as a batch, by the background threads
+//                                            ! (default: true)
+//
+//    jammingModel   <JammingModel>           ! Aggregated noise jamming model of the players' radars
+//                                            ! (default: nullptr -- jammers send noise emissions)
+//
 
 // Gaming area reference point:
 //
@@ -73,6 +94,46 @@ class AbstractAtmosphere;
 //    Current simulation environments include terrain elevation posts, getTerrain(),
 //    and atmosphere model, getAtmosphere().
 //
+//    Each frame, the players' positions are passed to the terrain's prefetch()
+//    hint, so a streaming terrain database (e.g., terrain::TileManager) can
+//    load the terrain around the players.
+//
+//    The terrain occulting checks of the players' sensors (see Tdb) can share
+//    the optional terrain line-of-sight cache, getTerrainLosCache(), which is
+//    cleared on reset (see terrain::LosCache).
+//
+//    Stationary players (see Player::isStationary()) precompute their terrain
+//    horizons using copies of the optional viewshed, getTerrainViewshed(), and
+//    their sensors check the targets against these horizons instead of the
+//    terrain (see terrain::Viewshed).
+//
+//    Each background frame, before the players are updated, the players' terrain
+//    elevations are looked up as a batch (see ElevationBatch), sorted by terrain
+//    tile and cell, and split between the background threads, instead of by
+//    each player's updateElevation(); see isTerrainElevationBatched().
+//
+// Player index:
+//
+//    At the end of each frame's dynamics phase, and on reset, a spatial index of
+//    the players is built (see PlayerIndex) for the range and cone queries of
+//    the players' systems.  Use getPlayerIndex() to get the current index; a new
+//    index is built each frame, so hold the returned index for the duration of
+//    the queries only.
+//
+// Jamming model:
+//
+//    With the optional jamming model, getJammingModel(), the players' noise
+//    jammers register with the model instead of sending their noise emissions,
+//    the model bins the jammers at the end of each frame's transmit phase, and
+//    each radar gets its summed noise jamming signal with a single query (see
+//    JammingModel).
+//
+// Player state table:
+//
+//    Likewise, a snapshot of the players' kinematic states is built (see
+//    PlayerStateTable) for loops over many players; use getPlayerStateTable()
+//    to get the current table.
+//
 // Shutdown:
 //
 //    At shutdown, the parent object must send a SHUTDOWN_EVENT event to
@@ -105,12 +166,20 @@ public:
 
     bool isGamingAreaUsingEarthModel() const;      // Gaming area using the earth model?
 
+    const PlayerIndex* getPlayerIndex() const;     // Returns the player index; pre-ref()'d (or nullptr if disabled)
+    double getPlayerIndexCellSize() const;         // Player index cell size (meters) or zero if disabled
+    const PlayerStateTable* getPlayerStateTable() const; // Returns the player state table; pre-ref()'d (or nullptr)
+
 
 
     // environmental interface
     const terrain::Terrain* getTerrain() const;            // returns the terrain elevation database
+    terrain::LosCache* getTerrainLosCache() const;         // returns the terrain line-of-sight cache (or nullptr)
+    const terrain::Viewshed* getTerrainViewshed() const;   // returns the stationary players' viewshed parameters (or nullptr)
+    bool isTerrainElevationBatched() const;                // true if the players' terrain elevations are batched
     AbstractAtmosphere* getAtmosphere();                   // returns the atmosphere model
     const AbstractAtmosphere* getAtmosphere() const;       // returns the atmosphere model (const version)
+    JammingModel* getJammingModel() const;                 // returns the aggregated jamming model (or nullptr)
 
     void reset() override;
 
@@ -121,6 +190,16 @@ protected:
     virtual bool setRefLatitude(const double v);      // Sets Ref latitude
     virtual bool setRefLongitude(const double v);     // Sets Ref longitude
     virtual bool setMaxRefRange(const double v);      // Sets the max range (meters) of the gaming area or zero if there's no limit.
+    virtual bool setPlayerIndexCellSize(const double v); // Sets the player index cell size (meters) or zero to disable
+    virtual bool setTerrainElevationBatch(const bool flg);  // Sets the batched terrain elevations flag
+
+    virtual void updatePlayerIndex(base::PairStream* const playerList);   // Builds a new player index
+    virtual void updatePlayerStateTable(base::PairStream* const playerList); // Builds a new player state table
+    virtual void prefetchTerrain();                                         // Hints the terrain with the players' positions
+
+    void phaseCompleted(base::PairStream* const playerList, const unsigned int p) override;
+    bool bgBatchStarted(base::PairStream* const playerList, const double dt) override;
+    void updateBgBatch(const unsigned int idx, const unsigned int n) override;
 
    // environmental interface
     terrain::Terrain* getTerrain();                        // returns the terrain elevation database
@@ -146,6 +225,15 @@ private:
 
    AbstractAtmosphere* atmosphere {};
    terrain::Terrain* terrain {};
+   terrain::LosCache* losCache {};
+   terrain::Viewshed* viewshed {};
+   JammingModel* jammingModel {};
+
+   base::safe_ptr<PlayerIndex> playerIndex;   // Player index (rebuilt each frame)
+   double playerIndexCellSize {};             // Player index cell size (meters) or zero if disabled
+   base::safe_ptr<PlayerStateTable> playerStates;   // Player state table (rebuilt each frame)
+   base::safe_ptr<ElevationBatch> elevationBatch;   // Players' terrain elevation queries (rebuilt each frame)
+   bool batchElevations {true};                     // Batch the players' terrain elevations
 
 private:
    // slot table helper methods
@@ -162,6 +250,12 @@ private:
    // environmental interface
    bool setSlotTerrain(terrain::Terrain* const);
    bool setSlotAtmosphere(AbstractAtmosphere* const);
+   bool setSlotTerrainLosCache(terrain::LosCache* const);
+   bool setSlotTerrainViewshed(terrain::Viewshed* const);
+   bool setSlotJammingModel(JammingModel* const);
+
+   bool setSlotPlayerIndexCellSize(const base::Distance* const);
+   bool setSlotTerrainElevationBatch(const base::Number* const);
 };
 
 }
@@ -4,6 +4,8 @@
 
 #include "mixr/models/environment/IrAtmosphere.hpp"
 
+#include <vector>
+
 namespace mixr {
 namespace base { class Number; class Table1; class Table2; class Table3;
                  class Table4; class Number; }
@@ -86,6 +88,16 @@ class IrQueryMsg;
 //
 // Notes:
 //    1) The first index of each table represents the center frequency of the bins
+//
+//    2) On reset(), each table is interpolated at the center of each of the
+//       wave bands, at the table's own breakpoints of its other variables, and
+//       these per band slices are then used by calculateAtmosphereContribution():
+//       the breakpoints of the query's altitudes, range and viewing angle are
+//       found once, and each wave band is a single interpolation within its
+//       slices (3-D transmissivity, 2-D background and 1-D solar radiation).
+//       Linear interpolation is separable, so the results are the same as the
+//       table lookups, including the tables' limits and extrapolation.  Until
+//       the slices are built (or if the wave bands change), the tables are used.
 //------------------------------------------------------------------------------
 class IrAtmosphere1 : public IrAtmosphere
 {
@@ -93,8 +105,11 @@ class IrAtmosphere1 : public IrAtmosphere
 
 public:
    IrAtmosphere1();
+
    bool calculateAtmosphereContribution(IrQueryMsg* const msg, double* totalSignal, double* totalBackground) override;
 
+   void reset() override;
+
 protected:
 
    double getTransmissivity(
@@ -142,10 +157,36 @@ protected:
    ) const;
 
 private:
+   // Breakpoints and weight of a value along one table axis, with the same
+   // limits and extrapolation as the table's lfi(): a[i1] + m * (a[i2] - a[i1])
+   struct Breakpoint {
+      unsigned int i1 {};
+      unsigned int i2 {};
+      double m {};
+   };
+   static Breakpoint locate(const double v, const double* const data, const unsigned int n, const bool eFlg);
+
+   // Interpolation within a band's slice of 1, 2 or 3 axes ('y' varies fastest)
+   static double interpolate(const double* const a, const Breakpoint& y);
+   static double interpolate(const double* const a, const unsigned int ny, const Breakpoint& y, const Breakpoint& z);
+   static double interpolate(const double* const a, const unsigned int ny, const unsigned int nz,
+                             const Breakpoint& y, const Breakpoint& z, const Breakpoint& w);
+
+   void buildSlices();
+   void clearSlices();
+   bool isSliced() const;
+
    const base::Table2* solarRadiationTable {};
    const base::Table3* backgroundRadiationTable {};
    const base::Table4* transmissivityTable {};
 
+   // Tables interpolated at the wave band centers (empty if no table)
+   std::vector<double> slicedCenters;     // Wave band centers sliced (microns)
+   std::vector<double> slicedWidths;      // Wave band widths sliced (microns)
+   std::vector<double> transSlices;       // [ band ][ range ][ target alt ][ seeker alt ]
+   std::vector<double> bgSlices;          // [ band ][ view angle ][ seeker alt ]
+   std::vector<double> solarSlices;       // [ band ][ target alt ]
+
 private:
    // slot table helper methods
    bool setSlotSolarRadiationTable(const base::Table2* const);
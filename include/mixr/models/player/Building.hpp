@@ -20,6 +20,7 @@ public:
     Building();
 
     unsigned int getMajorType() const override;
+    bool isStationary() const override;
 };
 
 }
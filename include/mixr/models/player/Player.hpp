@@ -20,6 +20,7 @@ namespace mixr {
 namespace base { class Vec2d;    class Vec3d;  class Angle; class Boolean;
                  class Distance; class LatLon; class List;  class Time; }
 namespace simulation { class AbstractNib; }
+namespace terrain { class Viewshed; }
 namespace models {
 class WorldModel;
 
@@ -347,6 +348,16 @@ class Track;
 //             on-board computers and track managers.
 //
 //
+// Viewshed:
+//
+//    Stationary players, isStationary(), compute a terrain viewshed at their
+//    position using the simulation's viewshed parameters, if any (see
+//    WorldModel's 'terrainViewshed' slot).  It's computed by the first update
+//    after reset, and again after the player stops at a new position; it's
+//    cleared while the player is moving.  Our sensors check the targets'
+//    terrain occulting using our viewshed, getViewshed() (see Tdb).
+//
+//
 // Shutdown event:
 //
 //    At shutdown, the parent object (e.g., the simulation) must send a SHUTDOWN_EVENT
@@ -487,6 +498,9 @@ public:
    virtual double getTerrainElevationM() const;                     // Terrain elevation at player (meters)
    virtual double getTerrainElevationFt() const;                    // Terrain elevation at player (feet)
 
+   virtual bool isStationary() const;                               // True if the player isn't moving (e.g., ground sites)
+   const terrain::Viewshed* getViewshed() const;                    // Terrain viewshed at our position; pre-ref()'d (or nullptr)
+
    virtual double getTotalVelocity() const;                         // Total velocity (meters/second)
    virtual double getTotalVelocityFPS() const;                      // Total velocity (feet/second)
    virtual double getTotalVelocityKts() const;                      // Total velocity (knots)
@@ -868,6 +882,13 @@ public:
    // ---
    virtual void processDetonation(const double detRange, AbstractWeapon* const wpn = nullptr);
 
+   // ---
+   // Pass an R/F emission that has hit us to our antennas and to the players
+   // requesting our reflected emissions (used by onRfEmissionEventPlayer() and
+   // by the Antenna's batched interactions)
+   // ---
+   virtual void passRfEmission(Emission* const);
+
    // ---
    // Event handler(s)
    // ---
@@ -910,6 +931,9 @@ protected:
    // Update terrain elevation at our location
    virtual void updateElevation();
 
+   // Update our terrain viewshed (stationary players only)
+   virtual void updateViewshed();
+
    bool shutdownNotification() override;
    void printTimingStats() override;
 
@@ -999,6 +1023,7 @@ private:
    bool   tElevReq {};      // Height-Of-Terrain is required from the IG system (default: terrain height isn't required)
    bool   interpTrrn {};    // interpolate between terrain elevation posts (local terrain database only)
    double tOffset {};       // Offset from the terrain to the player's CG for ground clamping
+   base::safe_ptr<terrain::Viewshed> viewshed;  // Terrain viewshed at our position (stationary players)
    bool   posVecValid {};   // Local position vector valid
    bool   altSlaved {};     // Player's altitude is slaved to the dynamics software (default: false)
    bool   posSlaved {};     // Player's position is slaved to the dynamics software (default: false)
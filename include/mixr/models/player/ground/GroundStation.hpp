@@ -17,6 +17,8 @@ class GroundStation : public GroundVehicle
 
 public:
    GroundStation();
+
+   bool isStationary() const override;
 };
 
 }
@@ -35,6 +35,8 @@ public:
 
    virtual bool isLauncherReady() const;              // Return true if launcher is ready to fire.
 
+   bool isStationary() const override;                // True if we've stopped (e.g., set up at a site)
+
    // Set functions
    virtual bool setMaxLaunchRange(const double rng);
    virtual bool setMinLaunchRange(const double rng);
@@ -4,13 +4,16 @@
 
 #include "mixr/models/system/ScanGimbal.hpp"
 
-#include "mixr/base/safe_queue.hpp"
-#include "mixr/base/safe_stack.hpp"
+#include "mixr/base/safe_ptr.hpp"
+#include "mixr/base/osg/Vec4d"
 #include "mixr/base/util/constants.hpp"
 
+#include <vector>
+
 namespace mixr {
-namespace base { class Angle; class Function; class Power; }
+namespace base { class Angle; class Function; class Func1; class Func2; class Power; }
 namespace models {
+class GainPatternGrid;
 class Player;
 class RfSystem;
 
@@ -40,6 +43,12 @@ class RfSystem;
 //      beamWidth       <base::Angle>           ! Beam Width  (must be greater than zero) (default: 3.5 degrees)
 //                      <base::Number>          ! Beam width in radians
 //
+//      gainPatternResolution <base::Angle>     ! Gain pattern grid's max node spacing; zero to evaluate
+//                            <base::Number>    ! the gain pattern directly (default: 0)
+//                                              ! (Number: radians)
+//
+//      batchInteractions <base::Boolean>       ! Batched R/F interactions with the targets (default: false)
+//
 //
 // Note
 //    1) Other defaults:
@@ -48,7 +57,41 @@ class RfSystem;
 //
 //    2) When the Emission 'recycle' flag is enabled (default behavior), the
 //       system will try to reuse Emission objects, which removes the overhead
-//       of creating and deleting them.
+//       of creating and deleting them.  The sent emissions are held on an
+//       'in-use' list; process() moves the ones that the receivers have
+//       released (i.e., we hold the only reference) to the 'free' list, which
+//       is kept to the peak number of emissions in use.  Both lists are used
+//       only by our ownship's thread (transmit and process phases), so they
+//       don't need locks.
+//
+//    3) When 'gainPatternResolution' is greater than zero, the gain pattern
+//       is compiled, on reset(), into a GainPatternGrid of linear gains, and
+//       rfTransmit() and onRfEmissionEvent() use the grid's lookups instead of
+//       evaluating the pattern and converting from dB for each target.  The
+//       grid's worst-case error is reported when MSG_INFO is enabled.
+//       Setting the gain pattern, its units or the resolution discards the
+//       grid; the pattern is evaluated directly until the next reset().
+//
+//    4) When 'batchInteractions' is enabled, rfTransmit() does the targets'
+//       side of the R/F interactions itself, instead of sending each target
+//       an RF_EMISSION event that sends back an RF_EMISSION_RETURN event: it
+//       computes the angles of incidence of all of the targets, looks up
+//       their RCS, passes the emissions to the targets' antennas (see
+//       Player::passRfEmission()), and then passes all of the returns to our
+//       system at once (see RfSystem::rfReceivedEmissions()).  The results
+//       are the same as the event path, as long as the targets' players and
+//       our antenna don't override their R/F emission event handlers.
+//
+//       The order differs: on the event path, a target sends its return
+//       before it passes the emission to its own antennas and reflections
+//       (see Player::onRfEmissionEventPlayer()), while in batch mode all of
+//       the returns reach our system after the last target's
+//       passRfEmission().  So any emissions that the targets' antennas or
+//       reflections send to our system during passRfEmission() (e.g., a
+//       reflection back to us) are queued ahead of our returns, instead of
+//       after them.  The returns themselves are queued in the same (target)
+//       order.  The test/rf_batch_interactions regression test compares the
+//       radars' report queues of the two paths.
 //
 //------------------------------------------------------------------------------
 class Antenna : public ScanGimbal
@@ -70,6 +113,13 @@ public:
    // System limits
    int getMaxEmissions() const                    { return MAX_EMISSIONS; }
 
+   // Emission pool statistics
+   unsigned int getNumFreeEmissions() const       { return static_cast<unsigned int>(freeEmissions.size()); }
+   unsigned int getNumInUseEmissions() const      { return static_cast<unsigned int>(inUseEmissions.size()); }
+   unsigned int getEmissionPoolPeak() const       { return emPoolPeak; }    // Peak number of emissions in use
+   unsigned long getEmissionPoolMisses() const    { return emPoolMisses; }  // Free list was empty while recycling
+   unsigned long getEmissionsCloned() const       { return emClones; }      // Emissions cloned from the template
+
    // Antenna polarization matching gain
    double getPolarizationGain(const Polarization p1) const;
    Polarization getPolarization() const           { return polar; }
@@ -80,6 +130,12 @@ public:
    // Gain pattern
    const base::Function* gainPatternTable() const { return gainPattern; }
    bool isGainPatternDegrees() const              { return gainPatternDeg; }
+   double getGainPatternResolution() const        { return gainPatternRes; }   // radians
+   const GainPatternGrid* getGainPatternGrid() const { return gainGrid; }       // (if built)
+
+   // Gain pattern's gain (linear) in the direction of the NED line-of-sight
+   // unit vector 'los' from our ownship (1.0 if there's no gain pattern)
+   virtual double getPatternGain(const base::Vec3d& los) const;
 
    // Antenna threshold (watts)
    double getTransmitThreshold() const            { return threshold; }
@@ -95,21 +151,29 @@ public:
    // Beam width (radians)
    double getBeamWidth() const                    { return beamWidth; }
 
+   // Batched R/F interactions flag (see note 4)
+   bool isBatchInteractionsEnabled() const        { return batch; }
+
    // Member functions
    virtual bool setPolarization(const Polarization p) { polar = p; return true; }
    virtual bool setThreshold(const double th);
    virtual bool setGain(const double g);
    virtual bool setEmissionRecycleFlag(const bool enable);
    virtual bool setBeamWidth(const double radians);
+   virtual bool setGainPatternResolution(const double radians);
+   virtual bool setBatchInteractionsFlag(const bool enable);
 
    virtual bool setPolarization(base::String* const v);
    virtual bool setThreshold(base::Power* const p);
    virtual bool setGain(const base::Number* const g);
-   virtual bool setGainPattern(base::Function* const func);
+   virtual bool setGainPattern(const base::Function* const func);
    virtual bool setGainPatternDeg(const base::Number* const g);
    virtual bool setRecycleFlg(const base::Number* const);
    virtual bool setBeamWidth(const base::Angle* const msg);
    virtual bool setBeamWidth(const base::Number* const msg);
+   virtual bool setGainPatternResolution(const base::Angle* const msg);
+   virtual bool setGainPatternResolution(const base::Number* const msg);
+   virtual bool setBatchInteractionsFlag(const base::Number* const msg);
 
    // Event handler(s)
    virtual bool onRfEmissionReturnEventAntenna(Emission* const);
@@ -129,21 +193,27 @@ protected:
 
    bool shutdownNotification() override;
 
-   base::safe_stack<Emission*> freeEmStack {MAX_EMISSIONS};  // Free emission stack
-   mutable long freeEmLock {};                               // Semaphore to protect 'freeEmStack'
-
-   base::safe_queue<Emission*> inUseEmQueue {MAX_EMISSIONS}; // In use emission queue
-   mutable long inUseEmLock {};                              // Semaphore to protect 'inUseEmQueue'
+   std::vector<Emission*> freeEmissions;    // Free emissions (ref()'d)
+   std::vector<Emission*> inUseEmissions;   // Sent emissions (ref()'d)
 
 private:
-   static const int MAX_EMISSIONS{10000};   // Max size of emission queues and arrays
+   static const int MAX_EMISSIONS{10000};   // Max number of emissions in the free and in-use lists
+
+   unsigned int emPoolPeak {};      // Peak number of emissions in use
+   unsigned long emPoolMisses {};   // Number of times the free list was empty while recycling
+   unsigned long emClones {};       // Number of emissions cloned
 
    RfSystem* sys {};                // Assigned R/F system (e.g., sensor, radio)
 
    // Antenna parameters
    Polarization polar {NONE};       // Polarization                 (enum)
    double gain {1.0};               // Gain                         (no units)
-   base::Function* gainPattern {};  // Gain pattern                 (Function)
+   const base::Function* gainPattern {};  // Gain pattern (shared with our clones)
+   const base::Func1* gainFunc1 {}; // Gain pattern as a 1D function (or zero)
+   const base::Func2* gainFunc2 {}; // Gain pattern as a 2D function (or zero)
+
+   double gainPatternRes {};        // Gain pattern grid's max node spacing (radians; zero if none)
+   base::safe_ptr<const GainPatternGrid> gainGrid;  // Compiled gain pattern (shared with our clones)
 
    double threshold {};             // Antenna threshold; don't send emission if
                                     // power is below this threshold (watts)
@@ -154,16 +224,35 @@ private:
 
    bool recycle {true};             // Recycle emissions flag
 
+   bool batch {};                   // Batched R/F interactions flag
+
+   // rfTransmit() per-target work arrays; grown as needed to the
+   // number of targets (players of interest), and reused.
+   std::vector<double> gainTgtBuf;  // Gain to target
+   std::vector<double> gainTgt0Buf; // Gain to target (dB/10)
+   std::vector<double> aeGainBuf;   // Antenna effective gain
+   std::vector<double> erpBuf;      // Effective radiated power (watts)
+
+   // Batched interactions' work arrays (see note 4)
+   std::vector<base::Vec4d> aoiBuf; // Angle of incidence vectors (target's body coordinates)
+   std::vector<double> aoiAzBuf;    // Azimuth angles of incidence (radians)
+   std::vector<double> aoiElBuf;    // Elevation angles of incidence (radians)
+   std::vector<Emission*> retEmBuf; // Returned emissions (ref()'d)
+   std::vector<double> retGainBuf;  // Returned emissions' antenna effective areas (m^2)
+
 private:
    // slot table helper methods
    bool setSlotPolarization(base::String* const x)                  { return setPolarization(x);   }
    bool setSlotThreshold(base::Power* const x)                      { return setThreshold(x);      }
    bool setSlotGain(const base::Number* const x)                    { return setGain(x);           }
-   bool setSlotGainPattern(base::Function* const x)                 { return setGainPattern(x);    }
+   bool setSlotGainPattern(const base::Function* const x)           { return setGainPattern(x);    }
    bool setSlotGainPatternDeg(const base::Number* const x)          { return setGainPatternDeg(x); }
    bool setSlotRecycleFlg(const base::Number* const x)              { return setRecycleFlg(x);     }
    bool setSlotBeamWidth(const base::Angle* const x)                { return setBeamWidth(x);      }
    bool setSlotBeamWidth(const base::Number* const x)               { return setBeamWidth(x);      }
+   bool setSlotGainPatternResolution(const base::Angle* const x)    { return setGainPatternResolution(x); }
+   bool setSlotGainPatternResolution(const base::Number* const x)   { return setGainPatternResolution(x); }
+   bool setSlotBatchInteractions(const base::Number* const x)       { return setBatchInteractionsFlag(x); }
 };
 
 }
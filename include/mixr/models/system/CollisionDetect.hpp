@@ -6,6 +6,8 @@
 #include "mixr/config.hpp"
 #include "mixr/base/units/distance_utils.hpp"
 
+#include <vector>
+
 namespace mixr {
 namespace base { class Angle; class Distance; class Number; class PairStream; }
 namespace models {
@@ -121,6 +123,9 @@ private:
    PlayerOfInterest* players {};       // Player of interest (POI) list
    unsigned int maxPlayers {};         // Max number of players of interest
 
+   std::vector<Player*> candidateBuf;            // updateData()'s candidate players (reused)
+   std::vector<unsigned int> candidateSlotBuf;   // ... and their player list positions
+
 private:
    // slot table helper methods
    bool setSlotCollisionRange(const base::Distance* const);
@@ -47,6 +47,12 @@ class Tdb;
 //             Vg is a vector in gimbal coordinates
 //             Vb is a vector in body coordinates
 //
+//    5) The target data block (TDB) is double buffered: processPlayersOfInterest()
+//    fills our spare TDB and swaps it with the current one, which becomes the
+//    spare.  The spare is reused only if no one else still references it (see
+//    getCurrentTDB()), otherwise a new TDB is created, so readers of the
+//    current TDB are never disturbed.
+//
 //
 //
 //
@@ -140,9 +146,6 @@ public:
       ROLL_IDX   // Roll index
    };
 
-   // Max number of players of interest
-   enum { MAX_PLAYERS = MIXR_CONFIG_MAX_PLAYERS_OF_INTEREST };
-
 public:  // Public section
    Gimbal();
 
@@ -213,6 +216,7 @@ public:  // Public section
    double getMaxAngle2PlayersOfInterest() const { return maxAnglePlayers; } // Max angle of gimbal boresight to players of interest or zero for all (rad)
    unsigned int getPlayerOfInterestTypes() const { return playerTypes; }    // Player of interest types (Player::MajorType bit-wise or'd)
    unsigned int getMaxPlayersOfInterest() const  { return maxPlayers; }     // Max number of players of interest (i.e., size of the arrays)
+   unsigned int getPlayersOfInterestOverflows() const { return poiOverflows; } // Number of players of interest that didn't fit in the arrays (since reset)
    bool isLocalPlayersOfInterestOnly() const { return localOnly; }          // Local only players of interest flag
    bool isTerrainOccultingEnabled() const  { return terrainOcculting; }     // Terrain occulting enabled flag
    bool isHorizonCheckEnabled() const      { return checkHorizon; }         // Horizon masking enable flag
@@ -319,6 +323,7 @@ private:
    double    maxAnglePlayers {};       // Max angle of gimbal boresight for players of interest (or zero for all) (rad)
    unsigned int playerTypes {0xFFFF};  // Player of interest type mask (default: all players)
    unsigned int maxPlayers {200};      // Max number of players of interest (i.e., size of the arrays)
+   unsigned int poiOverflows {};       // Number of players of interest that didn't fit in the arrays
    bool     localOnly {};              // Local players of interest only
    bool     terrainOcculting {};       // Target terrain occulting enabled flag
    bool     checkHorizon {true};       // Horizon masking check enabled flag
@@ -326,6 +331,7 @@ private:
    bool     ownHeadingOnly {true};     // Whether only the ownship heading is used by the target data block
 
    base::safe_ptr<Tdb> tdb;  // Current Target Data Block
+   Tdb* spareTdb {};         // Spare Target Data Block (previous TDB, for reuse)
 
 private:
    // slot table helper methods
@@ -13,6 +13,9 @@ namespace models {
 // Factory name: Jammer
 //
 // Default R/F sensor type ID is "JAMMER"
+//
+// When the world model has a jamming model (see JammingModel), the jammer
+// registers with the model instead of sending its noise emissions.
 //------------------------------------------------------------------------------
 class Jammer : public RfSensor
 {
@@ -6,7 +6,7 @@
 #include "mixr/base/safe_queue.hpp"
 
 #include <cmath>
-#include <array>
+#include <vector>
 
 namespace mixr {
 namespace models {
@@ -19,8 +19,10 @@ namespace models {
 //
 // Factory name: Radar
 // Slots:
-//    igain    <base::Number>     ! Integrator gain (no units; default: 1.0f)
-//             <base::Decibel>    ! Integrator gain (dB)
+//    igain       <base::Number>     ! Integrator gain (no units; default: 1.0f)
+//                <base::Decibel>    ! Integrator gain (dB)
+//
+//    maxReports  <base::Number>     ! Max number of reports per scan (default: DEFAULT_MAX_REPORTS)
 //
 //------------------------------------------------------------------------------
 class Radar : public RfSensor
@@ -28,8 +30,8 @@ class Radar : public RfSensor
    DECLARE_SUBCLASS(Radar, RfSensor)
 
 public:
-   // Max number of reports (per scan)
-   static const unsigned int MAX_REPORTS{MIXR_CONFIG_MAX_REPORTS};
+   // Default max number of reports (per scan)
+   static const unsigned int DEFAULT_MAX_REPORTS{MIXR_CONFIG_MAX_REPORTS};
 
    static const unsigned int NUM_SWEEPS{121};          // Number of sweeps in Real-Beam display
    static const unsigned int PTRS_PER_SWEEP{128};      // Number of points per sweep in RB display
@@ -42,9 +44,13 @@ public:
    unsigned int getNumSweeps() const                      { return NUM_SWEEPS; }
    unsigned int getPtrsPerSweep() const                   { return PTRS_PER_SWEEP; }
 
-   unsigned int getMaxReports() const                     { return MAX_REPORTS; }
+   unsigned int getMaxReports() const                     { return maxRpts; }
    unsigned int getNumReports() const                     { return numReports; }
 
+   // Number of new reports dropped, since the last reset(), because
+   // the report table was full
+   unsigned int getNumReportOverflows() const             { return numRptOverflows; }
+
    // Returns the number of emission reports, up to 'max', that are loaded into the 'list'
    // Emission pointers are pre-ref()'d, so unref() when finished.
    unsigned int getReports(const Emission** list, const unsigned int max) const;
@@ -63,6 +69,9 @@ public:
    // Sets integration gain
    virtual bool setIGain(const double);
 
+   // Sets the max number of reports (per scan)
+   virtual bool setMaxReports(const unsigned int);
+
    bool killedNotification(Player* const killedBy = 0) override;
 
    void updateData(const double dt = 0.0) override;
@@ -87,9 +96,11 @@ protected: // (#temporary#) allow subclasses to access and use report queue
    base::safe_queue<double> rptSnQueue {MAX_EMISSIONS};     // Reporting Signal/Nose queue  (dB)
 
    // Reports
-   std::array<Emission*, MAX_REPORTS> reports {};  // Best emission for this report
-   std::array<double, MAX_REPORTS> rptMaxSn {};    // Signal/Nose value (dB)
+   std::vector<Emission*> reports;                 // Best emission for this report (sized to maxRpts)
+   std::vector<double> rptMaxSn;                   // Signal/Nose value (dB)
    unsigned int numReports {};                     // Number of reports this sweep
+   unsigned int maxRpts {DEFAULT_MAX_REPORTS};     // Max number of reports per scan
+   unsigned int numRptOverflows {};                // Number of reports dropped (report table full)
 
 private:
    void clearTracksAndQueues();
@@ -109,9 +120,15 @@ private:
 
    double rfIGain {1.0};              // Integrator gain (default: 1.0) (no units)
 
+   // receive() work arrays (reused)
+   std::vector<Emission*> rcvEms;     // Returned emissions
+   std::vector<double> rcvSignals;    // Their signals
+   std::vector<double> rcvSirDb;      // Their signal/interference (dB)
+
 private:
    // slot table helper methods
    bool setSlotIGain(base::Number* const);
+   bool setSlotMaxReports(const base::Number* const);
 };
 
 }
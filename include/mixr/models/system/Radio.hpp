@@ -45,7 +45,7 @@ class Emission;
 //
 // Factory name: Radio
 // Slots:
-//    numChannels    <base::Number>      ! Number of channels (less than or equal MAX_CHANNELS) (default: 0)
+//    numChannels    <base::Number>      ! Number of channels [ 0 .. 65535 ] (default: 0)
 //
 //    channels       <base::PairStream>  ! Our channels (list of base::Frequency objects) --
 //                                        ! -- make sure to set the number of channels first. (default: 0)
@@ -75,9 +75,6 @@ class Radio : public RfSystem
 {
    DECLARE_SUBCLASS(Radio, RfSystem)
 
-public:
-   enum { MAX_CHANNELS = 500 };
-
 public:
    Radio();
 
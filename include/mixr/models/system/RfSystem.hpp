@@ -4,6 +4,7 @@
 
 #include "mixr/models/system/System.hpp"
 #include <array>
+#include <vector>
 
 namespace mixr {
 namespace base { class Decibel; }
@@ -120,6 +121,12 @@ public:
    // Accepts an emission from an antenna
    virtual void rfReceivedEmission(Emission* const em, Antenna* const ra, const double raGain);
 
+   // Accepts 'n' emissions from an antenna, with their antenna gains; same as
+   // rfReceivedEmission() for each emission, but queued for receive() at once
+   // (the antenna's batched returns, which arrive after the targets have
+   // passed the emissions to their own antennas; see Antenna, note 4)
+   virtual void rfReceivedEmissions(Emission* const* const ems, Antenna* const ra, const double* const raGains, const unsigned int n);
+
    void updateData(const double dt = 0.0) override;
    void reset() override;
 
@@ -130,6 +137,11 @@ protected:
    // Compute receiver thermal noise
    virtual bool computeReceiverNoise();
 
+   // Computes the received signal (watts) of an in-band emission, and adds
+   // noise jammer signals to 'jamSignal'; returns false if the emission
+   // doesn't affect us
+   bool computeReceivedSignal(Emission* const em, const double raGain, double* const signal);
+
    // The following are filled by rfReceivedEmission() and consumed (emptied) by receive()
    double jamSignal {};                              // Interference signal (from Jammer)
    unsigned int np {};                               // Number of emission packets being passed from rfReceivedEmission() to receive()
@@ -137,6 +149,16 @@ protected:
    std::array<Emission*, MAX_EMISSIONS> packets {};  // emission packets being passed from rfReceivedEmission() to receive()
    mutable long packetLock {};                       // Semaphore to protect 'signals' and 'xxpackets
 
+   // Takes all of the emission packets, and their signals, that are waiting
+   // for receive(), at once (a single lock), and empties the queue; the packets
+   // are in the order that they'd be taken one at a time (last in, first out),
+   // and the caller must unref() them.  Returns the number of packets.
+   unsigned int takeReceivedEmissions(std::vector<Emission*>* const ems, std::vector<double>* const sigs);
+
+   // rfReceivedEmissions() work arrays (grown as needed and reused)
+   std::vector<Emission*> rcvPackets;
+   std::vector<double> rcvSignals;
+
    // Process players of interest -- Called by our updateData() -- the background thread --
    // This function will create a filtered list of players that R/F systems will interact with.
    virtual void processPlayersOfInterest();
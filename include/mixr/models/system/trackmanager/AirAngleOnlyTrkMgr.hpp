@@ -23,6 +23,17 @@ public:
 
 protected:
    void processTrackList(const double dt) override;
+   void sizeWorkArrays() override;
+
+private:
+   // Work arrays used by processTrackList() (sized by sizeWorkArrays())
+   std::vector<double> newSignal;         // Report signal
+   std::vector<double> newElevation;      // Report relative elevation
+   std::vector<double> newAzimuth;        // Report relative azimuth
+   std::vector<double> uAzimuth;          // Track azimuth inputs
+   std::vector<double> uElevation;        // Track elevation inputs
+   std::vector<double> age;               // Track age at the last update
+   std::vector<bool> haveU;               // Track has an input
 };
 
 }
@@ -3,9 +3,13 @@
 #define __mixr_models_AirTrkMgr_H__
 
 #include "mixr/models/system/trackmanager/TrackManager.hpp"
+#include "mixr/base/osg/Vec3d"
 
 #include "mixr/base/units/distance_utils.hpp"
 
+#include <utility>
+#include <vector>
+
 namespace mixr {
 namespace base { class Number; }
 namespace models {
@@ -20,6 +24,15 @@ namespace models {
 //   rangeGate      <base::Number>  ! Range Gate (meters) (default: 500.0f)
 //   velocityGate   <base::Number>  ! Velocity Gate (m/s) (default: 10.0f)
 //
+// Notes:
+//    1) Reports are associated with the tracks of the same target player.
+//       Instead of testing each report against each track (the base class's
+//       report/track matrix, which isn't used), the tracks are indexed by
+//       their target each frame, and each report looks up only its target's
+//       tracks, so the association is O((reports + tracks) log tracks) and
+//       its work arrays grow with 'maxReports' plus 'maxTracks' instead of
+//       their product.
+//
 //------------------------------------------------------------------------------
 class AirTrkMgr : public TrackManager
 {
@@ -34,6 +47,10 @@ public:
 
 protected:
    void processTrackList(const double dt) override;
+   void sizeWorkArrays() override;
+
+   // We associate using the track index, not the report/track matrix
+   bool usesMatchMatrix() const override                { return false; }
 
 private:
    void initData();
@@ -43,10 +60,18 @@ private:
    double rngGate {500.0};   // Range Gate (meters)
    double velGate {10.0};    // Velocity Gate (m/s)
 
-   // Used by processTrackList()
-   bool** report2TrackMatch {};           // Report/Track matched matrix
-   unsigned int* reportNumMatches {};     // Number of matches for each report
-   unsigned int* trackNumMatches {};      // Number of matcher for each track
+   // Work arrays used by processTrackList() (sized by sizeWorkArrays())
+   std::vector<Emission*> emissions;      // New emission reports
+   std::vector<double> newSignal;         // Report signal
+   std::vector<double> newRdot;           // Report range rate
+   std::vector<base::Vec3d> tgtPos;       // Report position (relative to ownship)
+   std::vector<base::Vec3d> u;            // Track input vectors
+   std::vector<double> age;               // Track age at the last update
+   std::vector<bool> haveU;               // Track has an input vector
+
+   // Association work arrays
+   std::vector< std::pair<const Player*, unsigned int> > trkIndex;   // Tracks by target: (target, track)
+   std::vector< std::pair<unsigned int, unsigned int> > matches;     // Matched (track, report) pairs
 
 private:
    // slot table helper methods
@@ -3,7 +3,6 @@
 #define __mixr_models_AngleOnlyTrackManager_H__
 
 #include "mixr/models/system/trackmanager/TrackManager.hpp"
-#include "mixr/base/safe_queue.hpp"
 #include "mixr/base/util/constants.hpp"
 
 namespace mixr {
@@ -37,6 +36,10 @@ public:
 protected:
    virtual IrQueryMsg* getQuery(double* const sn);                     // Get the next 'new' report from the queue
 
+   void sizeWorkArrays() override;
+
+   std::vector<IrQueryMsg*> queryMessages;   // New IR query message reports (sized by sizeWorkArrays())
+
    bool shutdownNotification() override;
 
    // Prediction parameters
@@ -46,8 +49,8 @@ protected:
    double oneMinusBeta {1.0};        // 1 - Beta parameter
 
 private:
-   base::safe_queue<IrQueryMsg*> queryQueue;  // Emission input queue (used with the
-                                              //   TrackManager::queueLock semaphore)
+   std::deque<IrQueryMsg*> queryQueue;  // IR query message input queue (limited to maxRpts;
+                                        //   used with the TrackManager::queueLock semaphore)
 private:
    // slot table helper methods
    bool setSlotAzimuthBin(const base::Number* const);
@@ -3,6 +3,7 @@
 #define __mixr_models_GmtiTrkMgr_H__
 
 #include "mixr/models/system/trackmanager/TrackManager.hpp"
+#include "mixr/base/osg/Vec3d"
 
 namespace mixr {
 namespace models {
@@ -22,14 +23,19 @@ public:
    GmtiTrkMgr();
 protected:
    void processTrackList(const double dt) override;
+   void sizeWorkArrays() override;
 
 private:
    void initData();
 
-   // Used by processTrackList()
-   bool** report2TrackMatch {};                 // Report/Track matched matrix
-   unsigned int* reportNumMatches {};           // Number of matches for each report
-   unsigned int* trackNumMatches {};            // Number of matcher for each track
+   // Work arrays used by processTrackList() (sized by sizeWorkArrays())
+   std::vector<Emission*> emissions;      // New emission reports
+   std::vector<double> newSignal;         // Report signal
+   std::vector<double> newRdot;           // Report range rate
+   std::vector<base::Vec3d> tgtPos;       // Report position (relative to ownship)
+   std::vector<base::Vec3d> u;            // Track input vectors
+   std::vector<double> age;               // Track age at the last update
+   std::vector<bool> haveU;               // Track has an input vector
 };
 
 }
@@ -3,7 +3,9 @@
 #define __mixr_models_TrackManager_H__
 
 #include "mixr/models/system/System.hpp"
-#include "mixr/base/safe_queue.hpp"
+
+#include <deque>
+#include <vector>
 
 namespace mixr {
 namespace base { class Number; }
@@ -19,7 +21,10 @@ class Track;
 //
 // Factory name: TrackManager
 // Slots:
-//    maxTracks       <Number>   ! Maximum number of tracks (default: MAX_TRKS)
+//    maxTracks       <Number>   ! Maximum number of tracks (default: DEFAULT_MAX_TRKS)
+//
+//    maxReports      <Number>   ! Maximum number of new reports processed per frame
+//                               ! (default: DEFAULT_MAX_REPORTS)
 //
 //    maxTrackAge     <Time>     ! Maximum track age (default: 3) ### NES: the comment in the src says 2 sec
 //    maxTrackAge     <Number>   ! Maximum track age (seconds)
@@ -32,6 +37,14 @@ class Track;
 //
 //    logTrackUpdates <Boolean>  ! True to log all updates to tracks (default: true)
 //
+// Notes:
+//    1) The track list and the report/track association work arrays are
+//       sized at run time from 'maxTracks' and 'maxReports'.  Reports that
+//       arrive when the report queue is full, and new tracks that can not be
+//       created because the track list is full, are counted (see
+//       getNumReportOverflows() and getNumTrackOverflows()) instead of being
+//       silently dropped.
+//
 //------------------------------------------------------------------------------
 class TrackManager : public System
 {
@@ -45,6 +58,14 @@ public:
 
    virtual unsigned int getMaxTracks() const;
    virtual unsigned int getNumTracks() const;
+   virtual bool setMaxTracks(const unsigned int n);
+
+   virtual unsigned int getMaxReports() const;
+   virtual bool setMaxReports(const unsigned int n);
+
+   // Number of reports and new tracks dropped since the last reset()
+   unsigned int getNumReportOverflows() const               { return numRptOverflows; }
+   unsigned int getNumTrackOverflows() const                { return numTrkOverflows; }
 
    virtual int getTrackList(base::safe_ptr<Track>* const slist, const unsigned int max) const;
    virtual int getTrackList(base::safe_ptr<const Track>* const slist, const unsigned int max) const;
@@ -77,8 +98,8 @@ public:
    void reset() override;
 
 protected:
-   static const unsigned int MAX_TRKS{MIXR_CONFIG_MAX_TRACKS};         // Max tracks
-   static const unsigned int MAX_REPORTS{MIXR_CONFIG_MAX_REPORTS};     // Max number of reports
+   static const unsigned int DEFAULT_MAX_TRKS{MIXR_CONFIG_MAX_TRACKS};        // Default max tracks
+   static const unsigned int DEFAULT_MAX_REPORTS{MIXR_CONFIG_MAX_REPORTS};    // Default max number of reports
 
    unsigned int getNewTrackID()                             { return nextTrkId++; }
 
@@ -86,11 +107,28 @@ protected:
 
    virtual Emission* getReport(double* const sn);                       // Get the next 'new' report from the queue
 
+   // (Re)sizes the work arrays to maxRpts and maxTrks; derived classes that
+   // keep their own per-report or per-track arrays extend this.
+   virtual void sizeWorkArrays();
+
+   // True if processTrackList() uses the report/track matched matrix, which
+   // is then sized by sizeWorkArrays() (default: true)
+   virtual bool usesMatchMatrix() const                 { return true; }
+
    // Track List
-   Track*       tracks[MAX_TRKS] {};   // Tracks
-   unsigned int nTrks {};              // Number of tracks
-   unsigned int maxTrks {MAX_TRKS};    // Max number of tracks (input)
-   mutable long trkListLock {};        // Semaphore to protect the track list
+   std::vector<Track*> tracks;                   // Tracks (sized to maxTrks)
+   unsigned int nTrks {};                        // Number of tracks
+   unsigned int maxTrks {DEFAULT_MAX_TRKS};      // Max number of tracks (input)
+   unsigned int maxRpts {DEFAULT_MAX_REPORTS};   // Max number of reports per frame (input)
+   mutable long trkListLock {};                  // Semaphore to protect the track list
+
+   // Report/track association work arrays (sized by sizeWorkArrays())
+   std::vector< std::vector<unsigned char> > report2TrackMatch;  // Report/Track matched matrix [maxRpts][maxTrks] (see usesMatchMatrix())
+   std::vector<unsigned int> reportNumMatches;                   // Number of matches for each report
+   std::vector<unsigned int> trackNumMatches;                    // Number of matches for each track
+
+   unsigned int numRptOverflows {};   // Number of reports dropped (report queue or work arrays full)
+   unsigned int numTrkOverflows {};   // Number of new tracks not created (track list full)
 
    // Prediction parameters
    void makeMatrixA(const double dt);
@@ -103,9 +141,9 @@ protected:
    unsigned int nextTrkId {1000};          // Next track ID
    unsigned int firstTrkId {1000};         // First (starting) track ID
 
-   base::safe_queue<Emission*> emQueue {MAX_TRKS}; // Emission input queue
-   base::safe_queue<double>    snQueue {MAX_TRKS}; // S/N input queue.
-   mutable long queueLock {};                      // Semaphore to protect both emQueue and snQueue
+   std::deque<Emission*> emQueue;   // Emission input queue (limited to maxRpts)
+   std::deque<double>    snQueue;   // S/N input queue.
+   mutable long queueLock {};       // Semaphore to protect both emQueue and snQueue
 
    // System class Interface -- phase() callbacks
    void process(const double dt) override;     // Phase 3
@@ -120,6 +158,7 @@ private:
 
 private:
    bool setSlotMaxTracks(const base::Number* const);       // Sets the maximum number of track files
+   bool setSlotMaxReports(const base::Number* const);      // Sets the maximum number of reports per frame
    bool setSlotMaxTrackAge(const base::Number* const);     // Sets the maximum age of tracks
    bool setSlotFirstTrackId(const base::Number* const);    // Sets the first (starting) track id number
    virtual bool setSlotAlpha(const base::Number* const);   // Sets alpha
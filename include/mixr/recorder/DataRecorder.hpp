@@ -31,6 +31,8 @@ class OutputHandler;
 //    REID_MARKER             ! v[0] => id;  v[1] => source id;
 //    REID_DI_EVENT           ! v[0] => id;  v[1] => source id;  v[2] => value
 //    REID_AI_EVENT           ! v[0] => id;  v[1] => source id;  v[2] => value
+//    REID_CLASS_STATS        ! obj[0] => (factory name); v[0] => live; v[1] => peak;
+//                            !   v[2] => bytes; v[3] => allocs/sec
 //
 //    REID_NEW_PLAYER         ! obj[0] => (new player)
 //    REID_PLAYER_REMOVED     ! obj[0] => (player)
@@ -95,6 +97,7 @@ protected:
    virtual bool recordMarker(const base::Object* objs[4], const double values[4]);
    virtual bool recordAI(const base::Object* objs[4], const double values[4]);
    virtual bool recordDI(const base::Object* objs[4], const double values[4]);
+   virtual bool recordClassStats(const base::Object* objs[4], const double values[4]);
    virtual bool recordNewPlayer(const base::Object* objs[4], const double values[4]);
    virtual bool recordPlayerRemoved(const base::Object* objs[4], const double values[4]);
    virtual bool recordPlayerData(const base::Object* objs[4], const double values[4]);
@@ -17,6 +17,7 @@ class PlayerKilledEventMsg; class WeaponReleaseEventMsg; class WeaponHungEventMs
 class WeaponDetonationEventMsg; class GunFiredEventMsg; class NewTrackEventMsg;
 class TrackRemovedEventMsg; class TrackDataMsg; class PlayerId; class PlayerState;
 class TrackData; class EmissionData; class MarkerMsg; class InputDeviceMsg;
+class ClassStatsMsg;
 }
 
 //------------------------------------------------------------------------------
@@ -61,6 +62,7 @@ protected:
    virtual void printTrackDataMsg(const pb::Time* const timeMsg, const pb::TrackDataMsg* const msg);
    virtual void printMarkerMsg(const pb::Time* const timeMsg, const pb::MarkerMsg* const msg);
    virtual void printInputDeviceMsg(const pb::Time* const timeMsg, const pb::InputDeviceMsg* const msg, const  unsigned int msgId);
+   virtual void printClassStatsMsg(const pb::Time* const timeMsg, const pb::ClassStatsMsg* const msg);
 
    // Events without messages
    virtual void printUnhandledIdToken(const pb::Time* const timeMsg);
@@ -118,6 +120,7 @@ private:
    bool trackDataHdr {true};
    bool markerHdr {true};
    bool inputDeviceHdr {true};
+   bool classStatsHdr {true};
 
    // Group headers
    bool playerHeader {true};
@@ -96,6 +96,9 @@ class AbstractPlayer;
 //    Use cycle(), frame() and phase() to get the current values, and use getExecCounter()
 //    to get the total number of phases since the start of the exec.
 //
+//    After all players have completed a phase, and before the next phase starts,
+//    phaseCompleted() is called (e.g., to update data shared by the players).
+//
 //
 // Multiple time critical and background threads:
 //
@@ -115,6 +118,12 @@ class AbstractPlayer;
 //             This leaves a CPU for the operating system, other applications
 //             and our other threads.
 //
+//    Batched background work: before the players' background updates, each
+//    frame, bgBatchStarted() is called, and if it returns true, the background
+//    threads (or our single thread) each process a part of the batch with
+//    updateBgBatch(), and they rejoin, before the players are updated (e.g., the
+//    WorldModel's batched terrain elevations of the players).
+//
 //
 // Time and Date:
 //
@@ -232,6 +241,9 @@ public:
        const unsigned int n
     );
 
+    // Background thread processing of part 'idx' of 'n' parts of the batch
+    virtual void updateBgBatch(const unsigned int idx, const unsigned int n);
+
 protected:
     virtual void updatePlayerList();                  // Updates the current player list
 
@@ -240,6 +252,13 @@ protected:
     virtual void setFrame(const unsigned int f);      // Sets the frame counter
     virtual void setPhase(const unsigned int c);      // Sets the phase counter
 
+    // Called after all players have completed phase 'p' of the time-critical frame
+    virtual void phaseCompleted(base::PairStream* const playerList, const unsigned int p);
+
+    // Called before the players' background updates; returns true if there's
+    // batched work for updateBgBatch()
+    virtual bool bgBatchStarted(base::PairStream* const playerList, const double dt);
+
     virtual void setEventID(unsigned short id);       // Sets the simulation event ID counter
     virtual void setWeaponEventID(unsigned short id); // Sets the weapon ID event counter
 
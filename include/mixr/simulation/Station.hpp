@@ -54,10 +54,13 @@ class StationNetPeriodicThread;
 //    startupResetTime   <base::Time>               ! Startup (initial) RESET event timer value (default: no reset event)
 //                                                  !  (some simulations may need this -- let it run a few initial frames then reset)
 //
-//    enableUpdateTimers <base::Boolean>            ! Enable calling base::Timers::updateTimers() from updateTC() (default: false)
+//    enableUpdateTimers <base::Boolean>            ! Enable calling base::Timers::updateTimers() from updateTC() and the background tasks (default: false)
 //
 //    dataRecorder       <AbstractDataRecorder>     ! Our Data Recorder
 //
+//    classStatsPeriod   <base::Time>               ! Period of the class instance and memory statistics records
+//                                                  ! sent to the data recorder (default: 0 -- no records)
+//
 //
 // Ownship player:
 //
@@ -94,7 +97,9 @@ class StationNetPeriodicThread;
 //          IG interfaces, and updates the I/O handlers;
 //
 //       b: And updateTC() calls the static function base::Timer::updateTimers()
-//          if isUpdateTimersEnabled() is true (i.e., slot 'enableUpdateTimers');
+//          for the TC timer wheel if isUpdateTimersEnabled() is true (i.e., slot
+//          'enableUpdateTimers'); processBackgroundTasks() does the same for the
+//          BG timer wheel;
 //
 //       c: To sync hardware I/O with the simulation exec, the two functions,
 //          inputDevices() and outputDevices(), are called from our updateTC()
@@ -183,6 +188,9 @@ public:
    bool isUpdateTimersEnabled() const;
    virtual bool setUpdateTimersEnable(const bool enb);
 
+   // Prints the class instance and memory statistics (see base::MetaObject)
+   virtual void printClassStatistics(std::ostream& sout);
+
    // ---
    // Use these functions to process the time-critical, background and network
    // tasks if you're managing your own thread(s) from your main application
@@ -236,6 +244,7 @@ public:
 protected:
    virtual void inputDevices(const double dt);    // Handle device inputs
    virtual void outputDevices(const double dt);   // Handle device output
+   virtual void recordClassStatistics();          // Records the class statistics to the data recorder
 
    // base::Component protected functions
    bool shutdownNotification() override;
@@ -276,6 +285,9 @@ private:
    double startupResetTimer{-1.0};                           // Startup RESET timer (sends a RESET_EVENT after timeout)
    const base::Time* startupResetTimer0{};                   // Init value of the startup RESET timer
 
+   double classStatsPeriod{};                                // Class statistics record period (sec) (zero for no records)
+   double classStatsTimer{};                                 // Time since the last class statistics update (sec)
+
 private:
    // slot table helper methods
    bool setSlotSimulation(Simulation* const);
@@ -305,6 +317,7 @@ private:
    bool setSlotEnableUpdateTimers(const base::Number* const);
 
    bool setSlotDataRecorder(AbstractDataRecorder* const x)              { return setDataRecorder(x); }
+   bool setSlotClassStatsPeriod(const base::Time* const);
 };
 
 }
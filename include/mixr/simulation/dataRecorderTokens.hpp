@@ -29,6 +29,7 @@
 #define REID_MARKER              21    // Data marker message; V1 => id; V2 => source ID
 #define REID_DI_EVENT            22    // Discrete input (switch, etc.) event message; V1 => id; V2 => source ID; V3 => value
 #define REID_AI_EVENT            23    // Analog input (joystick, etc.) event message; V1 => id; V2 => source ID; V3 => value
+#define REID_CLASS_STATS         24    // Class instance statistics message; P1 => (factory name); V1 => live; V2 => peak; V3 => bytes; V4 => allocs/sec
 
 // Player data messages
 #define REID_NEW_PLAYER          41    // New Player message; P1 => (new player)
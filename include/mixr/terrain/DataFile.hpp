@@ -4,6 +4,8 @@
 
 #include "mixr/terrain/Terrain.hpp"
 
+#include <vector>
+
 namespace mixr {
 namespace terrain {
 
@@ -16,6 +18,10 @@ namespace terrain {
 //    1) the first elevation point [0] of all arrays is at the reference point
 //    2) the final elevation point [n-1] is at the maximum range
 //    3) The size of all arrays, n, must contain at least 2 points (ref point & max range)
+//    4) On reset, after the data is loaded, a pyramid of the min and max
+//       elevations of blocks of posts (4x4 posts, 8x8, 16x16, etc.) is built
+//       for getElevationBounds(), which lets the terrain occulting checks
+//       skip the parts of the profiles that are well clear of the terrain.
 //------------------------------------------------------------------------------
 class DataFile : public Terrain
 {
@@ -52,6 +58,8 @@ public:
    //  Elevations are in meters
    const short* getColumn(const unsigned int idx) const;
 
+   short getVoidValue() const                { return voidValue; }   // Value representing a void (missing) data point
+
    // ---
    // simulation::Terrain interface
    // ---
@@ -80,6 +88,18 @@ public:
          const bool interp = false     // Interpolate between elevation posts (default: false)
       ) const override;
 
+   bool getElevationBounds(
+         double* const minElev,        // Min elevation (meters)
+         double* const maxElev,        // Max elevation (meters)
+         bool* const complete,         // Elevations are found everywhere within the box
+         const double swLat,           // Southwest corner latitude (degs)
+         const double swLon,           // Southwest corner longitude (degs)
+         const double neLat,           // Northeast corner latitude (degs)
+         const double neLon            // Northeast corner longitude (degs)
+      ) const override;
+
+   void reset() override;
+
 protected:
    short**  columns {};           // Array of data columns (values in meters)
    double   latSpacing {};        // Spacing between latitude points (degs)
@@ -88,7 +108,27 @@ protected:
    unsigned int nptlong {};       // Number of points in longitude (i.e., number of columns)
    short    voidValue {-32767};   // Value representing a void (missing) data point
 
+   // True if 'columns' are allocated by this object and are copied by
+   // copyData(); false if they point into storage managed by a derived class
+   // (e.g., MappedFile), which must then copy and clear the columns itself
+   virtual bool isColumnStorageOwned() const { return true; }
+
    void clearData() override;
+
+private:
+   static const unsigned int BLOCK_SIZE{4};     // Posts per side of the pyramid's first level blocks
+
+   // Pyramid level: min and max elevations of blocks of posts
+   struct Level {
+      unsigned int nrows {};        // Number of blocks in latitude
+      unsigned int ncols {};        // Number of blocks in longitude
+      std::vector<short> lo;        // Min elevations (by columns, like the posts)
+      std::vector<short> hi;        // Max elevations
+   };
+
+   void buildPyramid();
+
+   std::vector<Level> pyramid;      // Level [i] has blocks of BLOCK_SIZE * 2^i posts per side
 };
 
 }
@@ -0,0 +1,137 @@
+
+#ifndef __mixr_terrain_LosCache_H__
+#define __mixr_terrain_LosCache_H__
+
+#include "mixr/base/Object.hpp"
+
+#include <array>
+#include <atomic>
+#include <vector>
+
+namespace mixr {
+namespace base { class Distance; class Integer; class Time; }
+namespace terrain {
+class Terrain;
+
+//------------------------------------------------------------------------------
+// Class: LosCache
+// Description: Cache of terrain line-of-sight (occulting) results
+//
+//    The observer and target positions are quantized into cells, 'cellSize'
+//    meters on a side, and altitude bands, 'altitudeBand' meters thick, and
+//    the result of Terrain::targetOcculting() is saved for each pair of
+//    observer and target cells.  Later checks between the same pair of cells,
+//    within 'validityTime' seconds, reuse the saved result instead of sampling
+//    and checking the elevation profile again.
+//
+//    The cache is a fixed size, direct-mapped table, and a new result replaces
+//    the old entry in its slot.  The table is split into stripes, each with
+//    its own lock, so one cache can be shared by the sensors of all of the
+//    players, from any thread (see WorldModel's 'terrainLosCache' slot).
+//
+// Factory name: LosCache
+// Slots:
+//    cellSize       <base::Distance>   ! Horizontal cell size (default: 100 meters)
+//    altitudeBand   <base::Distance>   ! Altitude band (default: 25 meters)
+//    validityTime   <base::Time>       ! Max age of a saved result (default: 1 second)
+//    size           <base::Integer>    ! Number of entries; rounded up to a power of two
+//                                      ! (default: 65536)
+//
+// Notes:
+//    1) The results are approximate: a saved result is the answer for the
+//       first pair of positions checked in the pair of cells.  Smaller cells
+//       and bands, and shorter validity times, trade hit rate for accuracy.
+//
+//    2) The cache is cleared by clear() (e.g., on reset, and when the world
+//       model's terrain is replaced), and by changes to its parameters.
+//------------------------------------------------------------------------------
+class LosCache : public base::Object
+{
+   DECLARE_SUBCLASS(LosCache, base::Object)
+
+public:
+   LosCache();
+
+   double getCellSize() const        { return cellSize; }       // meters
+   double getAltitudeBand() const    { return altBand; }        // meters
+   double getValidityTime() const    { return validity; }       // seconds
+   unsigned int getSize() const      { return static_cast<unsigned int>(entries.size()); }
+
+   virtual bool setCellSize(const double meters);
+   virtual bool setAltitudeBand(const double meters);
+   virtual bool setValidityTime(const double seconds);
+   virtual bool setSize(const unsigned int n);
+
+   // Same as terrain->targetOcculting(), but first checks the cache for a
+   // result between the same cells that's no older than the validity time,
+   // where 'time' is the current time (seconds)
+   bool targetOcculting(
+         const Terrain* const terrain, // Terrain database
+         const double refLat,          // Ref latitude (degs)
+         const double refLon,          // Ref longitude (degs)
+         const double refAlt,          // Ref altitude (meters)
+         const double tgtLat,          // Target latitude (degs)
+         const double tgtLon,          // Target longitude (degs)
+         const double tgtAlt,          // Target altitude (meters)
+         const double time             // Current time (seconds)
+      );
+
+   // Clears the saved results and the statistics
+   void clear();
+
+   // Statistics
+   unsigned long getNumLookups() const;
+   unsigned long getNumHits() const;
+   double getHitRate() const;        // Hits / lookups [ 0 .. 1 ]
+
+private:
+   static const unsigned int NUM_STRIPES{64};
+   static const unsigned int DEFAULT_SIZE{65536};
+
+   // Quantized observer and target positions
+   struct Key {
+      int v[6] {};
+      bool operator==(const Key& k) const;
+   };
+
+   struct Entry {
+      Key key;
+      const Terrain* terrain {};     // Terrain used to compute the result (or zero if empty)
+      double time {};                // Time of the result (seconds)
+      bool occulted {};              // Result
+   };
+
+   // Lock and statistics of a stripe (padded to a cache line); the
+   // statistics are atomic, so they can be read without the locks
+   struct Stripe {
+      mutable long lock {};
+      std::atomic<unsigned long> lookups {};
+      std::atomic<unsigned long> hits {};
+      char pad[64 - sizeof(long) - 2 * sizeof(std::atomic<unsigned long>)] {};
+   };
+
+   Key computeKey(const double refLat, const double refLon, const double refAlt,
+                  const double tgtLat, const double tgtLon, const double tgtAlt) const;
+   unsigned int computeIndex(const Key& k) const;
+   void setEntries(const unsigned int n);
+
+   double cellSize {100.0};           // Horizontal cell size (meters)
+   double altBand {25.0};             // Altitude band (meters)
+   double validity {1.0};             // Max age of a result (seconds)
+
+   std::vector<Entry> entries;        // Table of results
+   unsigned int mask {};              // Index mask (entries.size() - 1)
+   std::array<Stripe, NUM_STRIPES> stripes {};
+
+private:
+   // slot table helper methods
+   bool setSlotCellSize(const base::Distance* const);
+   bool setSlotAltitudeBand(const base::Distance* const);
+   bool setSlotValidityTime(const base::Time* const);
+   bool setSlotSize(const base::Integer* const);
+};
+
+}
+}
+
+#endif
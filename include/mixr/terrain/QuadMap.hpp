@@ -53,6 +53,17 @@ public:
          const bool interp = false     // Interpolate between elevation posts (default: false)
       ) const override;
 
+   // Min and max elevations of all of the data files within the box
+   bool getElevationBounds(
+         double* const minElev,        // Min elevation (meters)
+         double* const maxElev,        // Max elevation (meters)
+         bool* const complete,         // Elevations are found everywhere within the box
+         const double swLat,           // Southwest corner latitude (degs)
+         const double swLon,           // Southwest corner longitude (degs)
+         const double neLat,           // Northeast corner latitude (degs)
+         const double neLon            // Northeast corner longitude (degs)
+      ) const override;
+
    void reset() override;
 
 protected:
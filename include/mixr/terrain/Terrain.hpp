@@ -72,6 +72,26 @@ public:
          const bool interp = false     // Interpolate between elevation posts (default: false)
       ) const = 0;
 
+   // Hint that elevations will be needed around these points (degs), e.g., the
+   // players' positions, so databases that load their data on demand can start
+   // loading it.  The default does nothing.
+   virtual void prefetch(const double* const lats, const double* const lons, const unsigned int n)   {}
+
+   // Min and max elevations (meters) of all of the elevation posts that lookups
+   // within the box, [ swLat swLon ] to [ neLat neLon ] (degs), could use.  The
+   // 'complete' flag is set true if lookups everywhere within the box will find
+   // an elevation.  If there's no data within the box then 'minElev' is set
+   // greater than 'maxElev'.  Returns false if the bounds aren't known (default).
+   virtual bool getElevationBounds(
+         double* const minElev,        // Min elevation (meters)
+         double* const maxElev,        // Max elevation (meters)
+         bool* const complete,         // Elevations are found everywhere within the box
+         const double swLat,           // Southwest corner latitude (degs)
+         const double swLon,           // Southwest corner longitude (degs)
+         const double neLat,           // Northeast corner latitude (degs)
+         const double neLon            // Northeast corner longitude (degs)
+      ) const                                  { return false; }
+
    // Returns true if a target point is occulted by the terrain as seen from the ref point
    virtual bool targetOcculting(
          const double refLat,          // Ref latitude (degs)
@@ -116,6 +136,44 @@ public:
          const double tanLookAng         // Tangent of the look angle
       );
 
+   // Occulting check kernel, used by occultCheck() and occultCheck2(): returns
+   // true if the tangent of the angle (from level) to any of the elevation
+   // points [ 1 .. n-2 ], 'deltaRng' meters apart, as seen from the ref
+   // altitude, is greater than or equal to 'tanAng' (points that aren't valid
+   // are skipped).  Uses the AVX version when it's available (see
+   // isAvxOccultAvailable()), and the scalar version otherwise; both give the
+   // same results.
+   static bool anyPointAbove(
+         const double* const elevations, // The elevation array (meters)
+         const bool* const validFlags,   // (Optional) Valid elevation flag array
+         const unsigned int n,           // Size of the arrays
+         const double deltaRng,          // Range between points (meters)
+         const double refAlt,            // Ref altitude (meters)
+         const double tanAng             // Tangent of the angle
+      );
+
+   // True if the AVX kernel was built (GCC or Clang on x86) and the CPU
+   // supports it
+   static bool isAvxOccultAvailable();
+
+   static bool anyPointAboveScalar(
+         const double* const elevations,
+         const bool* const validFlags,
+         const unsigned int n,
+         const double deltaRng,
+         const double refAlt,
+         const double tanAng
+      );
+
+   static bool anyPointAboveAvx(        // requires isAvxOccultAvailable()
+         const double* const elevations,
+         const bool* const validFlags,
+         const unsigned int n,
+         const double deltaRng,
+         const double refAlt,
+         const double tanAng
+      );
+
    // Vertical Beam Width and Shadow Check --
    // Sets an array of mask flags; the flags are set true if the point
    // is masked (in shadow or out of beam) as seen from the reference
@@ -186,6 +244,20 @@ protected:
    virtual bool setLongitudeNE(const double v);    // Northeast corner longitude of this database (degs: +/-180)
 
 private:
+   enum BoundsCheck { CLEAR, OCCULTED, UNKNOWN };
+
+   // Occulting check of the profile using the elevation bounds, which returns
+   // UNKNOWN if the full resolution profile needs to be checked
+   BoundsCheck boundsCheck(
+         const double lat,             // Ref latitude (degs)
+         const double lon,             // Ref longitude (degs)
+         const double direction,       // True direction angle of the profile (degs)
+         const double maxRng,          // Range to the last point (meters)
+         const unsigned int n,         // Number of points in the profile
+         const double refAlt,          // Ref altitude (meters)
+         const double tanAng           // Tangent of the angle to the target (or look angle)
+      ) const;
+
    virtual bool loadData() =0;      // Load the data file
 
    const base::String* path {};     // Data path name
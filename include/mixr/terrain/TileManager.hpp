@@ -0,0 +1,185 @@
+
+#ifndef __mixr_terrain_TileManager_H__
+#define __mixr_terrain_TileManager_H__
+
+#include "mixr/terrain/Terrain.hpp"
+#include "mixr/base/safe_ptr.hpp"
+
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <unordered_map>
+
+namespace mixr {
+namespace base { class Distance; class Number; class String; }
+namespace terrain {
+class DataFile;
+class TileLoaderThread;
+
+//------------------------------------------------------------------------------
+// Class: TileManager
+//
+// Description: Streaming terrain database of one degree cells (tiles)
+//
+//    The tiles are found in the 'path' directory by their latitude and
+//    longitude, using the standard file names of their 'format':
+//
+//       "dt0", "dt1", "dt2"  DTED (DtedFile):           <path>/w118/n36.dt1
+//       "hgt"                SRTM (SrtmHgtFile):        <path>/N36W118.hgt
+//       "mtf"                Tile files (MappedFile):   <path>/n36w118.mtf
+//
+//    The tiles are loaded on demand by a background thread, and are evicted,
+//    least recently used first, to keep the loaded tiles within the memory
+//    budget, 'maxMemory'.  Tiles are requested around the players' positions
+//    (see Terrain::prefetch(), which WorldModel calls each frame), and by any
+//    lookup of a tile that isn't loaded.
+//
+//    The elevation lookups never wait for a tile to load: points on tiles
+//    that aren't loaded yet, or that don't exist, are found using the
+//    optional 'coarse' terrain (e.g., a DTED level 0 QuadMap or MappedFile),
+//    if any, or are not found.
+//
+// Factory name: TileManager
+// Slots:
+//    format         <base::String>    ! Tile file format: "dt0", "dt1", "dt2", "hgt" or "mtf" (default: "dt1")
+//    maxMemory      <base::Number>    ! Memory budget for the loaded tiles (megabytes) (default: 1024)
+//    prefetchRadius <base::Distance>  ! Tiles within this distance of the players are loaded (default: 50 km)
+//    coarse         <Terrain>         ! Terrain used where tiles aren't loaded (default: none)
+//
+// Notes:
+//    1) Inherited 'path' slot is the tile directory; the 'file' slot isn't used.
+//
+//    2) The loader thread is started on the first reset, and runs until the
+//       SHUTDOWN_EVENT.  If the thread can't be started, the requested tiles
+//       are loaded by prefetch().
+//
+//    3) The lookups and the loader thread share the tile table using a short
+//       spin lock; the tiles are ref()'d while they're in use, so a tile that's
+//       evicted during a lookup is deleted after the lookup.
+//
+// Example:
+//
+//    ( TileManager
+//       path: "/data/dted" format: "dt1" maxMemory: 512 prefetchRadius: ( Kilometers 100 )
+//       coarse: ( MappedFile path: "/data" file: "world_dt0.mtf" )
+//    )
+//------------------------------------------------------------------------------
+class TileManager : public Terrain
+{
+   DECLARE_SUBCLASS(TileManager, Terrain)
+
+public:
+   TileManager();
+
+   const char* getFormat() const                      { return format.c_str(); }
+   double getMaxMemory() const;                       // Memory budget (megabytes)
+   double getPrefetchRadius() const                   { return prefetchRadius; }    // meters
+   const Terrain* getCoarseTerrain() const            { return coarse; }
+
+   virtual bool setFormat(const std::string& fmt);
+   virtual bool setMaxMemory(const double megabytes);
+   virtual bool setPrefetchRadius(const double meters);
+   virtual bool setCoarseTerrain(Terrain* const);
+
+   // Statistics
+   unsigned int getNumLoadedTiles() const;
+   std::size_t getLoadedBytes() const;
+   unsigned long getNumLoads() const                  { return numLoads; }
+   unsigned long getNumEvictions() const              { return numEvictions; }
+
+   // ---
+   // Terrain interface
+   // ---
+
+   bool isDataLoaded() const override;
+
+   unsigned int getElevations(
+         double* const elevations,     // The elevation array (meters)
+         bool* const validFlags,       // Valid elevation flag array (true if elevation was found)
+         const unsigned int n,         // Size of elevation and valdFlags arrays
+         const double lat,             // Starting latitude (degs)
+         const double lon,             // Starting longitude (degs)
+         const double direction,       // True direction (heading) angle of the data (degs)
+         const double maxRng,          // Range to last elevation point (meters)
+         const bool   interp = false   // Interpolate between elevation posts (default: false)
+      ) const override;
+
+   bool getElevation(
+         double* const elev,           // The elevation value (meters)
+         const double lat,             // Reference latitude (degs)
+         const double lon,             // Reference longitude (degs)
+         const bool interp = false     // Interpolate between elevation posts (default: false)
+      ) const override;
+
+   bool getElevationBounds(
+         double* const minElev,        // Min elevation (meters)
+         double* const maxElev,        // Max elevation (meters)
+         bool* const complete,         // Elevations are found everywhere within the box
+         const double swLat,           // Southwest corner latitude (degs)
+         const double swLon,           // Southwest corner longitude (degs)
+         const double neLat,           // Northeast corner latitude (degs)
+         const double neLon            // Northeast corner longitude (degs)
+      ) const override;
+
+   void prefetch(const double* const lats, const double* const lons, const unsigned int n) override;
+
+   void reset() override;
+
+protected:
+   // Loads the requested tiles; called by the loader thread
+   virtual void loadTiles();
+
+   void clearData() override;
+   bool shutdownNotification() override;
+
+private:
+   friend class TileLoaderThread;
+
+   static const unsigned int DEFAULT_MAX_MEMORY{1024};    // megabytes
+
+   enum State { REQUESTED, LOADED, MISSING };
+
+   struct Tile {
+      DataFile* file {};               // Loaded tile (LOADED only)
+      State state {REQUESTED};
+      unsigned long lastUsed {};       // Lookup count at the last use
+      std::size_t bytes {};            // Size of the elevation data
+   };
+
+   static int cellKey(const int ilat, const int ilon);
+
+   DataFile* acquireTile(const int ilat, const int ilon) const;   // Loaded tile, ref()'d, or requests it
+   void request(const int key) const;                             // Requests the tile (call with the lock)
+   DataFile* loadTile(const int key) const;                       // Loads the tile
+   std::string tileFilename(const int ilat, const int ilon) const;
+
+   bool loadData() override;
+
+   std::string format {"dt1"};                     // Tile format (file extension)
+   std::size_t maxBytes {};                        // Memory budget (bytes)
+   double prefetchRadius {50000.0};                // Prefetch radius (meters)
+   Terrain* coarse {};                             // Coarse terrain (or zero)
+
+   mutable std::unordered_map<int, Tile> tiles;    // Tile table, by cell key
+   mutable std::deque<int> requests;               // Requested cell keys
+   mutable long tileLock {};                       // Lock for the tile table and requests
+   mutable unsigned long useCount {};              // Lookup count (LRU clock)
+   std::size_t loadedBytes {};                     // Size of the loaded tiles
+   unsigned long numLoads {};                      // Number of tiles loaded
+   unsigned long numEvictions {};                  // Number of tiles evicted
+
+   base::safe_ptr<TileLoaderThread> loader;        // Loader thread
+   bool started {};                                // Loader started (or failed to start)
+
+private:
+   // slot table helper methods
+   bool setSlotFormat(const base::String* const);
+   bool setSlotMaxMemory(const base::Number* const);
+   bool setSlotPrefetchRadius(const base::Distance* const);
+   bool setSlotCoarse(Terrain* const);
+};
+
+}
+}
+
+#endif
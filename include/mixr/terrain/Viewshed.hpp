@@ -0,0 +1,114 @@
+
+#ifndef __mixr_terrain_Viewshed_H__
+#define __mixr_terrain_Viewshed_H__
+
+#include "mixr/base/Object.hpp"
+
+#include <vector>
+
+namespace mixr {
+namespace base { class Distance; class Integer; }
+namespace terrain {
+class Terrain;
+
+//------------------------------------------------------------------------------
+// Class: Viewshed
+// Description: Precomputed terrain horizon of a stationary observer
+//
+//    For each of the 'azimuths' bins around the observer, and for each of the
+//    'ranges' range rings out to 'maxRange', compute() saves the max tangent
+//    of the elevation angle, from the observer's altitude, to the terrain
+//    between the observer and the ring.  The terrain occulting check of a
+//    target within 'maxRange' is then a single compare of the target's
+//    elevation angle with the horizon of its azimuth bin and range ring,
+//    instead of a walk along the elevation profile (see Terrain::targetOcculting()).
+//
+//    The horizons are computed once for the observer's position; compute()
+//    it again when the observer moves (see Player's viewshed).
+//
+// Factory name: Viewshed
+// Slots:
+//    azimuths       <base::Integer>    ! Number of azimuth bins (default: 360)
+//    ranges         <base::Integer>    ! Number of range rings (default: 64)
+//    maxRange       <base::Distance>   ! Max range (default: 50 km)
+//
+// Notes:
+//    1) Same flat earth geometry as Terrain::targetOcculting().  Each azimuth
+//       bin is sampled along two rays, a quarter bin either side of its
+//       center, at the same 100 meter spacing (up to 1200 points).
+//
+//    2) The results are approximate, to the resolution of the bins: the
+//       terrain within the target's own range ring isn't checked.
+//
+//    3) A computed viewshed is read only, and can be shared by any thread.
+//------------------------------------------------------------------------------
+class Viewshed : public base::Object
+{
+   DECLARE_SUBCLASS(Viewshed, base::Object)
+
+public:
+   Viewshed();
+
+   unsigned int getNumAzimuths() const     { return numAzimuths; }
+   unsigned int getNumRanges() const       { return numRanges; }
+   double getMaxRange() const              { return maxRange; }       // meters
+
+   virtual bool setNumAzimuths(const unsigned int n);
+   virtual bool setNumRanges(const unsigned int n);
+   virtual bool setMaxRange(const double meters);
+
+   // Computes the horizons of an observer; returns true if successful
+   bool compute(
+         const Terrain* const terrain, // Terrain database
+         const double lat,             // Observer latitude (degs)
+         const double lon,             // Observer longitude (degs)
+         const double alt              // Observer altitude (meters)
+      );
+
+   bool isComputed() const                 { return !horizons.empty(); }
+   double getLatitude() const              { return refLat; }         // degs
+   double getLongitude() const             { return refLon; }         // degs
+   double getAltitude() const              { return refAlt; }         // meters
+
+   // True if the viewshed was computed within 'tolerance' meters of the position
+   bool isAt(const double lat, const double lon, const double alt, const double tolerance = 1.0) const;
+
+   // Terrain occulting check of a target: returns true if the target is
+   // within the viewshed, and sets 'occulted'; otherwise, the target must
+   // be checked using the terrain database.
+   bool targetOcculting(
+         bool* const occulted,         // Target is occulted by the terrain
+         const double tgtLat,          // Target latitude (degs)
+         const double tgtLon,          // Target longitude (degs)
+         const double tgtAlt           // Target altitude (meters)
+      ) const;
+
+private:
+   static const unsigned int DEFAULT_AZIMUTHS{360};
+   static const unsigned int DEFAULT_RANGES{64};
+
+   void clear();
+
+   unsigned int numAzimuths {DEFAULT_AZIMUTHS};    // Number of azimuth bins
+   unsigned int numRanges {DEFAULT_RANGES};        // Number of range rings
+   double maxRange {50000.0};                      // Max range (meters)
+
+   double refLat {};                               // Observer latitude (degs)
+   double refLon {};                               // Observer longitude (degs)
+   double refAlt {};                               // Observer altitude (meters)
+
+   // Max tangent of the elevation angle to the terrain out to each
+   // range ring: [ azimuth * numRanges + ring ]
+   std::vector<float> horizons;
+
+private:
+   // slot table helper methods
+   bool setSlotNumAzimuths(const base::Integer* const);
+   bool setSlotNumRanges(const base::Integer* const);
+   bool setSlotMaxRange(const base::Distance* const);
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,90 @@
+
+#ifndef __mixr_terrain_MappedFile_H__
+#define __mixr_terrain_MappedFile_H__
+
+#include "mixr/terrain/DataFile.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace mixr {
+namespace terrain {
+
+//------------------------------------------------------------------------------
+// Class: MappedFile
+//
+// Description: Memory-mapped terrain tile loader.
+//
+//    Loads a preprocessed terrain tile file by mapping it into memory, read
+//    only, instead of reading it.  Loading is immediate, the elevation posts
+//    are paged in as they're used, and the pages are shared by all of the
+//    processes (and copies of this object) that map the same file.
+//
+//    The tile files are converted once from any loaded DataFile (e.g., a
+//    DtedFile, SrtmHgtFile or DedFile) using write(), or with the
+//    mixr_mtfconvert tool (see tools/mtfconvert.cpp).  A tile file is a
+//    128 byte header (see Header) followed by the elevation posts (meters),
+//    as 16 bit integers in the native byte order of the machine that wrote
+//    the file.  The posts are stored in DataFile's column order: all of the
+//    posts of the west-most column (south to north), followed by those of
+//    the next column east, etc., so the columns are contiguous in memory
+//    and are used in place.
+//
+//    Files written on a machine with a different byte order are rejected;
+//    convert them again from the source data.
+//
+// Factory name: MappedFile
+// Slots:
+//    N/A
+//
+// Example:
+//
+//    ( MappedFile path: "./data" file: "n36w118.mtf" )
+//------------------------------------------------------------------------------
+class MappedFile : public DataFile
+{
+   DECLARE_SUBCLASS(MappedFile, DataFile)
+
+public:
+   // Tile file header (128 bytes)
+   struct Header {
+      char magic[8];                   // MAGIC
+      std::uint32_t byteOrder;         // BYTE_ORDER_MARK, as written by the source machine
+      std::uint32_t version;           // VERSION
+      std::uint32_t nptlat;            // Number of points in latitude (posts per column)
+      std::uint32_t nptlong;           // Number of points in longitude (columns)
+      double swLat, swLon;             // Southwest corner (degs)
+      double neLat, neLon;             // Northeast corner (degs)
+      double latSpacing;               // Spacing between latitude points (degs)
+      double lonSpacing;               // Spacing between longitude points (degs)
+      double minElev, maxElev;         // Min and max elevations (meters)
+      std::int16_t voidValue;          // Value representing a void (missing) data point
+      char spare[38];
+   };
+
+   static const char MAGIC[8];
+   static const std::uint32_t BYTE_ORDER_MARK{0x01020304};
+   static const std::uint32_t VERSION{1};
+
+public:
+   MappedFile();
+
+   // Writes the loaded data file to a tile file; returns true if successful
+   static bool write(const DataFile* const source, const std::string& filename);
+
+protected:
+   bool isColumnStorageOwned() const override { return false; }
+   void clearData() override;
+
+private:
+   bool loadData() override;
+
+   void* view {};                      // Mapped file
+   std::size_t viewSize {};            // Size of the mapped file (bytes)
+};
+
+}
+}
+
+#endif
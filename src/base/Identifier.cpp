@@ -1,13 +1,45 @@
 
 #include "mixr/base/Identifier.hpp"
+#include "mixr/base/util/atomics.hpp"
+
 #include <cstring>
+#include <string>
+#include <unordered_set>
 
 namespace mixr {
 namespace base {
 
+//------------------------------------------------------------------------------
+// Global symbol table -- created on first use and never destroyed, so it's
+// safe to intern names from static constructors (e.g., slot tables).
+//------------------------------------------------------------------------------
+namespace {
+
+struct SymbolTable
+{
+   std::unordered_set<std::string> names;   // node based, so c_str() pointers are stable
+   long semaphore {};
+};
+
+SymbolTable& symbolTable()
+{
+   static SymbolTable* table {new SymbolTable()};
+   return *table;
+}
+
+const char* internKey(const std::string& key)
+{
+   SymbolTable& tbl {symbolTable()};
+   lock(tbl.semaphore);
+   const char* p {tbl.names.insert(key).first->c_str()};
+   unlock(tbl.semaphore);
+   return p;
+}
+
+}
+
 IMPLEMENT_SUBCLASS(Identifier, "Identifier")
 EMPTY_SLOTTABLE(Identifier)
-EMPTY_COPYDATA(Identifier)
 EMPTY_DELETEDATA(Identifier)
 
 Identifier::Identifier() : String()
@@ -21,6 +53,30 @@ Identifier::Identifier(const char* string) : String()
    setStr(string);
 }
 
+void Identifier::copyData(const Identifier& org, const bool)
+{
+   BaseClass::copyData(org);
+   sym = org.sym;
+}
+
+//------------------------------------------------------------------------------
+// intern() -- returns the unique symbol for 'name'
+//------------------------------------------------------------------------------
+const char* Identifier::intern(const char* const name)
+{
+   if (name == nullptr || name[0] == '\0') return nullptr;
+   return internKey(std::string(name));
+}
+
+//------------------------------------------------------------------------------
+// updateSymbol() -- intern our current text
+//------------------------------------------------------------------------------
+void Identifier::updateSymbol()
+{
+   if (isEmpty()) sym = nullptr;
+   else sym = internKey(std::string(getString()));
+}
+
 //------------------------------------------------------------------------------
 // Replace spaces with underscores, and then call our BaseClass::setStr()
 //------------------------------------------------------------------------------
@@ -45,6 +101,8 @@ void Identifier::setStr(const char* string)
    else {
       BaseClass::setStr(string);
    }
+
+   updateSymbol();
 }
 
 //------------------------------------------------------------------------------
@@ -71,6 +129,23 @@ void Identifier::catStr(const char* s)
    newStr[len] = '\0';
    BaseClass::catStr(newStr);
    delete[] newStr;
+
+   updateSymbol();
+}
+
+//------------------------------------------------------------------------------
+// Set a specific character (spaces are replaced) and re-intern
+//------------------------------------------------------------------------------
+void Identifier::setChar(const unsigned int index, const char c)
+{
+   BaseClass::setChar(index, (c == ' ' ? '_' : c));
+   updateSymbol();
+}
+
+void Identifier::empty()
+{
+   BaseClass::empty();
+   updateSymbol();
 }
 
 //------------------------------------------------------------------------------
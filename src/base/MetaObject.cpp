@@ -3,17 +3,102 @@
 
 #include "mixr/base/SlotTable.hpp"
 
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
 namespace mixr {
 namespace base {
 
+MetaObject* MetaObject::first {};
+
 MetaObject::MetaObject(
       const char* const cname,
       const char* const fname,
       const SlotTable* const slottbl,
-      const MetaObject* const metaobj
-   ) : slottable(slottbl), baseMetaObject(metaobj), class_name(cname), factory_name(fname)
-{}
+      const MetaObject* const metaobj,
+      const std::size_t sz
+   ) : slottable(slottbl), baseMetaObject(metaobj), class_name(cname), factory_name(fname), size(sz)
+{
+   // Meta-objects are static class members, so they're all
+   // created, and added to the list, during static initialization.
+   next = first;
+   first = this;
+}
 
+const MetaObject* MetaObject::getFirst()
+{
+   return first;
 }
+
+//------------------------------------------------------------------------------
+// getExactCount() -- number of live instances whose most derived class is
+//                    this class (our count less the counts of our subclasses)
+//------------------------------------------------------------------------------
+int MetaObject::getExactCount() const
+{
+   int n{count};
+   for (const MetaObject* p = first; p != nullptr; p = p->next) {
+      if (p->baseMetaObject == this) n -= p->count;
+   }
+   return n;
 }
 
+std::size_t MetaObject::getApproxBytes() const
+{
+   const int n{getExactCount()};
+   std::size_t bytes{(n > 0) ? static_cast<std::size_t>(n) * size : 0};
+   const long owned{ownedBytes};
+   if (owned > 0) bytes += static_cast<std::size_t>(owned);
+   return bytes;
+}
+
+//------------------------------------------------------------------------------
+// updateAllocationRates() -- computes the instances created per second by
+//                            each class over the last 'dt' seconds
+//------------------------------------------------------------------------------
+void MetaObject::updateAllocationRates(const double dt)
+{
+   for (MetaObject* p = first; p != nullptr; p = p->next) {
+      const int n{p->tc};
+      if (dt > 0.0) p->allocRate = static_cast<double>(n - p->lastTc) / dt;
+      p->lastTc = n;
+   }
+}
+
+//------------------------------------------------------------------------------
+// printStatistics() -- prints the instance and memory statistics of all
+//                      classes with live instances, largest first
+//------------------------------------------------------------------------------
+void MetaObject::printStatistics(std::ostream& sout)
+{
+   std::vector<const MetaObject*> list;
+   for (const MetaObject* p = first; p != nullptr; p = p->next) {
+      if (p->count > 0 || p->allocRate > 0.0) list.push_back(p);
+   }
+   std::sort(list.begin(), list.end(),
+      [](const MetaObject* a, const MetaObject* b) { return a->getApproxBytes() > b->getApproxBytes(); } );
+
+   const std::ios_base::fmtflags flags{sout.flags()};
+   const std::streamsize precision{sout.precision()};
+   std::size_t total{};
+   sout << std::left << std::setw(32) << "class" << std::right
+        << std::setw(10) << "live" << std::setw(10) << "exact" << std::setw(10) << "peak"
+        << std::setw(12) << "created" << std::setw(8) << "size" << std::setw(14) << "bytes"
+        << std::setw(12) << "allocs/sec" << std::endl;
+   for (const MetaObject* p : list) {
+      const std::size_t bytes{p->getApproxBytes()};
+      total += bytes;
+      sout << std::left << std::setw(32) << p->getFactoryName() << std::right
+           << std::setw(10) << p->count << std::setw(10) << p->getExactCount() << std::setw(10) << p->mc
+           << std::setw(12) << p->tc << std::setw(8) << p->size << std::setw(14) << bytes
+           << std::setw(12) << std::fixed << std::setprecision(1) << p->allocRate << std::endl;
+   }
+   sout << "total bytes: " << total << std::endl;
+   sout.flags(flags);
+   sout.precision(precision);
+}
+
+}
+}
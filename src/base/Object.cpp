@@ -1,5 +1,6 @@
 
 #include "mixr/base/Object.hpp"
+#include "mixr/base/Identifier.hpp"
 
 #include <cctype>
 #include <cstdlib>
@@ -12,7 +13,7 @@ namespace base {
 // ---
 // Class and object metadata
 // ---
-MetaObject Object::metaObject(typeid(Object).name(), "Object", &Object::slottable, nullptr);
+MetaObject Object::metaObject(typeid(Object).name(), "Object", &Object::slottable, nullptr, sizeof(Object));
 
 // ---
 // Object's SlotTable
@@ -145,6 +146,18 @@ int Object::slotName2Index(const char* const slotname) const
    return slotindex;
 }
 
+//------------------------------------------------------------------------------
+// slotName2Index() -- returns the index of the slot named by the interned
+//                     identifier 'slotname' (e.g., a Pair's slot name)
+//------------------------------------------------------------------------------
+int Object::slotName2Index(const Identifier& slotname) const
+{
+   // symbol compare, then fall back to the text for slot numbers (e.g., "12")
+   int slotindex {slotTable->index(slotname)};
+   if (slotindex <= 0) slotindex = slotName2Index(static_cast<const char*>(slotname));
+   return slotindex;
+}
+
 //------------------------------------------------------------------------------
 // setSlotByName() -- set the value of slot 'slotname' to 'obj'  Returns
 //                 true if the slot and object were processed; returns
@@ -161,6 +174,17 @@ bool Object::setSlotByName(const char* const slotname, Object* const obj)
     return ok;
 }
 
+bool Object::setSlotByName(const Identifier& slotname, Object* const obj)
+{
+    bool ok {};
+    if (obj == nullptr) return ok;
+    const int slotindex {slotName2Index(slotname)};
+    if (slotindex > 0) {
+        ok = setSlotByIndex(slotindex,obj);
+    }
+    return ok;
+}
+
 //------------------------------------------------------------------------------
 // slotIndex2Name() -- returns the name of the slot at 'slotindex'
 //------------------------------------------------------------------------------
@@ -49,11 +49,17 @@ const Pair* PairStream::findByType(const std::type_info& type) const
 //------------------------------------------------------------------------------
 Pair* PairStream::findByName(const char* const slotname)
 {
-    Pair* p = nullptr;
+    const PairStream* cThis = this;
+    return const_cast<Pair*>(cThis->findByName(slotname));
+}
+
+const Pair* PairStream::findByName(const char* const slotname) const
+{
+    const Pair* p = nullptr;
     if (slotname != nullptr) {
         const Item* item = getFirstItem();
         while (item != nullptr && p == nullptr) {
-            const auto pair = const_cast<Pair*>(static_cast<const Pair*>(item->getValue()));
+            const auto pair = static_cast<const Pair*>(item->getValue());
             if ( *(pair->slot()) == slotname ) p = pair;
             item = item->getNext();
         }
@@ -61,14 +67,26 @@ Pair* PairStream::findByName(const char* const slotname)
     return p;
 }
 
-const Pair* PairStream::findByName(const char* const slotname) const
+//------------------------------------------------------------------------------
+// findByName() -- find a Pair by an interned name
+//   -- the pair names were interned when the pairs were created, so they're
+//      matched by symbol (pointer) compare
+//------------------------------------------------------------------------------
+Pair* PairStream::findByName(const Identifier& slotname)
+{
+    const PairStream* cThis = this;
+    return const_cast<Pair*>(cThis->findByName(slotname));
+}
+
+const Pair* PairStream::findByName(const Identifier& slotname) const
 {
     const Pair* p = nullptr;
-    if (slotname != nullptr) {
+    const char* const sym = slotname.getSymbol();
+    if (sym != nullptr) {
         const Item* item = getFirstItem();
         while (item != nullptr && p == nullptr) {
             const auto pair = static_cast<const Pair*>(item->getValue());
-            if ( *(pair->slot()) == slotname ) p = pair;
+            if ( pair->slot()->getSymbol() == sym ) p = pair;
             item = item->getNext();
         }
     }
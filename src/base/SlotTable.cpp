@@ -1,5 +1,6 @@
 
 #include "mixr/base/SlotTable.hpp"
+#include "mixr/base/Identifier.hpp"
 #include <cstring>
 
 namespace mixr {
@@ -10,6 +11,7 @@ SlotTable::SlotTable(const char* s[], const int ns, const SlotTable& base)
    baseTable = const_cast<SlotTable*>(&base);
    slots1 = const_cast<char**>(s);
    nslots1 = ns;
+   initSymbols();
 }
 
 SlotTable::SlotTable(const char* s[], const int ns)
@@ -17,15 +19,31 @@ SlotTable::SlotTable(const char* s[], const int ns)
    baseTable = nullptr;
    slots1 = const_cast<char**>(s);
    nslots1 = ns;
+   initSymbols();
 }
 
 SlotTable::~SlotTable()
 {
+   if (syms1 != nullptr) delete[] syms1;
+   syms1 = nullptr;
    baseTable = nullptr;
    slots1 = nullptr;
    nslots1 = 0;
 }
 
+//------------------------------------------------------------------------------
+// initSymbols() -- intern our slot names
+//------------------------------------------------------------------------------
+void SlotTable::initSymbols()
+{
+   if (slots1 != nullptr && nslots1 > 0) {
+      syms1 = new const char*[nslots1];
+      for (int j = 0; j < nslots1; j++) {
+         syms1[j] = Identifier::intern(slots1[j]);
+      }
+   }
+}
+
 //------------------------------------------------------------------------------
 // n() -- returns the number of slots
 //------------------------------------------------------------------------------
@@ -89,6 +107,40 @@ int SlotTable::index(const char* const slotname) const
    return i;
 }
 
+//------------------------------------------------------------------------------
+// index() -- returns the index of the slot named 'slotname' (symbol compare)
+//------------------------------------------------------------------------------
+int SlotTable::index(const Identifier& slotname) const
+{
+   const char* const sym {slotname.getSymbol()};
+   if (sym == nullptr) return 0;
+   return indexBySymbol(sym);
 }
+
+int SlotTable::indexBySymbol(const char* const sym) const
+{
+   int i {};
+
+   // First, check our slot names
+   {
+      // search our table
+      int j {};
+      for (j = 0; j < nslots1; j++) {
+         if (syms1[j] == sym) break;
+      }
+      if (j < nslots1) {
+         // if we're here, we found a match
+         i = j;                                    // a) start with j
+         i++;                                      // b) make it one based
+         if (baseTable != nullptr) i += baseTable->n();  // c) add baseTable->n()
+      }
+   }
+
+   // Second, check our baseTable
+   if (i == 0 && baseTable != nullptr) i = baseTable->indexBySymbol(sym);
+
+   return i;
 }
 
+}
+}
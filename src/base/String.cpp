@@ -28,19 +28,24 @@ String::String(const char* s1, const char* s2)
    catStr(s2);
 }
 
-void String::copyData(const String& org, const bool cc)
+void String::copyData(const String& org, const bool)
 {
    BaseClass::copyData(org);
-   if (!cc && str != nullptr) delete[] str;
-   str = nullptr;
-   nn = 0;
-   n = 0;
+   freeStr();
    setStr(org);
 }
 
 void String::deleteData()
 {
-   if (str != nullptr) delete[] str;
+   freeStr();
+}
+
+//------------------------------------------------------------------------------
+// freeStr() -- release any heap memory and reset to a null string
+//------------------------------------------------------------------------------
+void String::freeStr()
+{
+   if (isHeapStr()) delete[] str;
    str = nullptr;
    nn = 0;
    n = 0;
@@ -48,9 +53,9 @@ void String::deleteData()
 
 void String::setString(const String& origStr, const std::size_t w, const Justify j)
 {
-   char sbuf[MAX_STRING_LENGTH+1] {};  // Source buffer
-   char dbuf[MAX_STRING_LENGTH+1] {};  // Destination buffer
-   const char* ss {sbuf};              // Pointer to source buffer
+   char srcBuf[MAX_STRING_LENGTH+1] {};  // Source buffer
+   char dbuf[MAX_STRING_LENGTH+1] {};    // Destination buffer
+   const char* ss {srcBuf};              // Pointer to source buffer
 
 
    // ---
@@ -71,11 +76,11 @@ void String::setString(const String& origStr, const std::size_t w, const Justify
    if (j != Justify::NONE) {
       // Justified:  copy without leading or trailing spaces
       const char* p {origStr};
-      char* q {sbuf};
+      char* q {srcBuf};
       while (*p != '\0' && *p == ' ') { p++; }
-      while (*p != '\0' && q <= &sbuf[MAX_STRING_LENGTH-1]) { *q++ = *p++; }
+      while (*p != '\0' && q <= &srcBuf[MAX_STRING_LENGTH-1]) { *q++ = *p++; }
       *q-- = '\0';
-      while (*q == ' ' && q >= sbuf) { *q-- = ' '; }
+      while (*q == ' ' && q >= srcBuf) { *q-- = ' '; }
    } else {
       // Not justified:  change our source buffer pointer to the orig string
       ss = origStr;
@@ -163,9 +168,16 @@ void String::setStr(const char* string)
    if (string != nullptr) {
       std::size_t l {std::strlen(string)};
       if (l >= nn || str == nullptr) {
-         if (str != nullptr) delete[] str;
-         nn = (l+1);
-         str = new char[nn];
+         if (isHeapStr()) delete[] str;
+         if (l < SSO_SIZE) {
+            // short strings live in our small string buffer
+            nn = SSO_SIZE;
+            str = sbuf;
+         }
+         else {
+            nn = (l+1);
+            str = new char[nn];
+         }
       }
       utStrcpy(str,nn,string);
       n = l;
@@ -198,7 +210,7 @@ void String::catStr(const char* s)
       nn = (l+1);
       str = new char[nn];
       utStrcpy(str,nn,t);
-      delete[] t;
+      if (t != sbuf) delete[] t;
    }
    utStrcat(str, nn, s);
    n = l;
@@ -0,0 +1,151 @@
+
+#include "mixr/base/TimerWheel.hpp"
+#include "mixr/base/Timers.hpp"
+#include "mixr/base/util/atomics.hpp"
+
+#include <cmath>
+
+namespace mixr {
+namespace base {
+
+const double TimerWheel::TICK {0.001};   // Wheel resolution (seconds)
+
+//------------------------------------------------------------------------------
+// advance() -- advance the clock and process the timers that have expired
+//------------------------------------------------------------------------------
+void TimerWheel::advance(const double dt)
+{
+   lock( semaphore );
+   clock += dt;
+   const auto target = static_cast<std::uint64_t>(clock / TICK);
+   while (tick < target) {
+      tick++;
+
+      // cascade the upper levels as the lower levels wrap around
+      const unsigned int idx {static_cast<unsigned int>(tick & (SLOTS - 1))};
+      if (idx == 0) {
+         unsigned int level {1};
+         while (level < LEVELS && (static_cast<unsigned int>(tick >> (level * SLOT_BITS)) & (SLOTS - 1)) == 0) {
+            cascade(level++);
+         }
+         if (level < LEVELS) cascade(level);
+      }
+
+      // collect the timers that expire on this tick
+      Timer* t {slots[0][idx]};
+      slots[0][idx] = nullptr;
+      while (t != nullptr) {
+         Timer* next {t->wNext};
+         t->wPrev = nullptr;
+         t->wNext = nullptr;
+         t->wSlot = nullptr;
+         nScheduled--;
+         t->ref();
+         expired.push_back(t);
+         t = next;
+      }
+   }
+   unlock( semaphore );
+
+   // process the expired timers outside of the lock, so their
+   // alarm callbacks can schedule or cancel other timers.
+   for (unsigned int i = 0; i < expired.size(); i++) {
+      expired[i]->alarmExpired();
+      expired[i]->unref();
+   }
+   expired.clear();
+}
+
+//------------------------------------------------------------------------------
+// schedule() -- schedule the timer's alarm 'delay' seconds from now
+//------------------------------------------------------------------------------
+void TimerWheel::schedule(Timer* const timer, const double delay)
+{
+   if (timer == nullptr || !std::isfinite(delay)) return;
+
+   // always at least one tick in the future, since this tick has already been processed
+   std::uint64_t expire {tick + 1};
+   const double when {std::ceil((clock + delay) / TICK)};
+   if (when > static_cast<double>(expire)) expire = static_cast<std::uint64_t>(when);
+
+   lock( semaphore );
+   if (timer->wSlot != nullptr) unlink(timer);
+   else nScheduled++;
+   timer->wExpire = expire;
+   insert(timer);
+   unlock( semaphore );
+}
+
+//------------------------------------------------------------------------------
+// cancel() -- cancel the timer's scheduled alarm
+//------------------------------------------------------------------------------
+void TimerWheel::cancel(Timer* const timer)
+{
+   if (timer == nullptr) return;
+
+   lock( semaphore );
+   if (timer->wSlot != nullptr) {
+      unlink(timer);
+      nScheduled--;
+   }
+   unlock( semaphore );
+}
+
+//------------------------------------------------------------------------------
+// insert() -- put the timer into its slot (semaphore must be held)
+//------------------------------------------------------------------------------
+void TimerWheel::insert(Timer* const timer)
+{
+   std::uint64_t expire {timer->wExpire};
+   const std::uint64_t delta {expire > tick ? (expire - tick) : 0};
+
+   // find the level
+   unsigned int level {};
+   while (level < (LEVELS - 1) && delta >= (static_cast<std::uint64_t>(1) << ((level + 1) * SLOT_BITS))) {
+      level++;
+   }
+
+   // beyond the span of the wheel? then park it in the last slot of the top level
+   const std::uint64_t span {static_cast<std::uint64_t>(1) << (LEVELS * SLOT_BITS)};
+   if (delta >= span) expire = tick + span - 1;
+
+   const unsigned int idx {static_cast<unsigned int>(expire >> (level * SLOT_BITS)) & (SLOTS - 1)};
+   Timer** const head {&slots[level][idx]};
+   timer->wPrev = nullptr;
+   timer->wNext = *head;
+   if (*head != nullptr) (*head)->wPrev = timer;
+   *head = timer;
+   timer->wSlot = head;
+}
+
+//------------------------------------------------------------------------------
+// unlink() -- remove the timer from its slot (semaphore must be held)
+//------------------------------------------------------------------------------
+void TimerWheel::unlink(Timer* const timer)
+{
+   if (timer->wPrev != nullptr) timer->wPrev->wNext = timer->wNext;
+   else *timer->wSlot = timer->wNext;
+   if (timer->wNext != nullptr) timer->wNext->wPrev = timer->wPrev;
+   timer->wPrev = nullptr;
+   timer->wNext = nullptr;
+   timer->wSlot = nullptr;
+}
+
+//------------------------------------------------------------------------------
+// cascade() -- move the timers in the current slot of 'level' down into the
+// lower levels (semaphore must be held)
+//------------------------------------------------------------------------------
+void TimerWheel::cascade(const unsigned int level)
+{
+   const unsigned int idx {static_cast<unsigned int>(tick >> (level * SLOT_BITS)) & (SLOTS - 1)};
+   Timer* t {slots[level][idx]};
+   slots[level][idx] = nullptr;
+   while (t != nullptr) {
+      Timer* next {t->wNext};
+      insert(t);
+      t = next;
+   }
+}
+
+}
+}
@@ -1,8 +1,9 @@
 
 #include "mixr/base/Timers.hpp"
+#include "mixr/base/TimerWheel.hpp"
+#include "mixr/base/Identifier.hpp"
 #include "mixr/base/numeric/Number.hpp"
 #include "mixr/base/units/Times.hpp"
-#include "mixr/base/util/atomics.hpp"
 
 namespace mixr {
 namespace base {
@@ -10,26 +11,25 @@ namespace base {
 IMPLEMENT_SUBCLASS(Timer, "Timer")
 
 bool Timer::frz {};                    // Freeze flag
-Timer* Timer::timers[MAX_TIMERS] {};   // List of timers
-unsigned int Timer::nTimers {};        // Number of timers in the list
-long Timer::semaphore {};              // Semaphore for the timer list
 
 BEGIN_SLOTTABLE(Timer)
    "timerValue",         // 1: Timer interval (default: 0)
    "alarmTime",          // 2: Alarm time (default: 0)
    "active",             // 3: Sets timer active (running) flag (default: false)
+   "wheel",              // 4: Timer wheel (i.e., update thread): TC or BG (default: TC)
 END_SLOTTABLE(Timer)
 
 BEGIN_SLOT_MAP(Timer)
    ON_SLOT(1, setSlotTimerValue,  Time)
    ON_SLOT(2, setSlotAlarmTime,   Time)
    ON_SLOT(3, setSlotTimerActive, Number)
+   ON_SLOT(4, setSlotWheel,       Identifier)
 END_SLOT_MAP()
 
 Timer::Timer()
 {
    STANDARD_CONSTRUCTOR()
-   addToTimerList(this);
+   refClock = wheelClock();
 }
 
 Timer::Timer(const Type direction, const double rtime)
@@ -39,43 +39,76 @@ Timer::Timer(const Type direction, const double rtime)
     timerValue = rtime;
     ctime  = rtime;
     dir = direction;
-
-    addToTimerList(this);
+    refClock = wheelClock();
 }
 
-void Timer::copyData(const Timer& org, const bool cc)
+void Timer::copyData(const Timer& org, const bool)
 {
-    active = false;
-
     BaseClass::copyData(org);
-    if (cc) { addToTimerList(this); }
 
+    getTimerWheel(wheel).cancel(this);
+
+    wheel = org.wheel;
     timerValue = org.timerValue;
-    ctime  = org.ctime;
+    ctime  = org.getCurrentTime();
+    refClock = wheelClock();
     alarmTime = org.alarmTime;
     dir = org.dir;
     active = org.active;
+
+    scheduleAlarm();
 }
 
 void Timer::deleteData()
 {
-   removeFromTimerList(this);
+   getTimerWheel(wheel).cancel(this);
+}
+
+// -----------------------------------------------------------------
+// Timer wheels: one for the TC thread and one for the BG thread.
+// (created on first use and never destroyed, so that static timers
+// can use them during static construction and destruction)
+// -----------------------------------------------------------------
+TimerWheel& Timer::getTimerWheel(const Wheel w)
+{
+   static TimerWheel* tcWheel {new TimerWheel()};
+   static TimerWheel* bgWheel {new TimerWheel()};
+   return (w == Wheel::BG ? *bgWheel : *tcWheel);
+}
+
+double Timer::wheelClock() const
+{
+   return getTimerWheel(wheel).getClock();
 }
 
 // -----------------------------------------------------------------
 // Support functions
 // -----------------------------------------------------------------
-void Timer::start()                          { active = true; }
-void Timer::stop()                           { active = false; }
+void Timer::start()                          { sync(); active = true; scheduleAlarm(); }
+void Timer::stop()                           { sync(); active = false; scheduleAlarm(); }
 void Timer::reset()                          { stop(); ctime = timerValue; }
 void Timer::reset(const double rtime)        { stop(); timerValue = rtime; reset(); }
 void Timer::restart()                        { reset(); start(); }
 void Timer::restart(const double rtime)      { reset(rtime); start(); }
-void Timer::update(const double dt)          { if (active && !frz) { ctime += (dir == Type::UP ? dt : -dt); } }
-bool Timer::alarm(const double atime)        { alarmTime = atime; return alarm(); }
-bool Timer::setCurrentTime(const double sec) { ctime = sec; return true; }
-bool Timer::setAlarmTime(const double sec)   { alarmTime = sec; return true; }
+bool Timer::setCurrentTime(const double sec) { ctime = sec; refClock = wheelClock(); scheduleAlarm(); return true; }
+bool Timer::setAlarmTime(const double sec)   { alarmTime = sec; scheduleAlarm(); return true; }
 bool Timer::setTimerValue(const double sec)  { timerValue = sec; return true; }
+void Timer::onAlarm()                        { }
+
+void Timer::update(const double dt)
+{
+    if (active && !frz) {
+       sync();
+       ctime += (dir == Type::UP ? dt : -dt);
+       scheduleAlarm();
+    }
+}
+
+bool Timer::alarm(const double atime)
+{
+    if (atime != alarmTime) setAlarmTime(atime);
+    return alarm();
+}
 
 bool Timer::freeze(const bool ff)
 {
@@ -86,68 +119,78 @@ bool Timer::freeze(const bool ff)
 
 bool Timer::alarm() const
 {
-    if (active) return dir == Type::UP ? (ctime >= alarmTime) : (ctime <= alarmTime);
+    if (active) {
+       const double t {getCurrentTime()};
+       return dir == Type::UP ? (t >= alarmTime) : (t <= alarmTime);
+    }
     else return false;
 }
 
-
 // -----------------------------------------------------------------
-// Update all timers in the list
+// Current value of this timer: the value at the last sync plus the
+// time that our wheel has run since then (if we're running).
 // -----------------------------------------------------------------
-void Timer::updateTimers(const double dt)
+double Timer::getCurrentTime() const
 {
-    if (!frz) {
-      lock( semaphore );
-      for (unsigned int i = 0; i < nTimers; i++) {
-         timers[i]->update(dt);
-      }
-      unlock( semaphore );
+    double t {ctime};
+    if (active) {
+       const double et {wheelClock() - refClock};
+       t += (dir == Type::UP ? et : -et);
     }
+    return t;
 }
 
+void Timer::sync()
+{
+    ctime = getCurrentTime();
+    refClock = wheelClock();
+}
+
+bool Timer::setWheel(const Wheel w)
+{
+    if (w != wheel) {
+       sync();
+       getTimerWheel(wheel).cancel(this);
+       wheel = w;
+       refClock = wheelClock();
+       scheduleAlarm();
+    }
+    return true;
+}
 
 // -----------------------------------------------------------------
-// Add a new timer to the list
+// Schedules our alarm with our wheel, or cancels it if we're not
+// running or the alarm time is already behind us.
 // -----------------------------------------------------------------
-void Timer::addToTimerList(Timer* timer)
+void Timer::scheduleAlarm()
 {
-   bool ok {};
-   lock( semaphore );
-   if (nTimers < MAX_TIMERS) {
-      timers[nTimers++] = timer;
-      ok = true;
-   }
-   unlock( semaphore );
-
-   if (!ok) {
-      std::cerr << "Timer::addToTimerList() ERROR failed to add a new timer to static timer list" << std::endl;
-   }
+    TimerWheel& tw {getTimerWheel(wheel)};
+    double delay {-1.0};
+    if (active) {
+       const double t {getCurrentTime()};
+       delay = (dir == Type::UP ? (alarmTime - t) : (t - alarmTime));
+    }
+    if (delay > 0.0) tw.schedule(this, delay);
+    else tw.cancel(this);
 }
 
-
 // -----------------------------------------------------------------
-// Remove a timer from the list
+// Called by our wheel when our alarm's tick has expired
 // -----------------------------------------------------------------
-void Timer::removeFromTimerList(Timer* timer)
+void Timer::alarmExpired()
 {
-   lock( semaphore );
-
-   // Find this timer in the list
-   unsigned int found {MAX_TIMERS};
-   for (unsigned int i = 0; i < nTimers && found == MAX_TIMERS; i++) {
-      if (timers[i] == timer) found = i;
-   }
-
-   // If found then remove it by moving all timer in the list that are
-   // beyond this timer down position
-   if (found != MAX_TIMERS) {
-      --nTimers;  // One less timer
-      for (unsigned int i = found; i < nTimers; i++) {
-         timers[i] = timers[i+1];
-      }
-   }
+    if (alarm()) onAlarm();
+    else scheduleAlarm();   // not quite there (round-off); try again
+}
 
-   unlock( semaphore );
+// -----------------------------------------------------------------
+// Update all timers on a wheel
+// -----------------------------------------------------------------
+void Timer::updateTimers(const double dt, const Wheel w)
+{
+    if (!frz) {
+       getTimerWheel(w).advance(dt);
+    }
 }
 
 // -----------------------------------------------------------------
@@ -181,12 +224,27 @@ bool Timer::setSlotTimerActive(const Number* const msg)
 {
    bool ok {};
    if (msg != nullptr) {
-      active = msg->getBoolean();
+      if (msg->getBoolean()) start();
+      else stop();
       ok = true;
    }
    return ok;
 }
 
+// Sets the timer wheel
+bool Timer::setSlotWheel(const Identifier* const msg)
+{
+   bool ok {};
+   if (msg != nullptr) {
+      if (*msg == "TC" || *msg == "tc") ok = setWheel(Wheel::TC);
+      else if (*msg == "BG" || *msg == "bg") ok = setWheel(Wheel::BG);
+      else {
+         std::cerr << "Timer::setSlotWheel(): invalid timer wheel: " << *msg << "; use TC or BG" << std::endl;
+      }
+   }
+   return ok;
+}
+
 //==============================================================================
 // Class UpTimer
 //==============================================================================
@@ -32,14 +32,8 @@ void Function::copyData(const Function& org, const bool cc)
    BaseClass::copyData(org);
    if (cc) table = nullptr;
 
-   {
-      const Table* copy{};
-      if (org.table != nullptr) {
-         copy = static_cast<const Table*>(org.table->clone());
-      }
-      setSlotLfiTable(copy);
-      if (copy != nullptr) copy->unref();
-   }
+   // the LFI table is immutable once loaded, so it's shared with the original
+   setSlotLfiTable(org.table);
 }
 
 void Function::deleteData()
@@ -102,5 +102,26 @@ bool doesFileExist(const char* const fullname)
    return result;
 }
 
+//------------
+// isCpuAvxSupported(), isCpuAvx2Supported() -- Returns true if the CPU
+// supports the AVX (or AVX2) instructions
+//------------
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+bool isCpuAvxSupported()
+{
+   __builtin_cpu_init();
+   return __builtin_cpu_supports("avx") != 0;
+}
+
+bool isCpuAvx2Supported()
+{
+   __builtin_cpu_init();
+   return __builtin_cpu_supports("avx2") != 0;
+}
+#else
+bool isCpuAvxSupported()   { return false; }
+bool isCpuAvx2Supported()  { return false; }
+#endif
+
 }
 }
@@ -6,6 +6,8 @@
 #include "mixr/models/system/Guns.hpp"
 
 #include "mixr/models/player/Player.hpp"
+#include "mixr/models/PlayerStateTable.hpp"
+#include "mixr/models/WorldModel.hpp"
 
 #include "mixr/simulation/Simulation.hpp"
 #include "mixr/simulation/Station.hpp"
@@ -466,9 +468,21 @@ void NetIO::updateOutputList()
          // Get the player list pointer (pre-ref()'d)
          base::PairStream* players = getSimulation()->getPlayers();
 
+         // The world's player state table (pre-ref()'d), if it's of this player list
+         const models::PlayerStateTable* states = nullptr;
+         const auto world = dynamic_cast<const models::WorldModel*>(getSimulation());
+         if (world != nullptr) {
+            states = world->getPlayerStateTable();
+            if (states != nullptr && states->getPlayers() != players) {
+               states->unref();
+               states = nullptr;
+            }
+         }
+
          // For all players
          bool finished = false;
          unsigned int newCount = 0;
+         unsigned int slot = 0;
          base::List::Item* playerItem = players->getFirstItem();
          while (playerItem != nullptr && !finished) {
 
@@ -476,8 +490,23 @@ void NetIO::updateOutputList()
             base::Pair* playerPair = static_cast<base::Pair*>(playerItem->getValue());
             models::Player* player = static_cast<models::Player*>(playerPair->object());
 
-            if (player->isLocalPlayer() || (isRelayEnabled() && player->getNetworkID() != getNetworkID()) )  {
-               if ( player->isActive() && player->isNetOutputEnabled()) {
+            // Player's state (the slots are the player list positions)
+            bool local, active, netOutput;
+            int networkID;
+            if (states != nullptr) {
+               local = states->isLocalPlayer(slot);
+               active = states->isActive(slot);
+               netOutput = states->isNetOutputEnabled(slot);
+               networkID = states->getNetworkID(slot);
+            } else {
+               local = player->isLocalPlayer();
+               active = player->isActive();
+               netOutput = player->isNetOutputEnabled();
+               networkID = player->getNetworkID();
+            }
+
+            if (local || (isRelayEnabled() && networkID != getNetworkID()) )  {
+               if ( active && netOutput ) {
 
                   // We have (1) an active local player to output or
                   //         (2) an active networked player to relay ...
@@ -503,8 +532,10 @@ void NetIO::updateOutputList()
 
             // get the next player
             playerItem = playerItem->getNext();
+            slot++;
          }
 
+         if (states != nullptr) states->unref();
          players->unref();
       }
 
@@ -790,40 +821,39 @@ bool NetIO::addNibToList(Nib* const nib, const IoType ioType)
 {
    bool ok = false;
    if (nib != nullptr) {
-      Nib** tbl = inputList.data();
-      int n = nInNibs;
-      if (ioType == OUTPUT_NIB) {
-         tbl = outputList.data();
-         n = nOutNibs;
-      }
-
-      if (n < MAX_OBJECTS) {
-
-         // Put the NIB on the top of the table
-         nib->ref();
-         tbl[n] = nib;
+      std::vector<Nib*>& list = (ioType == OUTPUT_NIB ? outputList : inputList);
+      const int n = (ioType == OUTPUT_NIB ? nOutNibs : nInNibs);
 
-         // Create a key for this new NIB
-         NibKey key(nib->getPlayerID(), nib->getFederateName());
-
-         if (n > 0) {
-            // Now, 'bubble down' to its correct position
-            int idx = n-1;
-            while (idx >= 0 && compareKey2Nib(&key, &tbl[idx]) <= 0) {
-               // Swap the table entries
-               Nib* tmp = tbl[idx];
-               tbl[idx] = tbl[idx+1];
-               tbl[idx+1] = tmp;
-               idx--;
-            }
+      // Grow the table as needed
+      if (static_cast<std::size_t>(n) >= list.size()) {
+         list.resize(n + 1, nullptr);
+      }
+      Nib** tbl = list.data();
+
+      // Put the NIB on the top of the table
+      nib->ref();
+      tbl[n] = nib;
+
+      // Create a key for this new NIB
+      NibKey key(nib->getPlayerID(), nib->getFederateName());
+
+      if (n > 0) {
+         // Now, 'bubble down' to its correct position
+         int idx = n-1;
+         while (idx >= 0 && compareKey2Nib(&key, &tbl[idx]) <= 0) {
+            // Swap the table entries
+            Nib* tmp = tbl[idx];
+            tbl[idx] = tbl[idx+1];
+            tbl[idx+1] = tmp;
+            idx--;
          }
+      }
 
-         // Increment the count
-         if (ioType == OUTPUT_NIB) nOutNibs++;
-         else nInNibs++;
+      // Increment the count
+      if (ioType == OUTPUT_NIB) nOutNibs++;
+      else nInNibs++;
 
-         ok = true;
-      }
+      ok = true;
    }
    return ok;
 }
@@ -883,8 +913,13 @@ int NetIO::compareKey2Nib(const void* key, const void* nib)
    else if (pKey->id < pNib->getPlayerID()) result = -1;
 
    if (result == 0) {
-      // If they're the same, compare the federate names
-      result = std::strcmp(*pKey->fName, *pNib->getFederateName());
+      // If they're the same, compare the federate names; NIBs normally share
+      // the federate name object (or its text), so check identity first.
+      const base::String* const kName {pKey->fName};
+      const base::String* const nName {pNib->getFederateName()};
+      if (kName != nName && kName->getString() != nName->getString()) {
+         result = std::strcmp(*kName, *nName);
+      }
    }
 
    return result;
@@ -13,7 +13,11 @@
 #include "mixr/base/functors/Table5.hpp"
 #include "mixr/base/List.hpp"
 #include "mixr/base/numeric/Number.hpp"
+#include "mixr/base/units/Angles.hpp"
 #include "mixr/base/units/Areas.hpp"
+#include "mixr/base/util/atomics.hpp"
+
+#include <cmath>
 
 namespace mixr {
 namespace models {
@@ -62,6 +66,8 @@ BEGIN_SLOTTABLE(AircraftIrSignature)
             // data - factor. We multiply the base plume signature by this
             // factor to get the plume energy in this particular waveband.
             // the different factors should all sum to 1.0  .
+   "aspectTolerance",
+            // aspect bin size of the signature cache (zero for no cache)
 
 END_SLOTTABLE(AircraftIrSignature)
 
@@ -72,6 +78,8 @@ BEGIN_SLOT_MAP(AircraftIrSignature)
    ON_SLOT(4,setSlotPlumeWavebandFactorTable,    base::Table2)
    ON_SLOT(5,setSlotHotPartsSignatureTable,      base::Table5)
    ON_SLOT(6,setSlotHotPartsWavebandFactorTable, base::Table2)
+   ON_SLOT(7,setSlotAspectTolerance,             base::Angle)   // Check for base::Angle before base::Number
+   ON_SLOT(7,setSlotAspectTolerance,             base::Number)
 END_SLOT_MAP()
 
 AircraftIrSignature::AircraftIrSignature()
@@ -83,55 +91,16 @@ void AircraftIrSignature::copyData(const AircraftIrSignature& org, const bool)
 {
     BaseClass::copyData(org);
 
-    if (org.airframeSignatureTable != nullptr) {
-        base::Table4* copy = org.airframeSignatureTable->clone();
-        setSlotAirframeSignatureTable( copy );
-        copy->unref();
-    } else {
-        setSlotAirframeSignatureTable(nullptr);
-    }
-
-    if (org.airframeWavebandFactorTable != nullptr) {
-        base::Table2* copy = org.airframeWavebandFactorTable->clone();
-        setSlotAirframeWavebandFactorTable( copy );
-        copy->unref();
-    } else {
-        setSlotAirframeWavebandFactorTable(nullptr);
-    }
+    // the signature tables are immutable once loaded, so they're shared with the original
+    setSlotAirframeSignatureTable(org.airframeSignatureTable);
+    setSlotAirframeWavebandFactorTable(org.airframeWavebandFactorTable);
+    setSlotPlumeSignatureTable(org.plumeSignatureTable);
+    setSlotPlumeWavebandFactorTable(org.plumeWavebandFactorTable);
+    setSlotHotPartsSignatureTable(org.hotPartsSignatureTable);
+    setSlotHotPartsWavebandFactorTable(org.hotPartsWavebandFactorTable);
 
-    if (org.plumeSignatureTable != nullptr) {
-        base::Table5* copy = org.plumeSignatureTable->clone();
-        setSlotPlumeSignatureTable( copy );
-        copy->unref();
-    } else {
-        setSlotPlumeSignatureTable(nullptr);
-    }
-
-    if (org.plumeWavebandFactorTable != nullptr) {
-        base::Table2* copy = org.plumeWavebandFactorTable->clone();
-        setSlotPlumeWavebandFactorTable( copy );
-        copy->unref();
-    } else {
-        setSlotPlumeWavebandFactorTable(nullptr);
-    }
-
-    if (org.hotPartsSignatureTable != nullptr) {
-        base::Table5* copy = org.hotPartsSignatureTable->clone();
-        setSlotHotPartsSignatureTable( copy );
-        copy->unref();
-    } else {
-        setSlotHotPartsSignatureTable(nullptr);
-    }
-
-    if (org.hotPartsWavebandFactorTable != nullptr) {
-        base::Table2* copy = org.hotPartsWavebandFactorTable->clone();
-        setSlotHotPartsWavebandFactorTable( copy );
-        copy->unref();
-    } else {
-        setSlotHotPartsWavebandFactorTable(nullptr);
-    }
-
-    BaseClass::copyData(org);
+    // same tolerance, but an empty cache
+    aspectTol = org.aspectTol;
 }
 
 void AircraftIrSignature::deleteData()
@@ -196,7 +165,7 @@ bool AircraftIrSignature::getIrSignature(IrQueryMsg* const msg)
         // if no projectedAreaInFOV, then target was not in FOV
         if (projectedAreaInFOV > 0.0){
             ok = true;
-            double* heatSignature{getHeatSignature(msg)};
+            double* heatSignature{(aspectTol > 0.0) ? getCachedHeatSignature(msg) : getHeatSignature(msg)};
             msg->setSignatureByWaveband(heatSignature);
             // FAB - set simple signature value
             msg->setSignatureAtRange(getCalculatedHeatSignature());
@@ -208,6 +177,133 @@ bool AircraftIrSignature::getIrSignature(IrQueryMsg* const msg)
     return ok;
 }
 
+//------------------------------------------------------------------------------
+// setAspectTolerance() -- aspect bin size of the signature cache
+//------------------------------------------------------------------------------
+bool AircraftIrSignature::setAspectTolerance(const double radians)
+{
+   bool ok{};
+   if (radians >= 0.0) {
+      base::lock(cacheLock);
+      aspectTol = radians;
+      cacheIndex.clear();
+      numCacheSigs = 0;
+      cacheTime = -1.0;
+      base::unlock(cacheLock);
+      ok = true;
+   }
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// getCachedHeatSignature() -- getHeatSignature() of the query's aspect bin,
+//                             computed once per frame
+//------------------------------------------------------------------------------
+double* AircraftIrSignature::getCachedHeatSignature(IrQueryMsg* const msg)
+{
+   const Player* target{msg->getTarget()};
+   if (target == nullptr) return getHeatSignature(msg);
+
+   double time{};
+   const WorldModel* sim{target->getWorldModel()};
+   if (sim != nullptr) time = sim->getExecTimeSec();
+
+   const double az{msg->getAzimuthAoi()};
+   const double el{msg->getElevationAoi()};
+
+   CacheKey key;
+   key.az = static_cast<long long>(std::floor(az / aspectTol));
+   key.el = static_cast<long long>(std::floor(el / aspectTol));
+   key.lower = msg->getLowerWavelength();
+   key.upper = msg->getUpperWavelength();
+
+   double* sig{};
+   base::lock(cacheLock);
+
+   // New frame: the cached signatures are reused for the new frame's keys
+   if (time != cacheTime) {
+      cacheTime = time;
+      cacheIndex.clear();
+      numCacheSigs = 0;
+   }
+
+   cacheLookups++;
+   const auto it = cacheIndex.find(key);
+   if (it != cacheIndex.end()) {
+      cacheHits++;
+      sig = cacheSigs[it->second].data();
+   } else {
+      // Signature at the center of the bin
+      msg->setAzimuthAoi( (static_cast<double>(key.az) + 0.5) * aspectTol );
+      msg->setElevationAoi( (static_cast<double>(key.el) + 0.5) * aspectTol );
+      const double* heatSignature{getHeatSignature(msg)};
+      msg->setAzimuthAoi(az);
+      msg->setElevationAoi(el);
+
+      if (numCacheSigs == cacheSigs.size()) cacheSigs.emplace_back();
+      std::vector<double>& sigs{cacheSigs[numCacheSigs]};
+      sigs.assign(heatSignature, heatSignature + getNumWaveBands() * 3);
+      cacheIndex[key] = numCacheSigs++;
+      sig = sigs.data();
+   }
+
+   base::unlock(cacheLock);
+   return sig;
+}
+
+bool AircraftIrSignature::CacheKey::operator<(const CacheKey& k) const
+{
+   if (az != k.az) return az < k.az;
+   if (el != k.el) return el < k.el;
+   if (lower != k.lower) return lower < k.lower;
+   return upper < k.upper;
+}
+
+//------------------------------------------------------------------------------
+// Signature cache statistics
+//------------------------------------------------------------------------------
+unsigned long AircraftIrSignature::getNumCacheLookups() const
+{
+   return cacheLookups;
+}
+
+unsigned long AircraftIrSignature::getNumCacheHits() const
+{
+   return cacheHits;
+}
+
+double AircraftIrSignature::getCacheHitRate() const
+{
+   return (cacheLookups > 0) ? (static_cast<double>(cacheHits) / static_cast<double>(cacheLookups)) : 0.0;
+}
+
+//------------------------------------------------------------------------------
+// setSlotAspectTolerance()
+//------------------------------------------------------------------------------
+bool AircraftIrSignature::setSlotAspectTolerance(const base::Angle* const msg)
+{
+   bool ok{};
+   if (msg != nullptr) {
+      ok = setAspectTolerance( base::Radians::convertStatic( *msg ) );
+      if (!ok) {
+         std::cerr << "AircraftIrSignature::setSlotAspectTolerance: Error setting aspect tolerance!" << std::endl;
+      }
+   }
+   return ok;
+}
+
+bool AircraftIrSignature::setSlotAspectTolerance(const base::Number* const msg)
+{
+   bool ok{};
+   if (msg != nullptr) {
+      ok = setAspectTolerance( msg->getDouble() );
+      if (!ok) {
+         std::cerr << "AircraftIrSignature::setSlotAspectTolerance: Error setting aspect tolerance!" << std::endl;
+      }
+   }
+   return ok;
+}
+
 //------------------------------------------------------------------------------
 // setSlotAirframeSignatureTable()
 //------------------------------------------------------------------------------
@@ -0,0 +1,112 @@
+
+#include "mixr/models/ElevationBatch.hpp"
+
+#include "mixr/models/player/Player.hpp"
+
+#include "mixr/terrain/Terrain.hpp"
+
+#include "mixr/base/List.hpp"
+#include "mixr/base/PairStream.hpp"
+#include "mixr/base/Pair.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace mixr {
+namespace models {
+
+IMPLEMENT_SUBCLASS(ElevationBatch, "ElevationBatch")
+EMPTY_SLOTTABLE(ElevationBatch)
+EMPTY_DELETEDATA(ElevationBatch)
+
+// Post cells per degree (three arc-second cells)
+static const double CELLS_PER_DEG{1200.0};
+
+ElevationBatch::ElevationBatch()
+{
+   STANDARD_CONSTRUCTOR()
+}
+
+void ElevationBatch::copyData(const ElevationBatch& org, const bool)
+{
+   BaseClass::copyData(org);
+
+   queries = org.queries;
+   plist = static_cast<const base::PairStream*>(org.plist);
+}
+
+//------------------------------------------------------------------------------
+// build() -- gathers and sorts the players' queries
+//------------------------------------------------------------------------------
+void ElevationBatch::build(base::PairStream* const list)
+{
+   plist = list;
+   queries.clear();
+
+   if (list == nullptr) return;
+
+   for (base::List::Item* item = list->getFirstItem(); item != nullptr; item = item->getNext()) {
+      const auto pair = static_cast<base::Pair*>(item->getValue());
+      const auto p = static_cast<Player*>(pair->object());
+
+      // Same players as Player::updateData() and Player::updateElevation()
+      const bool updated{p->isMode(Player::ACTIVE) || p->isMode(Player::PRE_RELEASE)};
+      if (updated && !p->isTerrainElevationRequired()) {
+         Query q;
+         q.player = p;
+         q.lat = p->getLatitude();
+         q.lon = p->getLongitude();
+         q.interp = p->isDtedTerrainInterpolationEnabled();
+         q.key = computeKey(q.lat, q.lon);
+         queries.push_back(q);
+      }
+   }
+
+   std::sort(queries.begin(), queries.end(),
+      [](const Query& a, const Query& b) { return a.key < b.key; }
+   );
+}
+
+//------------------------------------------------------------------------------
+// evaluate() -- looks up the elevations of part 'idx' of 'n' parts of the
+//               queries, and writes them back to their players
+//------------------------------------------------------------------------------
+void ElevationBatch::evaluate(const terrain::Terrain* const terrain, const unsigned int idx, const unsigned int n) const
+{
+   if (terrain == nullptr || idx == 0 || idx > n) return;
+
+   // Contiguous parts, so each part keeps its tiles and cells together
+   const std::size_t num{queries.size()};
+   const std::size_t first{num * (idx - 1) / n};
+   const std::size_t last{num * idx / n};
+
+   for (std::size_t i = first; i < last; i++) {
+      const Query& q{queries[i]};
+      double el{};
+      terrain->getElevation(&el, q.lat, q.lon, q.interp);
+      q.player->setTerrainElevation(el);
+   }
+}
+
+//------------------------------------------------------------------------------
+// computeKey() -- sort key: tile (one degree cell) then cell within the tile
+//------------------------------------------------------------------------------
+unsigned long long ElevationBatch::computeKey(const double lat, const double lon)
+{
+   const double tileLat{std::floor(lat)};
+   const double tileLon{std::floor(lon)};
+
+   // Tiles: [ 0 .. 180 ] and [ 0 .. 360 ]
+   const auto ilat = static_cast<unsigned long long>(std::min(std::max(tileLat + 90.0, 0.0), 180.0));
+   const auto ilon = static_cast<unsigned long long>(std::min(std::max(tileLon + 180.0, 0.0), 360.0));
+
+   // Cells: [ 0 .. 1199 ] (by column, west to east, then by row, south to
+   // north, which is the order that the posts are stored in)
+   const auto row = static_cast<unsigned long long>(std::min((lat - tileLat) * CELLS_PER_DEG, CELLS_PER_DEG - 1.0));
+   const auto col = static_cast<unsigned long long>(std::min((lon - tileLon) * CELLS_PER_DEG, CELLS_PER_DEG - 1.0));
+
+   return (ilat << 40) | (ilon << 24) | (col << 12) | row;
+}
+
+}
+}
@@ -0,0 +1,155 @@
+
+#include "mixr/models/GainPatternGrid.hpp"
+
+#include "mixr/base/functors/Func1.hpp"
+#include "mixr/base/functors/Func2.hpp"
+#include "mixr/base/units/Angles.hpp"
+#include "mixr/base/util/constants.hpp"
+
+#include <cmath>
+
+namespace mixr {
+namespace models {
+
+IMPLEMENT_SUBCLASS(GainPatternGrid, "GainPatternGrid")
+EMPTY_SLOTTABLE(GainPatternGrid)
+
+GainPatternGrid::GainPatternGrid()
+{
+   STANDARD_CONSTRUCTOR()
+}
+
+void GainPatternGrid::copyData(const GainPatternGrid& org, const bool)
+{
+   BaseClass::copyData(org);
+
+   metaObject.addOwnedBytes( org.gains.getNumBytes() - gains.getNumBytes() );
+
+   gains = org.gains;
+   twoD = org.twoD;
+   pattern = static_cast<const base::Function*>(org.pattern);
+   func1 = org.func1;
+   func2 = org.func2;
+   degrees = org.degrees;
+   resolution = org.resolution;
+   maxErr = org.maxErr;
+   maxErrAngle1 = org.maxErrAngle1;
+   maxErrAngle2 = org.maxErrAngle2;
+}
+
+void GainPatternGrid::deleteData()
+{
+   metaObject.addOwnedBytes( -gains.getNumBytes() );
+   gains.clear();
+   pattern = nullptr;
+}
+
+//------------------------------------------------------------------------------
+// build() -- samples the pattern at the grid's nodes and estimates the error
+//------------------------------------------------------------------------------
+bool GainPatternGrid::build(const base::Function* const p, const bool deg, const double res)
+{
+   metaObject.addOwnedBytes( -gains.getNumBytes() );
+   gains.clear();
+   pattern = p;
+   func1 = nullptr;
+   func2 = nullptr;
+   degrees = deg;
+   resolution = res;
+   maxErr = 0.0;
+   maxErrAngle1 = 0.0;
+   maxErrAngle2 = 0.0;
+
+   if (p == nullptr || res <= 0.0) return false;
+
+   func2 = dynamic_cast<const base::Func2*>(p);
+   if (func2 == nullptr) func1 = dynamic_cast<const base::Func1*>(p);
+   if (func1 == nullptr && func2 == nullptr) return false;
+   twoD = (func2 != nullptr);
+
+   // Axes: the full range of the angles (a single point elevation axis for 1D)
+   if (twoD) gains.set(-base::PI, base::PI, -base::PI / 2.0, base::PI / 2.0, res);
+   else gains.set(0.0, base::PI, 0.0, 0.0, res);
+   const UniformGrid::Axis& ax1 = gains.getAxis1();
+   const UniformGrid::Axis& ax2 = gains.getAxis2();
+
+   // ---
+   // Sample the nodes
+   // ---
+   for (unsigned int j = 0; j < ax2.n; j++) {
+      for (unsigned int i = 0; i < ax1.n; i++) {
+         gains.value(i, j) = std::pow(10.0, evaluate(ax1.node(i), ax2.node(j)) / 10.0);
+      }
+   }
+   metaObject.addOwnedBytes( gains.getNumBytes() );
+
+   // Worst-case error: sample halfway between the nodes
+   const unsigned int ns1{2 * ax1.n - 1};
+   const unsigned int ns2{twoD ? (2 * ax2.n - 1) : 1};
+   for (unsigned int j = 0; j < ns2; j++) {
+      for (unsigned int i = 0; i < ns1; i++) {
+         if ((i % 2) == 1 || (j % 2) == 1) {
+            checkError(ax1.lo + i * 0.5 * ax1.step, ax2.lo + j * 0.5 * ax2.step);
+         }
+      }
+   }
+
+   return true;
+}
+
+bool GainPatternGrid::isBuiltFrom(const base::Function* const p, const bool deg, const double res) const
+{
+   return isValid() && (pattern == p) && (degrees == deg) && (resolution == res);
+}
+
+//------------------------------------------------------------------------------
+// Lookups
+//------------------------------------------------------------------------------
+double GainPatternGrid::getGain(const double angle) const
+{
+   return gains.lookup(angle);
+}
+
+double GainPatternGrid::getGain(const double az, const double el) const
+{
+   return gains.lookup(az, el);
+}
+
+void GainPatternGrid::getGains(const double* const angles, double* const g, const unsigned int n) const
+{
+   for (unsigned int k = 0; k < n; k++) {
+      g[k] = getGain(angles[k]);
+   }
+}
+
+void GainPatternGrid::getGains(const double* const az, const double* const el, double* const g, const unsigned int n) const
+{
+   for (unsigned int k = 0; k < n; k++) {
+      g[k] = getGain(az[k], el[k]);
+   }
+}
+
+//------------------------------------------------------------------------------
+// Pattern's gain (dB) at the angles (radians)
+//------------------------------------------------------------------------------
+double GainPatternGrid::evaluate(const double a1, const double a2) const
+{
+   const double k{degrees ? base::angle::R2DCC : 1.0};
+   if (func2 != nullptr) return func2->f(a1 * k, a2 * k);
+   return func1->f(a1 * k);
+}
+
+void GainPatternGrid::checkError(const double a1, const double a2)
+{
+   const double exact{evaluate(a1, a2)};
+   const double grid{twoD ? getGain(a1, a2) : getGain(a1)};
+   const double err{std::fabs(10.0 * std::log10(grid) - exact)};
+   if (err > maxErr) {
+      maxErr = err;
+      maxErrAngle1 = a1;
+      maxErrAngle2 = a2;
+   }
+}
+
+}
+}
@@ -51,13 +51,8 @@ void IrSignature::copyData(const IrSignature& org, const bool)
    emissivity        = org.emissivity;
    effectiveArea     = org.effectiveArea;
 
-   if (org.waveBandTable != nullptr) {
-      base::Table1* copy{org.waveBandTable->clone()};
-      setSlotWaveBandSizes( copy );
-      copy->unref();
-   } else {
-      setSlotWaveBandSizes(nullptr);
-   }
+   // the waveband table is immutable once loaded, so it's shared with the original
+   setSlotWaveBandSizes(org.waveBandTable);
 
    if (org.irShapeSignature != nullptr) {
       IrShape* copy{org.irShapeSignature->clone()};
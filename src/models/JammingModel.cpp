@@ -0,0 +1,286 @@
+
+#include "mixr/models/JammingModel.hpp"
+
+#include "mixr/models/player/Player.hpp"
+#include "mixr/models/system/Antenna.hpp"
+#include "mixr/models/system/RfSystem.hpp"
+
+#include "mixr/base/units/Distances.hpp"
+#include "mixr/base/units/Frequencies.hpp"
+#include "mixr/base/util/atomics.hpp"
+#include "mixr/base/util/constants.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace mixr {
+namespace models {
+
+IMPLEMENT_SUBCLASS(JammingModel, "JammingModel")
+
+BEGIN_SLOTTABLE(JammingModel)
+   "cellSize",          // 1) Size of the jammers' spatial cells
+   "frequencyBand",     // 2) Width of the jammers' frequency bands
+END_SLOTTABLE(JammingModel)
+
+BEGIN_SLOT_MAP(JammingModel)
+   ON_SLOT(1, setSlotCellSize,      base::Distance)
+   ON_SLOT(2, setSlotFrequencyBand, base::Frequency)
+END_SLOT_MAP()
+
+JammingModel::JammingModel()
+{
+   STANDARD_CONSTRUCTOR()
+}
+
+void JammingModel::copyData(const JammingModel& org, const bool)
+{
+   BaseClass::copyData(org);
+
+   cellSize = org.cellSize;
+   freqBand = org.freqBand;
+
+   // The jammers are per frame
+   clear();
+}
+
+void JammingModel::deleteData()
+{
+   clear();
+}
+
+//------------------------------------------------------------------------------
+// Set functions
+//------------------------------------------------------------------------------
+bool JammingModel::setCellSize(const double meters)
+{
+   bool ok = false;
+   if (meters > 0.0) {
+      cellSize = meters;
+      ok = true;
+   }
+   return ok;
+}
+
+bool JammingModel::setFrequencyBand(const double hz)
+{
+   bool ok = false;
+   if (hz > 0.0) {
+      freqBand = hz;
+      ok = true;
+   }
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// addJammer() -- registers an active noise jammer for this frame
+//------------------------------------------------------------------------------
+void JammingModel::addJammer(const RfSystem* const jammer)
+{
+   if (jammer == nullptr) return;
+
+   const Player* own{jammer->getOwnship()};
+   const Antenna* ant{jammer->getAntenna()};
+   const double freq{jammer->getFrequency()};
+   const double bw{jammer->getBandwidth()};
+   if (own == nullptr || ant == nullptr || freq <= 0.0 || bw <= 0.0) return;
+
+   // The jammer's terms of the received signal (see RfSystem::computeReceivedSignal()),
+   // with the jammer's antenna at its peak 'gain' toward every receiver
+   const double lambda{base::LIGHTSPEED / freq};
+
+   Source s;
+   s.player = own;
+   s.pos = own->getPosition();
+   s.freqStart = freq - 0.5 * bw;
+   s.freqEnd = freq + 0.5 * bw;
+   s.strength = jammer->getPeakPower() * Antenna::getEffectiveArea(ant->getGain(), lambda) / bw;
+   s.loss = jammer->getRfTransmitLoss();
+   s.maxRange = ant->getMaxRange2PlayersOfInterest();
+   s.ix = static_cast<int>(std::floor(s.pos.x() / cellSize));
+   s.iy = static_cast<int>(std::floor(s.pos.y() / cellSize));
+   s.band = static_cast<int>(std::floor(freq / freqBand));
+
+   base::lock(pendingLock);
+   pending.push_back(s);
+   base::unlock(pendingLock);
+}
+
+//------------------------------------------------------------------------------
+// build() -- bins this frame's jammers
+//------------------------------------------------------------------------------
+void JammingModel::build()
+{
+   base::lock(pendingLock);
+   jammers.swap(pending);
+   pending.clear();
+   base::unlock(pendingLock);
+
+   bins.clear();
+   if (jammers.empty()) return;
+
+   std::sort(jammers.begin(), jammers.end(),
+      [](const Source& a, const Source& b) {
+         if (a.band != b.band) return a.band < b.band;
+         if (a.ix != b.ix) return a.ix < b.ix;
+         return a.iy < b.iy;
+      }
+   );
+
+   std::size_t i{};
+   while (i < jammers.size()) {
+      const Source& s0{jammers[i]};
+      Bin bin;
+      bin.ix = s0.ix;
+      bin.iy = s0.iy;
+      bin.first = i;
+      bin.freqStart = s0.freqStart;
+      bin.freqEnd = s0.freqEnd;
+      bin.maxRange = s0.maxRange;
+      bin.minLoss = s0.loss;
+
+      base::Vec3d sum;
+      base::Vec3d sumW;
+      double sumStrength{};
+      for ( ; i < jammers.size(); i++) {
+         const Source& s{jammers[i]};
+         if (s.band != s0.band || s.ix != s0.ix || s.iy != s0.iy) break;
+         sumStrength += s.strength;
+         if (s.loss > 0.0) bin.strength += s.strength / s.loss;
+         bin.minLoss = std::min(bin.minLoss, s.loss);
+         sum += s.pos;
+         sumW += s.pos * s.strength;
+         bin.freqStart = std::min(bin.freqStart, s.freqStart);
+         bin.freqEnd = std::max(bin.freqEnd, s.freqEnd);
+         if (bin.maxRange > 0.0) {
+            bin.maxRange = (s.maxRange > 0.0) ? std::max(bin.maxRange, s.maxRange) : 0.0;
+         }
+      }
+      bin.last = i;
+
+      const auto n = static_cast<double>(bin.last - bin.first);
+      bin.centroid = (sumStrength > 0.0) ? (sumW / sumStrength) : (sum / n);
+      bins.push_back(bin);
+   }
+}
+
+//------------------------------------------------------------------------------
+// clear() -- clears the jammers and bins
+//------------------------------------------------------------------------------
+void JammingModel::clear()
+{
+   base::lock(pendingLock);
+   pending.clear();
+   base::unlock(pendingLock);
+   jammers.clear();
+   bins.clear();
+}
+
+//------------------------------------------------------------------------------
+// getJamSignal() -- the receiver's summed noise jamming signal
+//------------------------------------------------------------------------------
+double JammingModel::getJamSignal(const RfSystem* const receiver) const
+{
+   if (receiver == nullptr || bins.empty()) return 0.0;
+
+   const Player* own{receiver->getOwnship()};
+   const Antenna* ant{receiver->getAntenna()};
+   if (own == nullptr || ant == nullptr) return 0.0;
+
+   const double sysFreq{receiver->getFrequency()};
+   const double sysBandwidth{receiver->getBandwidth()};
+   const double sysFreqStart{sysFreq - 0.5 * sysBandwidth};
+   const double sysFreqEnd{sysFreq + 0.5 * sysBandwidth};
+
+   const base::Vec3d& pos{own->getPosition()};
+   const int ix{static_cast<int>(std::floor(pos.x() / cellSize))};
+   const int iy{static_cast<int>(std::floor(pos.y() / cellSize))};
+
+   // A jammer's strength less the losses; as in RfSystem::computeReceivedSignal(),
+   // the jammer's transmit loss times our signal process loss is at least one
+   const double spLoss{receiver->getRfSignalProcessLoss()};
+   const auto lossy = [spLoss](const Source& s) {
+      double losses{spLoss * s.loss};
+      if (losses < 1.0) losses = 1.0;
+      return s.strength / losses;
+   };
+
+   // Summed jamming strength times range loss and our antenna's pattern gain
+   // toward the jammer (or toward the bin's centroid)
+   double sum{};
+   for (const Bin& bin : bins) {
+      if (bin.freqEnd < sysFreqStart || bin.freqStart > sysFreqEnd) continue;
+
+      const bool near{std::abs(bin.ix - ix) <= 1 && std::abs(bin.iy - iy) <= 1};
+      if (near) {
+         // Nearby jammers, one by one
+         for (std::size_t i = bin.first; i < bin.last; i++) {
+            const Source& s{jammers[i]};
+            if (s.player == own || s.freqEnd < sysFreqStart || s.freqStart > sysFreqEnd) continue;
+            const base::Vec3d los{s.pos - pos};
+            const double rng{los.length()};
+            if (s.maxRange > 0.0 && rng > s.maxRange) continue;
+            const double gain{(rng > 0.0) ? ant->getPatternGain(los / rng) : 1.0};
+            sum += lossy(s) * rangeLoss(rng) * gain;
+         }
+      }
+      else {
+         // Farther jammers, at the bin's centroid
+         const base::Vec3d los{bin.centroid - pos};
+         const double rng{los.length()};
+         if (bin.maxRange > 0.0 && rng > bin.maxRange) continue;
+         double strength{};
+         if (bin.freqStart >= sysFreqStart && bin.freqEnd <= sysFreqEnd && spLoss > 0.0 && (spLoss * bin.minLoss) >= 1.0) {
+            // All in band, and none of the losses are clamped
+            strength = bin.strength / spLoss;
+         }
+         else {
+            // The in-band jammers, one by one
+            for (std::size_t i = bin.first; i < bin.last; i++) {
+               const Source& s{jammers[i]};
+               if (s.freqEnd >= sysFreqStart && s.freqStart <= sysFreqEnd) strength += lossy(s);
+            }
+         }
+         const double gain{(rng > 0.0) ? ant->getPatternGain(los / rng) : 1.0};
+         sum += strength * rangeLoss(rng) * gain;
+      }
+   }
+
+   // Our antenna's gain and the ratio of our bandwidth to the jammers'
+   // (see RfSystem::computeReceivedSignal())
+   return sum * ant->getGain() * sysBandwidth;
+}
+
+//------------------------------------------------------------------------------
+// rangeLoss() -- one way range loss (same as Emission::setRange())
+//------------------------------------------------------------------------------
+double JammingModel::rangeLoss(const double range)
+{
+   double loss{1.0};
+   if (range > 1.0) loss = 1.0 / (4.0 * base::PI * range * range);
+   return loss;
+}
+
+//------------------------------------------------------------------------------
+// Slot functions
+//------------------------------------------------------------------------------
+bool JammingModel::setSlotCellSize(const base::Distance* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      ok = setCellSize( base::Meters::convertStatic(*msg) );
+   }
+   return ok;
+}
+
+bool JammingModel::setSlotFrequencyBand(const base::Frequency* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      ok = setFrequencyBand( base::Hertz::convertStatic(*msg) );
+   }
+   return ok;
+}
+
+}
+}
@@ -0,0 +1,331 @@
+
+#include "mixr/models/PlayerIndex.hpp"
+
+#include "mixr/models/player/Player.hpp"
+
+#include "mixr/base/List.hpp"
+#include "mixr/base/PairStream.hpp"
+#include "mixr/base/Pair.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace mixr {
+namespace models {
+
+IMPLEMENT_SUBCLASS(PlayerIndex, "PlayerIndex")
+EMPTY_SLOTTABLE(PlayerIndex)
+EMPTY_DELETEDATA(PlayerIndex)
+
+const double PlayerIndex::DEFAULT_CELL_SIZE{20000.0};   // meters
+
+// Relative range pad, so the index's squared range test never drops a player
+// that's exactly at the caller's range (rounding)
+static const double RANGE_TOLERANCE{1.0e-9};
+
+// Cell indices are packed, 21 bits each, into the cell keys
+static const int MAX_CELL_INDEX{(1 << 20) - 1};
+static const int CELL_INDEX_OFFSET{1 << 20};
+
+PlayerIndex::PlayerIndex()
+{
+   STANDARD_CONSTRUCTOR()
+   cellRadius = std::sqrt(3.0) * 0.5 * cellSize;
+}
+
+PlayerIndex::PlayerIndex(const double size)
+{
+   STANDARD_CONSTRUCTOR()
+   if (size > 0.0) cellSize = size;
+   cellRadius = std::sqrt(3.0) * 0.5 * cellSize;
+}
+
+void PlayerIndex::copyData(const PlayerIndex& org, const bool)
+{
+   BaseClass::copyData(org);
+
+   cellSize = org.cellSize;
+   cellRadius = org.cellRadius;
+   timeStamp = org.timeStamp;
+   maxSpeed = org.maxSpeed;
+   byOrder = org.byOrder;
+   geoc = org.geoc;
+   ned = org.ned;
+   plist = static_cast<const base::PairStream*>(org.plist);
+}
+
+//------------------------------------------------------------------------------
+// build() -- builds the index from the player list
+//------------------------------------------------------------------------------
+void PlayerIndex::build(base::PairStream* const list, const double time)
+{
+   byOrder.clear();
+   geoc.entries.clear();
+   ned.entries.clear();
+   timeStamp = time;
+   maxSpeed = 0.0;
+   plist = list;
+
+   if (list != nullptr) {
+      // ---
+      // The players' positions
+      // ---
+      byOrder.reserve(list->entries());
+      geoc.entries.reserve(list->entries());
+      ned.entries.reserve(list->entries());
+      unsigned int order{};
+      for (base::List::Item* item = list->getFirstItem(); item != nullptr; item = item->getNext()) {
+         const auto pair = static_cast<base::Pair*>(item->getValue());
+         const auto p = static_cast<Player*>(pair->object());
+         byOrder.push_back(p);
+
+         Entry e;
+         e.order = order++;
+         e.pos = p->getGeocPosition();
+         geoc.entries.push_back(e);
+         e.pos = p->getPosition();
+         ned.entries.push_back(e);
+
+         const double speed{std::max(p->getGeocVelocity().length(), p->getVelocity().length())};
+         if (speed > maxSpeed) maxSpeed = speed;
+      }
+   }
+
+   // ---
+   // Bin them
+   // ---
+   buildGrid(geoc);
+   buildGrid(ned);
+}
+
+//------------------------------------------------------------------------------
+// buildGrid() -- bins the grid's entries into its cells
+//------------------------------------------------------------------------------
+void PlayerIndex::buildGrid(Grid& grid) const
+{
+   std::vector<Entry>& entries{grid.entries};
+   std::vector<Cell>& cells{grid.cells};
+   cells.clear();
+
+   for (Entry& e : entries) {
+      e.key = computeKey(computeIndex(e.pos.x()), computeIndex(e.pos.y()), computeIndex(e.pos.z()));
+   }
+
+   // Sort by cell; the players in each cell stay in player list order
+   std::stable_sort(entries.begin(), entries.end(),
+      [](const Entry& a, const Entry& b) { return a.key < b.key; } );
+
+   // The occupied cells
+   const unsigned int n{static_cast<unsigned int>(entries.size())};
+   unsigned int i{};
+   while (i < n) {
+      Cell cell;
+      cell.key = entries[i].key;
+      cell.first = i;
+      const base::Vec3d& p{entries[i].pos};
+      cell.center.set( (computeIndex(p.x()) + 0.5) * cellSize,
+                       (computeIndex(p.y()) + 0.5) * cellSize,
+                       (computeIndex(p.z()) + 0.5) * cellSize );
+      while (i < n && entries[i].key == cell.key) i++;
+      cell.n = i - cell.first;
+      cells.push_back(cell);
+   }
+}
+
+//------------------------------------------------------------------------------
+// getMaxClosure() -- max distance that two players could have closed since
+//                    the index was built (both moving at the max speed)
+//------------------------------------------------------------------------------
+double PlayerIndex::getMaxClosure(const double time) const
+{
+   const double age{time - timeStamp};
+   return (age > 0.0) ? (2.0 * maxSpeed * age) : 0.0;
+}
+
+//------------------------------------------------------------------------------
+// Queries
+//------------------------------------------------------------------------------
+unsigned int PlayerIndex::findInRange(
+      const base::Vec3d& pos,
+      const double range,
+      const bool ecef,
+      std::vector<Player*>& list,
+      std::vector<unsigned int>& slots
+   ) const
+{
+   Query q;
+   q.pos = pos;
+   q.range = range;
+   return find((ecef ? geoc : ned), q, list, slots);
+}
+
+unsigned int PlayerIndex::findInCone(
+      const base::Vec3d& pos,
+      const base::Vec3d& dir,
+      const double angle,
+      const double range,
+      const bool ecef,
+      std::vector<Player*>& list,
+      std::vector<unsigned int>& slots
+   ) const
+{
+   Query q;
+   q.pos = pos;
+   q.dir = dir;
+   q.dir.normalize();
+   q.range = range;
+   q.angle = angle;
+   q.cosAngle = std::cos(angle);
+   q.cone = (angle < base::PI);
+   return find((ecef ? geoc : ned), q, list, slots);
+}
+
+unsigned int PlayerIndex::findPlayers(
+      const PlayerIndex* const index,
+      base::PairStream* const players,
+      const base::Vec3d& pos,
+      const double range,
+      const bool ecef,
+      const double time,
+      std::vector<Player*>& list,
+      std::vector<unsigned int>& slots
+   )
+{
+   if (players == nullptr) return 0;
+
+   if (index != nullptr && range > 0.0 && index->getPlayers() == players) {
+      const double r{range * (1.0 + RANGE_TOLERANCE) + index->getMaxClosure(time)};
+      return index->findInRange(pos, r, ecef, list, slots);
+   }
+
+   // No index -- all of the players
+   unsigned int n{};
+   for (base::List::Item* item = players->getFirstItem(); item != nullptr; item = item->getNext()) {
+      const auto pair = static_cast<base::Pair*>(item->getValue());
+      list.push_back(static_cast<Player*>(pair->object()));
+      slots.push_back(n);
+      n++;
+   }
+   return n;
+}
+
+unsigned int PlayerIndex::find(const Grid& grid, const Query& q, std::vector<Player*>& list, std::vector<unsigned int>& slots) const
+{
+   const std::vector<Entry>& entries{grid.entries};
+   const std::vector<Cell>& cells{grid.cells};
+
+   // The players found are gathered, by player list position, at the end of 'slots'
+   const std::size_t first{slots.size()};
+
+   // Tests the players of one cell
+   const auto testCell = [this, &q, &entries, &slots](const Cell& cell) {
+      if (cellPasses(q, cell)) {
+         for (unsigned int j = cell.first; j < (cell.first + cell.n); j++) {
+            if (entryPasses(q, entries[j])) slots.push_back(entries[j].order);
+         }
+      }
+   };
+
+   // Number of cells that overlap the query's range
+   double nprobes{static_cast<double>(cells.size()) + 1.0};
+   int i0[3]{};
+   int i1[3]{};
+   if (q.range > 0.0) {
+      nprobes = 1.0;
+      for (unsigned int k = 0; k < 3; k++) {
+         i0[k] = computeIndex(q.pos[k] - q.range);
+         i1[k] = computeIndex(q.pos[k] + q.range);
+         nprobes *= static_cast<double>(i1[k] - i0[k] + 1);
+      }
+   }
+
+   if (nprobes < static_cast<double>(cells.size())) {
+      // Probe the cells that overlap the range
+      for (int ix = i0[0]; ix <= i1[0]; ix++) {
+         for (int iy = i0[1]; iy <= i1[1]; iy++) {
+            for (int iz = i0[2]; iz <= i1[2]; iz++) {
+               const unsigned long long key{computeKey(ix, iy, iz)};
+               const auto it = std::lower_bound(cells.begin(), cells.end(), key,
+                  [](const Cell& c, const unsigned long long k) { return c.key < k; } );
+               if (it != cells.end() && it->key == key) testCell(*it);
+            }
+         }
+      }
+   } else {
+      // Scan the occupied cells
+      for (const Cell& cell : cells) {
+         testCell(cell);
+      }
+   }
+
+   // Return the players in player list order
+   std::sort(slots.begin() + first, slots.end());
+   for (std::size_t i = first; i < slots.size(); i++) {
+      list.push_back(byOrder[slots[i]]);
+   }
+   return static_cast<unsigned int>(slots.size() - first);
+}
+
+//------------------------------------------------------------------------------
+// cellPasses() -- returns true if the cell's bounding sphere overlaps the query
+//------------------------------------------------------------------------------
+bool PlayerIndex::cellPasses(const Query& q, const Cell& cell) const
+{
+   const base::Vec3d v{cell.center - q.pos};
+   const double d{v.length()};
+
+   // Range check
+   if (q.range > 0.0 && (d - cellRadius) > q.range) return false;
+
+   // Cone check: the angle to the center of the cell less the angular radius
+   // of its bounding sphere (the query's position isn't in the sphere)
+   if (q.cone && d > cellRadius) {
+      const double cosCtr{std::max(-1.0, std::min(1.0, (v * q.dir) / d))};
+      const double angCtr{std::acos(cosCtr)};
+      const double angRad{std::asin(cellRadius / d)};
+      if ((angCtr - angRad) > q.angle) return false;
+   }
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// entryPasses() -- returns true if the player's position passes the query
+//------------------------------------------------------------------------------
+bool PlayerIndex::entryPasses(const Query& q, const Entry& e) const
+{
+   const base::Vec3d v{e.pos - q.pos};
+   const double d2{v.length2()};
+
+   // Range check
+   if (q.range > 0.0 && d2 > (q.range * q.range)) return false;
+
+   // Cone check
+   if (q.cone && d2 > 0.0) {
+      if ((v * q.dir) < (std::sqrt(d2) * q.cosAngle)) return false;
+   }
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// Cell indices and keys
+//------------------------------------------------------------------------------
+int PlayerIndex::computeIndex(const double x) const
+{
+   const double i{std::floor(x / cellSize)};
+   if (i > MAX_CELL_INDEX) return MAX_CELL_INDEX;
+   if (i < -MAX_CELL_INDEX) return -MAX_CELL_INDEX;
+   return static_cast<int>(i);
+}
+
+unsigned long long PlayerIndex::computeKey(const int ix, const int iy, const int iz) const
+{
+   const auto kx = static_cast<unsigned long long>(ix + CELL_INDEX_OFFSET);
+   const auto ky = static_cast<unsigned long long>(iy + CELL_INDEX_OFFSET);
+   const auto kz = static_cast<unsigned long long>(iz + CELL_INDEX_OFFSET);
+   return (kx << 42) | (ky << 21) | kz;
+}
+
+}
+}
@@ -0,0 +1,183 @@
+
+#include "mixr/models/PlayerStateTable.hpp"
+
+#include "mixr/models/player/Player.hpp"
+
+#include "mixr/base/List.hpp"
+#include "mixr/base/PairStream.hpp"
+#include "mixr/base/Pair.hpp"
+
+#include <algorithm>
+
+namespace mixr {
+namespace models {
+
+IMPLEMENT_SUBCLASS(PlayerStateTable, "PlayerStateTable")
+EMPTY_SLOTTABLE(PlayerStateTable)
+EMPTY_DELETEDATA(PlayerStateTable)
+
+const unsigned int PlayerStateTable::INVALID_SLOT{0xFFFFFFFF};
+
+PlayerStateTable::PlayerStateTable()
+{
+   STANDARD_CONSTRUCTOR()
+}
+
+void PlayerStateTable::copyData(const PlayerStateTable& org, const bool)
+{
+   BaseClass::copyData(org);
+
+   n = org.n;
+   timeStamp = org.timeStamp;
+   data = org.data;
+   majorTypes = org.majorTypes;
+   modes = org.modes;
+   sides = org.sides;
+   flags = org.flags;
+   networkIDs = org.networkIDs;
+   players = org.players;
+   lookup = org.lookup;
+   plist = static_cast<const base::PairStream*>(org.plist);
+}
+
+//------------------------------------------------------------------------------
+// build() -- builds the table from the player list
+//------------------------------------------------------------------------------
+void PlayerStateTable::build(base::PairStream* const list, const double time)
+{
+   timeStamp = time;
+   plist = list;
+
+   n = (list != nullptr) ? list->entries() : 0;
+   data.resize(NUM_COLUMNS * n);
+   majorTypes.resize(n);
+   modes.resize(n);
+   sides.resize(n);
+   flags.resize(n);
+   networkIDs.resize(n);
+   players.resize(n);
+   lookup.resize(n);
+
+   if (list == nullptr) return;
+
+   unsigned int slot{};
+   for (base::List::Item* item = list->getFirstItem(); item != nullptr && slot < n; item = item->getNext()) {
+      const auto pair = static_cast<base::Pair*>(item->getValue());
+      const auto p = static_cast<Player*>(pair->object());
+
+      const base::Vec3d& gp{p->getGeocPosition()};
+      const base::Vec3d& gv{p->getGeocVelocity()};
+      const base::Vec3d& pos{p->getPosition()};
+      const base::Vec3d& vel{p->getVelocity()};
+      double* const col{data.data() + slot};
+      col[GEOC_POS_X * n] = gp.x();
+      col[GEOC_POS_Y * n] = gp.y();
+      col[GEOC_POS_Z * n] = gp.z();
+      col[GEOC_VEL_X * n] = gv.x();
+      col[GEOC_VEL_Y * n] = gv.y();
+      col[GEOC_VEL_Z * n] = gv.z();
+      col[POS_N * n] = pos.x();
+      col[POS_E * n] = pos.y();
+      col[POS_D * n] = pos.z();
+      col[VEL_N * n] = vel.x();
+      col[VEL_E * n] = vel.y();
+      col[VEL_D * n] = vel.z();
+      col[LATITUDE * n] = p->getLatitude();
+      col[LONGITUDE * n] = p->getLongitude();
+      col[ALTITUDE * n] = p->getAltitudeM();
+      setMat3(WM_00, slot, p->getWorldMat());
+      setMat3(RM_00, slot, p->getRotMat());
+
+      majorTypes[slot] = p->getMajorType();
+      modes[slot] = p->getMode();
+      sides[slot] = p->getSide();
+      networkIDs[slot] = p->getNetworkID();
+
+      unsigned int f{};
+      if (p->isActive()) f |= ACTIVE;
+      if (p->isLocalPlayer()) f |= LOCAL;
+      if (p->isPositionVectorValid()) f |= POSITION_VALID;
+      if (p->isNetOutputEnabled()) f |= NET_OUTPUT;
+      flags[slot] = f;
+
+      players[slot] = p;
+      lookup[slot] = std::make_pair(static_cast<const Player*>(p), slot);
+      slot++;
+   }
+
+   std::sort(lookup.begin(), lookup.end());
+}
+
+//------------------------------------------------------------------------------
+// findSlot() -- returns the player's slot or INVALID_SLOT
+//------------------------------------------------------------------------------
+unsigned int PlayerStateTable::findSlot(const Player* const player) const
+{
+   const auto it = std::lower_bound(lookup.begin(), lookup.end(), std::make_pair(player, 0u));
+   if (it != lookup.end() && it->first == player) return it->second;
+   return INVALID_SLOT;
+}
+
+//------------------------------------------------------------------------------
+// Single player vectors and matrices
+//------------------------------------------------------------------------------
+base::Vec3d PlayerStateTable::getGeocPosition(const unsigned int slot) const
+{
+   return getVec3(GEOC_POS_X, slot);
+}
+
+base::Vec3d PlayerStateTable::getGeocVelocity(const unsigned int slot) const
+{
+   return getVec3(GEOC_VEL_X, slot);
+}
+
+base::Vec3d PlayerStateTable::getPosition(const unsigned int slot) const
+{
+   return getVec3(POS_N, slot);
+}
+
+base::Vec3d PlayerStateTable::getVelocity(const unsigned int slot) const
+{
+   return getVec3(VEL_N, slot);
+}
+
+base::Matrixd PlayerStateTable::getWorldMat(const unsigned int slot) const
+{
+   return getMat3(WM_00, slot);
+}
+
+base::Matrixd PlayerStateTable::getRotMat(const unsigned int slot) const
+{
+   return getMat3(RM_00, slot);
+}
+
+base::Vec3d PlayerStateTable::getVec3(const Column c, const unsigned int slot) const
+{
+   const double* const col{data.data() + c * n + slot};
+   return base::Vec3d(col[0], col[n], col[2 * n]);
+}
+
+base::Matrixd PlayerStateTable::getMat3(const Column c, const unsigned int slot) const
+{
+   const double* const col{data.data() + c * n + slot};
+   base::Matrixd m;
+   for (unsigned int r = 0; r < 3; r++) {
+      for (unsigned int k = 0; k < 3; k++) {
+         m(r,k) = col[(r * 3 + k) * n];
+      }
+   }
+   return m;
+}
+
+void PlayerStateTable::setMat3(const Column c, const unsigned int slot, const base::Matrixd& m)
+{
+   double* const col{data.data() + c * n + slot};
+   for (unsigned int r = 0; r < 3; r++) {
+      for (unsigned int k = 0; k < 3; k++) {
+         col[(r * 3 + k) * n] = m(r,k);
+      }
+   }
+}
+
+}
+}
@@ -0,0 +1,134 @@
+
+#include "mixr/models/RcsGrid.hpp"
+
+#include "mixr/models/Signatures.hpp"
+
+#include "mixr/base/functors/Table2.hpp"
+#include "mixr/base/util/constants.hpp"
+
+#include <cmath>
+
+namespace mixr {
+namespace models {
+
+IMPLEMENT_SUBCLASS(RcsGrid, "RcsGrid")
+EMPTY_SLOTTABLE(RcsGrid)
+
+RcsGrid::RcsGrid()
+{
+   STANDARD_CONSTRUCTOR()
+}
+
+void RcsGrid::copyData(const RcsGrid& org, const bool)
+{
+   BaseClass::copyData(org);
+
+   metaObject.addOwnedBytes( org.values.getNumBytes() - values.getNumBytes() );
+
+   values = org.values;
+   table = static_cast<const base::Table2*>(org.table);
+   swapOrder = org.swapOrder;
+   degrees = org.degrees;
+   decibel = org.decibel;
+   resolution = org.resolution;
+   maxErr = org.maxErr;
+   maxErrAz = org.maxErrAz;
+   maxErrEl = org.maxErrEl;
+}
+
+void RcsGrid::deleteData()
+{
+   metaObject.addOwnedBytes( -values.getNumBytes() );
+   values.clear();
+   table = nullptr;
+}
+
+//------------------------------------------------------------------------------
+// build() -- samples the table at the grid's nodes and estimates the error
+//------------------------------------------------------------------------------
+bool RcsGrid::build(const SigAzEl* const sig, const double res)
+{
+   metaObject.addOwnedBytes( -values.getNumBytes() );
+   values.clear();
+   table = nullptr;
+   resolution = res;
+   maxErr = 0.0;
+   maxErrAz = 0.0;
+   maxErrEl = 0.0;
+
+   if (sig == nullptr || !sig->isTableValid() || res <= 0.0) return false;
+
+   table = sig->getTable();
+   swapOrder = sig->isOrderSwapped();
+   degrees = sig->isInDegrees();
+   decibel = sig->isDecibel();
+
+   // Axes: the full range of the angles of incidence
+   values.set(-base::PI, base::PI, -base::PI / 2.0, base::PI / 2.0, res);
+   const UniformGrid::Axis& azAxis = values.getAxis1();
+   const UniformGrid::Axis& elAxis = values.getAxis2();
+
+   // ---
+   // Sample the nodes
+   // ---
+   for (unsigned int j = 0; j < elAxis.n; j++) {
+      for (unsigned int i = 0; i < azAxis.n; i++) {
+         values.value(i, j) = sig->getTableRCS(azAxis.node(i), elAxis.node(j));
+      }
+   }
+   metaObject.addOwnedBytes( values.getNumBytes() );
+
+   // Worst-case error: sample halfway between the nodes
+   const unsigned int nsAz{2 * azAxis.n - 1};
+   const unsigned int nsEl{2 * elAxis.n - 1};
+   for (unsigned int j = 0; j < nsEl; j++) {
+      for (unsigned int i = 0; i < nsAz; i++) {
+         if ((i % 2) == 1 || (j % 2) == 1) {
+            checkError(sig, azAxis.lo + i * 0.5 * azAxis.step, elAxis.lo + j * 0.5 * elAxis.step);
+         }
+      }
+   }
+
+   return true;
+}
+
+bool RcsGrid::isBuiltFrom(const SigAzEl* const sig, const double res) const
+{
+   return isValid() && sig != nullptr && (table == sig->getTable()) && (resolution == res) &&
+          (swapOrder == sig->isOrderSwapped()) && (degrees == sig->isInDegrees()) && (decibel == sig->isDecibel());
+}
+
+//------------------------------------------------------------------------------
+// Lookups
+//------------------------------------------------------------------------------
+double RcsGrid::getRCS(const double az, const double el) const
+{
+   return values.lookup(az, el);
+}
+
+void RcsGrid::getRCS(const double* const az, const double* const el, double* const rcs, const unsigned int n) const
+{
+   for (unsigned int k = 0; k < n; k++) {
+      rcs[k] = getRCS(az[k], el[k]);
+   }
+}
+
+//------------------------------------------------------------------------------
+// checkError() -- error (dB) of the grid at the angles (radians)
+//------------------------------------------------------------------------------
+void RcsGrid::checkError(const SigAzEl* const sig, const double az, const double el)
+{
+   const double exact{sig->getTableRCS(az, el)};
+   const double grid{getRCS(az, el)};
+   if (exact > 0.0 && grid > 0.0) {
+      const double err{std::fabs(10.0 * std::log10(grid / exact))};
+      if (err > maxErr) {
+         maxErr = err;
+         maxErrAz = az;
+         maxErrEl = el;
+      }
+   }
+}
+
+}
+}
@@ -4,11 +4,13 @@
 #include "mixr/models/player/Player.hpp"
 
 #include "mixr/models/Emission.hpp"
+#include "mixr/models/RcsGrid.hpp"
 
 #include "mixr/base/Pair.hpp"
 #include "mixr/base/PairStream.hpp"
 #include "mixr/base/functors/Table2.hpp"
 
+#include "mixr/base/units/Angles.hpp"
 #include "mixr/base/units/Areas.hpp"
 #include "mixr/base/units/Decibel.hpp"
 #include "mixr/base/units/Distances.hpp"
@@ -401,6 +403,7 @@ BEGIN_SLOTTABLE(SigAzEl)
                         //    el are in degrees instead of the default radians
     "inDecibel",        // 4: True if the dependent data is in decibel meters
                         //    squared instead of the default meters squared
+    "gridResolution",   // 5: RCS grid's max node spacing (zero for no grid)
 END_SLOTTABLE(SigAzEl)
 
 BEGIN_SLOT_MAP(SigAzEl)
@@ -408,6 +411,8 @@ BEGIN_SLOT_MAP(SigAzEl)
     ON_SLOT(2, setSlotSwapOrder,    base::Number)
     ON_SLOT(3, setSlotInDegrees,    base::Number)
     ON_SLOT(4, setSlotDecibel,      base::Number)
+    ON_SLOT(5, setSlotGridResolution, base::Angle)   // Check for base::Angle before base::Number
+    ON_SLOT(5, setSlotGridResolution, base::Number)
 END_SLOT_MAP()
 
 SigAzEl::SigAzEl()
@@ -420,7 +425,8 @@ SigAzEl::SigAzEl(const base::Table2* const tbl0)
    STANDARD_CONSTRUCTOR()
 
    if (tbl0 != nullptr) {
-      tbl = tbl0->clone();
+      tbl = tbl0;
+      tbl->ref();
    }
 }
 
@@ -428,19 +434,58 @@ void SigAzEl::copyData(const SigAzEl& org, const bool)
 {
    BaseClass::copyData(org);
 
+   // the RCS table is immutable once loaded, so it's shared with the original
    if (tbl != nullptr) { tbl->unref(); tbl = nullptr; }
    if (org.tbl != nullptr) {
-      tbl = org.tbl->clone();
+      tbl = org.tbl;
+      tbl->ref();
    }
 
    swapOrderFlg = org.swapOrderFlg;
    degFlg = org.degFlg;
    dbFlg = org.dbFlg;
+
+   // the RCS grid is too
+   gridRes = org.gridRes;
+   grid = static_cast<const RcsGrid*>(org.grid);
 }
 
 void SigAzEl::deleteData()
 {
     if (tbl != nullptr) { tbl->unref(); tbl = nullptr; }
+    grid = nullptr;
+}
+
+//------------------------------------------------------------------------------
+// reset() -- compiles the table into the RCS grid
+//------------------------------------------------------------------------------
+void SigAzEl::reset()
+{
+   BaseClass::reset();
+
+   // (unless we already have, or share, its grid)
+   if (gridRes > 0.0 && isTableValid()) {
+      if (grid == nullptr || !grid->isBuiltFrom(this, gridRes)) {
+         const auto g = new RcsGrid();
+         if (g->build(this, gridRes)) {
+            grid = g;
+            if (isMessageEnabled(MSG_INFO)) {
+               std::cout << "SigAzEl::reset(): RCS grid: " << g->getNumPoints() << " points, ";
+               std::cout << (g->getResolution() * base::angle::R2DCC) << " deg resolution; max error ";
+               std::cout << g->getMaxError() << " dB at ( " << (g->getMaxErrorAzimuth() * base::angle::R2DCC);
+               std::cout << ", " << (g->getMaxErrorElevation() * base::angle::R2DCC) << " ) deg" << std::endl;
+            }
+         } else {
+            grid = nullptr;
+            if (isMessageEnabled(MSG_WARNING)) {
+               std::cerr << "SigAzEl::reset(): unable to build the RCS grid" << std::endl;
+            }
+         }
+         g->unref();
+      }
+   } else {
+      grid = nullptr;
+   }
 }
 
 //------------------------------------------------------------------------------
@@ -450,15 +495,32 @@ double SigAzEl::getRCS(const Emission* const em)
 {
    double rcs{};
    if (em != nullptr && tbl != nullptr) {
+      const RcsGrid* const g{grid};
+      if (g != nullptr) {
+         rcs = g->getRCS(em->getAzimuthAoi(), em->getElevationAoi());
+      } else {
+         rcs = getTableRCS(em->getAzimuthAoi(), em->getElevationAoi());
+      }
+   }
+   return rcs;
+}
+
+//------------------------------------------------------------------------------
+// getTableRCS() -- Get the RCS from the table
+//------------------------------------------------------------------------------
+double SigAzEl::getTableRCS(const double az, const double el) const
+{
+   double rcs{};
+   if (tbl != nullptr) {
 
       // angle of arrival (radians)
-      double iv1{em->getAzimuthAoi()};
-      double iv2{em->getElevationAoi()};
+      double iv1{az};
+      double iv2{el};
 
       // If the table's independent variable's order is swapped: (El, Az)
       if (isOrderSwapped()) {
-         iv1 = em->getElevationAoi();
-         iv2 = em->getAzimuthAoi();
+         iv1 = el;
+         iv2 = az;
       }
 
       // If the table's independent variables are in degrees ..
@@ -511,6 +573,16 @@ bool SigAzEl::setDecibel(const bool flg)
    return true;
 }
 
+bool SigAzEl::setGridResolution(const double radians)
+{
+   bool ok{};
+   if (radians >= 0.0) {
+      gridRes = radians;
+      ok = true;
+   }
+   return ok;
+}
+
 //------------------------------------------------------------------------------
 // Slot functions
 //------------------------------------------------------------------------------
@@ -555,5 +627,29 @@ bool SigAzEl::setSlotDecibel(const base::Number* const msg)
    return ok;
 }
 
+bool SigAzEl::setSlotGridResolution(const base::Angle* const msg)
+{
+   bool ok{};
+   if (msg != nullptr) {
+      ok = setGridResolution( base::Radians::convertStatic( *msg ) );
+      if (!ok) {
+         std::cerr << "SigAzEl::setSlotGridResolution: Error setting RCS grid resolution!" << std::endl;
+      }
+   }
+   return ok;
+}
+
+bool SigAzEl::setSlotGridResolution(const base::Number* const msg)
+{
+   bool ok{};
+   if (msg != nullptr) {
+      ok = setGridResolution( msg->getDouble() );
+      if (!ok) {
+         std::cerr << "SigAzEl::setSlotGridResolution: Error setting RCS grid resolution!" << std::endl;
+      }
+   }
+   return ok;
+}
+
 }
 }
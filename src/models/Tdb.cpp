@@ -2,10 +2,14 @@
 #include "mixr/models/Tdb.hpp"
 
 #include "mixr/models/player/Player.hpp"
+#include "mixr/models/PlayerIndex.hpp"
+#include "mixr/models/PlayerStateTable.hpp"
 #include "mixr/models/system/Gimbal.hpp"
 #include "mixr/models/WorldModel.hpp"
 
+#include "mixr/terrain/LosCache.hpp"
 #include "mixr/terrain/Terrain.hpp"
+#include "mixr/terrain/Viewshed.hpp"
 
 #include "mixr/base/List.hpp"
 #include "mixr/base/PairStream.hpp"
@@ -13,8 +17,16 @@
 
 #include "mixr/base/util/nav_utils.hpp"
 #include "mixr/base/util/osg_utils.hpp"
+#include "mixr/base/util/system_utils.hpp"
 
 #include <cmath>
+#include <memory>
+
+// AVX2 boresight kernels (compiled for AVX2, used when the CPU has it)
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MIXR_TDB_AVX2
+#include <immintrin.h>
+#endif
 
 namespace mixr {
 namespace models {
@@ -64,6 +76,7 @@ void Tdb::copyData(const Tdb& org, const bool)
       for (unsigned int i = 0; i < org.numTgts; i++) {
          org.targets[i]->ref();
          targets[i] = org.targets[i];
+         targetSlots[i] = org.targetSlots[i];
          ranges[i] = org.ranges[i];
          rngRates[i] = org.rngRates[i];
          losG[i] = org.losG[i];
@@ -102,68 +115,102 @@ void Tdb::clearArrays()
    } else {
       numTgts = 0;
    }
+   numOverflows = 0;
 }
 
 //------------------------------------------------------------------------------
-// Resize the target data arrays (0 .. Gimbal::MAX_PLAYERS)
+// Resize the target data arrays (sized by the gimbal's max players of interest)
 // -- old data is lost
 //------------------------------------------------------------------------------
 bool Tdb::resizeArrays(const unsigned int newSize)
 {
-   bool ok{};
-   if (newSize <= Gimbal::MAX_PLAYERS) {
-
-      // Clear out the old data
-      clearArrays();
-
-      if (newSize != maxTargets) {
-
-         // Free up the old memory
-         if (ranges   != nullptr)   { delete[] ranges;   ranges   = nullptr; }
-         if (rngRates != nullptr)   { delete[] rngRates; rngRates = nullptr; }
-         if (losG     != nullptr)   { delete[] losG;     losG     = nullptr; }
-         if (losO2T   != nullptr)   { delete[] losO2T;   losO2T   = nullptr; }
-         if (losT2O   != nullptr)   { delete[] losT2O;   losT2O   = nullptr; }
-         if (aar      != nullptr)   { delete[] aar;      aar      = nullptr; }
-         if (aazr     != nullptr)   { delete[] aazr;     aazr     = nullptr; }
-         if (aelr     != nullptr)   { delete[] aelr;     aelr     = nullptr; }
-
-         if (targets != nullptr)    { delete[] targets;  targets  = nullptr; }
-         maxTargets = 0;
-
-         if (xa  != nullptr)  { delete[] xa;  xa  = nullptr; }
-         if (ya  != nullptr)  { delete[] ya;  ya  = nullptr; }
-         if (za  != nullptr)  { delete[] za;  za  = nullptr; }
-         if (ra2 != nullptr)  { delete[] ra2; ra2 = nullptr; }
-         if (ra  != nullptr)  { delete[] ra;  ra  = nullptr; }
-
-         // Allocate new memory
-         if (newSize > 0) {
-            ranges   = new double[newSize];
-            rngRates = new double[newSize];
-            losG     = new base::Vec3d[newSize];
-            losO2T   = new base::Vec3d[newSize];
-            losT2O   = new base::Vec3d[newSize];
-            aar      = new double[newSize];
-            aazr     = new double[newSize];
-            aelr     = new double[newSize];
-            targets  = new Player*[newSize];
-            for (unsigned int i = 0; i < newSize; i++) {
-               targets[i] = nullptr;
-            }
-            maxTargets = newSize;
-            xa = new double[newSize];
-            ya = new double[newSize];
-            za = new double[newSize];
-            ra2 = new double[newSize];
-            ra = new double[newSize];
-         }
-
+   // Memory per target: ranges, rngRates, aar, aazr, aelr, xa, ya, za, ra2,
+   // ra, wx, wy, wz, vx, vy and vz, the three line-of-sight vectors, the
+   // target pointer and the target's slot; all of the sizes but the last are
+   // multiples of sizeof(double), so each array is aligned.
+   const std::size_t bytesPerTarget{ 16 * sizeof(double) + 3 * sizeof(base::Vec3d) + sizeof(Player*) + sizeof(unsigned int) };
+
+   // Clear out the old data
+   clearArrays();
+
+   if (newSize != maxTargets) {
+      metaObject.addOwnedBytes( -static_cast<long>(bytesPerTarget * maxTargets) );
+
+      // Free up the old memory block (the arrays hold trivially destructible types)
+      if (block != nullptr) { delete[] block; block = nullptr; }
+      ranges = nullptr;
+      rngRates = nullptr;
+      aar = nullptr;
+      aazr = nullptr;
+      aelr = nullptr;
+      xa = nullptr;
+      ya = nullptr;
+      za = nullptr;
+      ra2 = nullptr;
+      ra = nullptr;
+      wx = nullptr;
+      wy = nullptr;
+      wz = nullptr;
+      vx = nullptr;
+      vy = nullptr;
+      vz = nullptr;
+      losG = nullptr;
+      losO2T = nullptr;
+      losT2O = nullptr;
+      targets = nullptr;
+      targetSlots = nullptr;
+      maxTargets = 0;
+
+      // Allocate a new block and carve out the arrays
+      if (newSize > 0) {
+         block = new unsigned char[bytesPerTarget * newSize];
+         unsigned char* p{block};
+
+         const auto doubles = [&p, newSize]() {
+            const auto a = reinterpret_cast<double*>(p);
+            std::uninitialized_fill_n(a, newSize, 0.0);
+            p += newSize * sizeof(double);
+            return a;
+         };
+         const auto vectors = [&p, newSize]() {
+            const auto a = reinterpret_cast<base::Vec3d*>(p);
+            std::uninitialized_fill_n(a, newSize, base::Vec3d());
+            p += newSize * sizeof(base::Vec3d);
+            return a;
+         };
+
+         ranges   = doubles();
+         rngRates = doubles();
+         aar      = doubles();
+         aazr     = doubles();
+         aelr     = doubles();
+         xa       = doubles();
+         ya       = doubles();
+         za       = doubles();
+         ra2      = doubles();
+         ra       = doubles();
+         wx       = doubles();
+         wy       = doubles();
+         wz       = doubles();
+         vx       = doubles();
+         vy       = doubles();
+         vz       = doubles();
+         losG     = vectors();
+         losO2T   = vectors();
+         losT2O   = vectors();
+         targets  = reinterpret_cast<Player**>(p);
+         std::uninitialized_fill_n(targets, newSize, nullptr);
+         p += newSize * sizeof(Player*);
+         targetSlots = reinterpret_cast<unsigned int*>(p);
+         std::uninitialized_fill_n(targetSlots, newSize, PlayerStateTable::INVALID_SLOT);
+
+         maxTargets = newSize;
       }
+      metaObject.addOwnedBytes( static_cast<long>(bytesPerTarget * maxTargets) );
 
-      ok = true;
    }
-   return ok;
+
+   return true;
 }
 
 
@@ -175,6 +222,9 @@ bool Tdb::resizeArrays(const unsigned int newSize)
 //------------------------------------------------------------------------------
 unsigned int Tdb::processPlayers(base::PairStream* const players)
 {
+   // Start a new target list (this TDB may be reused)
+   clearArrays();
+
    // ---
    // Early out checks (no ownship, no players of interest, no target data arrays)
    // ---
@@ -183,10 +233,14 @@ unsigned int Tdb::processPlayers(base::PairStream* const players)
    // ---
    // Terrain occulting check setup
    // ---
+   const WorldModel* const sim{ownship->getWorldModel()};
    const terrain::Terrain* terrain{};
+   terrain::LosCache* losCache{};
+   const terrain::Viewshed* viewshed{};
    if (gimbal->isTerrainOccultingEnabled()) {
-      const WorldModel* const sim{ownship->getWorldModel()};
       terrain = sim->getTerrain();
+      losCache = sim->getTerrainLosCache();
+      viewshed = ownship->getViewshed();
    }
 
    // ---
@@ -245,6 +299,12 @@ unsigned int Tdb::processPlayers(base::PairStream* const players)
    const double osLon{ownship->getLongitude()};
    const double osAlt{ownship->getAltitudeM()};
 
+   // Our viewshed, if we're still where it was computed
+   if (viewshed != nullptr && !viewshed->isAt(osLat, osLon, osAlt)) {
+      viewshed->unref();
+      viewshed = nullptr;
+   }
+
    // If we're using ECEF coordinates then we compute the distance
    // to the earth horizon and the tangent of the angle from our
    // local level to the earth horizon
@@ -274,32 +334,72 @@ unsigned int Tdb::processPlayers(base::PairStream* const players)
    const bool osSpaceVehicle{ownship->isMajorType(Player::SPACE_VEHICLE)};
 
    // ---
-   // 1) Scan the player list ---
+   // 1) Scan the players that could be in range (from the world's player index),
+   //    using the world's player state table, if it's of the same player list
    // ---
+   std::vector<Player*>& candidates{candidateBuf};
+   std::vector<unsigned int>& slots{candidateSlotBuf};
+   candidates.clear();
+   slots.clear();
+   const PlayerStateTable* states{};
+   if (sim != nullptr) {
+      states = sim->getPlayerStateTable();
+      if (states != nullptr && states->getPlayers() != players) {
+         states->unref();
+         states = nullptr;
+      }
+      const PlayerIndex* index{sim->getPlayerIndex()};
+      PlayerIndex::findPlayers(index, players, p0, maxRange,
+                               usingEcefFlg, sim->getExecTimeSec(), candidates, slots);
+      if (index != nullptr) index->unref();
+   } else {
+      PlayerIndex::findPlayers(nullptr, players, p0, maxRange,
+                               usingEcefFlg, 0.0, candidates, slots);
+   }
+
    bool finished{};
-   for (base::List::Item* item = players->getFirstItem(); item != nullptr && numTgts < maxTargets && !finished; item = item->getNext()) {
+   for (unsigned int k = 0; k < candidates.size() && !finished; k++) {
 
       // Get the pointer to the target player
-      base::Pair* pair{static_cast<base::Pair*>(item->getValue())};
-      Player* target{static_cast<Player*>(pair->object())};
+      Player* target{candidates[k]};
+
+      // Target's state
+      const unsigned int slot{(states != nullptr) ? slots[k] : PlayerStateTable::INVALID_SLOT};
+      bool networked{}, active{}, typeMatch{}, posValid{};
+      if (states != nullptr) {
+         networked = states->isNetworkedPlayer(slot);
+         active = states->isActive(slot);
+         typeMatch = states->isMajorType(slot, mask);
+         posValid = states->isPositionVectorValid(slot);
+      } else {
+         networked = target->isNetworkedPlayer();
+         active = target->isActive();
+         typeMatch = target->isMajorType(mask);
+         posValid = target->isPositionVectorValid();
+      }
 
       // Did we complete the local only players?
-      finished = localOnly && target->isNetworkedPlayer();
+      finished = localOnly && networked;
 
       // We should process this target if ...
       const bool processTgt {
          !finished &&                                        // we're not finished AND
          target != ownship &&                                // its not our ownship AND
-         target->isActive() &&                               // the target is active AND
-         target->isMajorType(mask) &&                        // the target is one of the selected types AND
-         (usingEcefFlg || target->isPositionVectorValid())}; // we're using ECEF or the target's position vector is valid
+         active &&                                           // the target is active AND
+         typeMatch &&                                        // the target is one of the selected types AND
+         (usingEcefFlg || posValid)};                        // we're using ECEF or the target's position vector is valid
 
       if ( processTgt ) {
 
          // Target Line-Of-Sight (LOS) vector
          base::Vec3d tlos;
-         if (usingEcefFlg) tlos = target->getGeocPosition() - p0;
-         else tlos = target->getPosition() - p0;
+         if (states != nullptr) {
+            if (usingEcefFlg) tlos = states->getGeocPosition(slot) - p0;
+            else tlos = states->getPosition(slot) - p0;
+         } else {
+            if (usingEcefFlg) tlos = target->getGeocPosition() - p0;
+            else tlos = target->getPosition() - p0;
+         }
 
          // Normalized and compute length: unit LOS vector and range (meters)
          const double range{tlos.normalize()};
@@ -351,12 +451,22 @@ unsigned int Tdb::processPlayers(base::PairStream* const players)
                   bool occulted{};
                   if (terrain != nullptr && !osSpaceVehicle) {
 
-                     const double tgtLat{target->getLatitude()};
-                     const double tgtLon{target->getLongitude()};
-                     const double tgtAlt{target->getAltitudeM()};
+                     double tgtLat{}, tgtLon{}, tgtAlt{};
+                     bool tgtSpaceVehicle{};
+                     if (states != nullptr) {
+                        tgtLat = states->get(PlayerStateTable::LATITUDE, slot);
+                        tgtLon = states->get(PlayerStateTable::LONGITUDE, slot);
+                        tgtAlt = states->get(PlayerStateTable::ALTITUDE, slot);
+                        tgtSpaceVehicle = states->isMajorType(slot, Player::SPACE_VEHICLE);
+                     } else {
+                        tgtLat = target->getLatitude();
+                        tgtLon = target->getLongitude();
+                        tgtAlt = target->getAltitudeM();
+                        tgtSpaceVehicle = target->isMajorType(Player::SPACE_VEHICLE);
+                     }
 
                      // Is the target a space vehicle?
-                     if ( target->isMajorType(Player::SPACE_VEHICLE) ) {
+                     if ( tgtSpaceVehicle ) {
                         // Get the true, great-circle bearing to the target
                         double tbrg{}, distNM{};
                         base::nav::vll2bd(osLat, osLon, tgtLat, tgtLon, &tbrg, &distNM);
@@ -367,18 +477,35 @@ unsigned int Tdb::processPlayers(base::PairStream* const players)
                         // Terrain occulting check toward the space vehicle
                         occulted = terrain->targetOcculting2(osLat, osLon, osAlt, tbrg, dist, -tanTgtAng);
                      } else {
-                        // Occulting check between two standard player
-                        occulted = terrain->targetOcculting(osLat, osLon, static_cast<double>(osAlt),
-                                                            tgtLat, tgtLon, static_cast<double>(tgtAlt));
+                        // Occulting check between two standard player: using our viewshed,
+                        // if the target is within it, or cached, if we have a cache
+                        bool checked{};
+                        if (viewshed != nullptr) {
+                           checked = viewshed->targetOcculting(&occulted, tgtLat, tgtLon, tgtAlt);
+                        }
+                        if (!checked && losCache != nullptr) {
+                           occulted = losCache->targetOcculting(terrain, osLat, osLon, static_cast<double>(osAlt),
+                                                                tgtLat, tgtLon, static_cast<double>(tgtAlt),
+                                                                sim->getExecTimeSec());
+                        } else if (!checked) {
+                           occulted = terrain->targetOcculting(osLat, osLon, static_cast<double>(osAlt),
+                                                               tgtLat, tgtLon, static_cast<double>(tgtAlt));
+                        }
                      }
                   }
 
                   if (!occulted) {
                      // !!! All is well with this target !!!
 
-                     // Ref() and save the target pointer
-                     target->ref();
-                     targets[numTgts++] = target;
+                     if (numTgts < maxTargets) {
+                        // Ref() and save the target pointer and its slot
+                        target->ref();
+                        targetSlots[numTgts] = slot;
+                        targets[numTgts++] = target;
+                     } else {
+                        // No room -- count it, so the arrays can be sized
+                        numOverflows++;
+                     }
                   }
                }
             }
@@ -386,6 +513,9 @@ unsigned int Tdb::processPlayers(base::PairStream* const players)
       }
    }
 
+   if (states != nullptr) states->unref();
+   if (viewshed != nullptr) viewshed->unref();
+
    return numTgts;
 }
 
@@ -408,17 +538,24 @@ unsigned int Tdb::computeBoresightData()
    // ownship rotational matrix is used.
    const bool ownHdgOnly{gimbal->isUsingHeadingOnly()};
 
+   // The world's player state table, if any; a target's state is from
+   // the table if its slot (from processPlayers()) is still valid
+   const WorldModel* const sim{ownship->getWorldModel()};
+   const PlayerStateTable* const states{(sim != nullptr) ? sim->getPlayerStateTable() : nullptr};
+   const auto inTable = [this, states](const unsigned int i) {
+      const unsigned int slot{targetSlots[i]};
+      return states != nullptr && slot < states->getNumPlayers() && states->getPlayer(slot) == targets[i];
+   };
+
    // ---
-   // Compute normalized LOS vector (NED), range and ranging rate
+   // 1) Gather the target LOS vectors and relative velocities (ECEF or
+   //    local gaming area NED) into the work arrays
    // ---
    {
       // Vectors (ECEF or local gaming area NED)
       base::Vec3d p0;  // Position Vector
       base::Vec3d v0;  // Velocity vector [ x y z ] (meters/second)
 
-      // World (ECEF) to local tanget plane (NED)
-      base::Matrixd wm{ownship->getWorldMat()};
-
       if (usingEcefFlg) {
          // Using ECEF
          p0 = ownship->getGeocPosition();  // Geocentric position (ECEF)
@@ -430,50 +567,66 @@ unsigned int Tdb::computeBoresightData()
       }
 
       for (unsigned int i = 0; i < numTgts; i++) {
-
-         // Target vectors (ECEF or local gaming area NED)
-         base::Vec3d pt;  // Position Vector
-         base::Vec3d vt;  // Velocity vector [ x y z ] (meters/second)
-         if (usingEcefFlg) {
-            // Using ECEF
-            pt = targets[i]->getGeocPosition();  // Geocentric position (ECEF)
-            vt = targets[i]->getGeocVelocity();  // Geocentric (ECEF) velocity vector [ x y z ] (meters/second)
+         if (inTable(i)) {
+            const unsigned int slot{targetSlots[i]};
+            const PlayerStateTable::Column pc{usingEcefFlg ? PlayerStateTable::GEOC_POS_X : PlayerStateTable::POS_N};
+            const PlayerStateTable::Column vc{usingEcefFlg ? PlayerStateTable::GEOC_VEL_X : PlayerStateTable::VEL_N};
+            wx[i] = states->get(pc, slot) - p0.x();
+            wy[i] = states->get(PlayerStateTable::Column(pc + 1), slot) - p0.y();
+            wz[i] = states->get(PlayerStateTable::Column(pc + 2), slot) - p0.z();
+            vx[i] = states->get(vc, slot) - v0.x();
+            vy[i] = states->get(PlayerStateTable::Column(vc + 1), slot) - v0.y();
+            vz[i] = states->get(PlayerStateTable::Column(vc + 2), slot) - v0.z();
+         } else if (usingEcefFlg) {
+            const base::Vec3d& pt{targets[i]->getGeocPosition()};
+            const base::Vec3d& vt{targets[i]->getGeocVelocity()};
+            wx[i] = pt.x() - p0.x();   wy[i] = pt.y() - p0.y();   wz[i] = pt.z() - p0.z();
+            vx[i] = vt.x() - v0.x();   vy[i] = vt.y() - v0.y();   vz[i] = vt.z() - v0.z();
          } else {
-            // Using local gaming area positions
-            pt = targets[i]->getPosition();  // Local gaming area position vector (NED)
-            vt = targets[i]->getVelocity();  // Local gaming area velocity vector (NED)
+            const base::Vec3d& pt{targets[i]->getPosition()};
+            const base::Vec3d& vt{targets[i]->getVelocity()};
+            wx[i] = pt.x() - p0.x();   wy[i] = pt.y() - p0.y();   wz[i] = pt.z() - p0.z();
+            vx[i] = vt.x() - v0.x();   vy[i] = vt.y() - v0.y();   vz[i] = vt.z() - v0.z();
          }
+      }
+   }
 
-         // Target LOS vector
-         base::Vec3d los{pt - p0};
-
-         // Normalized and compute length [unit vector and range(meters)]
-         ranges[i] = los.normalize();
-
-         // Computer range rate (meters/sec)
-         rngRates[i] = ( (vt - v0) * los );
+   // ---
+   // 2) Normalize the LOS vectors, and compute the ranges and range rates
+   // ---
+   normalizeLos(numTgts, wx, wy, wz, vx, vy, vz, ranges, rngRates);
 
-         // Save the LOS vectors (own to tgt) and (tgt back to own)
-         if (usingEcefFlg) {
-            // Rotate the LOS vectors into their local tangent planes
-            losO2T[i] = wm * los;
-            losT2O[i] = targets[i]->getWorldMat() * (-los);
-         } else {
-            losO2T[i] =  los;
-            losT2O[i] = -los;
-         }
+   // ---
+   // 3) Ownship to target LOS vectors (ownship's NED) and target to
+   //    ownship LOS vectors (target's NED)
+   // ---
+   const double* nx{wx};
+   const double* ny{wy};
+   const double* nz{wz};
+   if (usingEcefFlg) {
+      // Rotate the LOS vectors into the ownship's local tangent plane;
+      // the relative velocities are no longer needed, so reuse their arrays
+      transformLos(numTgts, ownship->getWorldMat(), wx, wy, wz, vx, vy, vz);
+      nx = vx;
+      ny = vy;
+      nz = vz;
+      for (unsigned int i = 0; i < numTgts; i++) {
+         losO2T[i].set(nx[i], ny[i], nz[i]);
+         const base::Vec3d los(-wx[i], -wy[i], -wz[i]);
+         if (inTable(i)) losT2O[i] = states->getWorldMat(targetSlots[i]) * los;
+         else losT2O[i] = targets[i]->getWorldMat() * los;
+      }
+   } else {
+      for (unsigned int i = 0; i < numTgts; i++) {
+         losO2T[i].set( wx[i],  wy[i],  wz[i]);
+         losT2O[i].set(-wx[i], -wy[i], -wz[i]);
       }
-
    }
 
    // ---
-   // Transform LOS vectors to antenna coordinates
+   // 4) Transform LOS vectors to antenna coordinates
    // ---
    {
-      // ---
-      // 1) Create the transformation matrix, 'mm'
-      // ---
-
       // Start with the body to gimbal matrix
       base::Matrixd mm{gimbal->getRotMat()};
 
@@ -488,21 +641,20 @@ unsigned int Tdb::computeBoresightData()
          mm *= ownship->getRotMat();
       }
 
-      // ---
-      // 2) Transform the ownship to target LOS vector into gimbal coordinate system
-      //       losG = mm * losO2T;
-      // ---
-      base::postMultVec3Array(losO2T, mm, losG, numTgts);
+      // losG = mm * losO2T
+      transformLos(numTgts, mm, nx, ny, nz, xa, ya, za);
    }
 
    // ---
-   // Get gimbal coordinate component arrays and x-y range squared
+   // Save the gimbal LOS vectors, and get the gimbal coordinate component
+   // arrays (z positive up) and the x-y range squared
    // ---
    for (unsigned int i = 0; i < numTgts; i++) {
-         xa[i] = losG[i].x();
-         ya[i] = losG[i].y();
-         za[i] = -losG[i].z();
-         ra2[i] = xa[i]*xa[i] + ya[i]*ya[i];
+      losG[i].set(xa[i], ya[i], za[i]);
+   }
+   for (unsigned int i = 0; i < numTgts; i++) {
+      za[i] = -za[i];
+      ra2[i] = xa[i]*xa[i] + ya[i]*ya[i];
    }
 
    // ---
@@ -525,9 +677,174 @@ unsigned int Tdb::computeBoresightData()
    // ---
    base::atan2Array(za,ra,aelr,numTgts);
 
+   if (states != nullptr) states->unref();
+
    return numTgts;
 }
 
+//------------------------------------------------------------------------------
+// Boresight kernels -- loops over the component arrays (structure of arrays).
+// The operations are the same, in the same order, as base::Vec3d::normalize()
+// and base::Matrixd::postMult(); the AVX2 versions do four targets at a time,
+// with the same operations (no fused multiply-adds), and finish the remainder
+// using the scalar versions.
+//------------------------------------------------------------------------------
+
+void Tdb::normalizeLos(
+      const unsigned int n,
+      double* const x, double* const y, double* const z,
+      const double* const vx, const double* const vy, const double* const vz,
+      double* const rng, double* const rdot)
+{
+   static const bool avx2{isAvx2LosAvailable()};
+   if (avx2) normalizeLosAvx2(n, x, y, z, vx, vy, vz, rng, rdot);
+   else normalizeLosScalar(n, x, y, z, vx, vy, vz, rng, rdot);
+}
+
+void Tdb::transformLos(
+      const unsigned int n,
+      const base::Matrixd& m,
+      const double* const x, const double* const y, const double* const z,
+      double* const tx, double* const ty, double* const tz)
+{
+   static const bool avx2{isAvx2LosAvailable()};
+   if (avx2) transformLosAvx2(n, m, x, y, z, tx, ty, tz);
+   else transformLosScalar(n, m, x, y, z, tx, ty, tz);
+}
+
+void Tdb::normalizeLosScalar(
+      const unsigned int n,
+      double* const x, double* const y, double* const z,
+      const double* const vx, const double* const vy, const double* const vz,
+      double* const rng, double* const rdot)
+{
+   for (unsigned int i = 0; i < n; i++) {
+      const double r{std::sqrt(x[i]*x[i] + y[i]*y[i] + z[i]*z[i])};
+      if (r > 0.0) {
+         const double inv{1.0 / r};
+         x[i] *= inv;
+         y[i] *= inv;
+         z[i] *= inv;
+      }
+      rng[i] = r;
+      rdot[i] = vx[i]*x[i] + vy[i]*y[i] + vz[i]*z[i];
+   }
+}
+
+void Tdb::transformLosScalar(
+      const unsigned int n,
+      const base::Matrixd& m,
+      const double* const x, const double* const y, const double* const z,
+      double* const tx, double* const ty, double* const tz)
+{
+   for (unsigned int i = 0; i < n; i++) {
+      const double d{1.0 / (m(3,0)*x[i] + m(3,1)*y[i] + m(3,2)*z[i] + m(3,3))};
+      tx[i] = (m(0,0)*x[i] + m(0,1)*y[i] + m(0,2)*z[i] + m(0,3)) * d;
+      ty[i] = (m(1,0)*x[i] + m(1,1)*y[i] + m(1,2)*z[i] + m(1,3)) * d;
+      tz[i] = (m(2,0)*x[i] + m(2,1)*y[i] + m(2,2)*z[i] + m(2,3)) * d;
+   }
+}
+
+#ifdef MIXR_TDB_AVX2
+
+bool Tdb::isAvx2LosAvailable()
+{
+   return base::isCpuAvx2Supported();
+}
+
+__attribute__((target("avx2")))
+void Tdb::normalizeLosAvx2(
+      const unsigned int n,
+      double* const x, double* const y, double* const z,
+      const double* const vx, const double* const vy, const double* const vz,
+      double* const rng, double* const rdot)
+{
+   const __m256d zero{_mm256_setzero_pd()};
+   const __m256d one{_mm256_set1_pd(1.0)};
+   unsigned int i{};
+   for ( ; i + 4 <= n; i += 4) {
+      __m256d x4{_mm256_loadu_pd(x + i)};
+      __m256d y4{_mm256_loadu_pd(y + i)};
+      __m256d z4{_mm256_loadu_pd(z + i)};
+      const __m256d r{_mm256_sqrt_pd(_mm256_add_pd(_mm256_add_pd(
+            _mm256_mul_pd(x4, x4), _mm256_mul_pd(y4, y4)), _mm256_mul_pd(z4, z4)))};
+
+      // Only the vectors with a length (r > 0) are scaled
+      const __m256d inv{_mm256_div_pd(one, r)};
+      const __m256d mask{_mm256_cmp_pd(r, zero, _CMP_GT_OQ)};
+      x4 = _mm256_blendv_pd(x4, _mm256_mul_pd(x4, inv), mask);
+      y4 = _mm256_blendv_pd(y4, _mm256_mul_pd(y4, inv), mask);
+      z4 = _mm256_blendv_pd(z4, _mm256_mul_pd(z4, inv), mask);
+      _mm256_storeu_pd(x + i, x4);
+      _mm256_storeu_pd(y + i, y4);
+      _mm256_storeu_pd(z + i, z4);
+      _mm256_storeu_pd(rng + i, r);
+
+      const __m256d rd{_mm256_add_pd(_mm256_add_pd(
+            _mm256_mul_pd(_mm256_loadu_pd(vx + i), x4), _mm256_mul_pd(_mm256_loadu_pd(vy + i), y4)),
+            _mm256_mul_pd(_mm256_loadu_pd(vz + i), z4))};
+      _mm256_storeu_pd(rdot + i, rd);
+   }
+   normalizeLosScalar(n - i, x + i, y + i, z + i, vx + i, vy + i, vz + i, rng + i, rdot + i);
+}
+
+// One row of the matrix times the vectors: ((m0*x + m1*y) + m2*z) + m3
+__attribute__((target("avx2")))
+static inline __m256d rowTimes(const base::Matrixd& m, const int row, const __m256d x, const __m256d y, const __m256d z)
+{
+   return _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(
+         _mm256_mul_pd(_mm256_set1_pd(m(row,0)), x), _mm256_mul_pd(_mm256_set1_pd(m(row,1)), y)),
+         _mm256_mul_pd(_mm256_set1_pd(m(row,2)), z)), _mm256_set1_pd(m(row,3)));
+}
+
+__attribute__((target("avx2")))
+void Tdb::transformLosAvx2(
+      const unsigned int n,
+      const base::Matrixd& m,
+      const double* const x, const double* const y, const double* const z,
+      double* const tx, double* const ty, double* const tz)
+{
+   const __m256d one{_mm256_set1_pd(1.0)};
+   unsigned int i{};
+   for ( ; i + 4 <= n; i += 4) {
+      const __m256d x4{_mm256_loadu_pd(x + i)};
+      const __m256d y4{_mm256_loadu_pd(y + i)};
+      const __m256d z4{_mm256_loadu_pd(z + i)};
+      const __m256d d{_mm256_div_pd(one, rowTimes(m, 3, x4, y4, z4))};
+      _mm256_storeu_pd(tx + i, _mm256_mul_pd(rowTimes(m, 0, x4, y4, z4), d));
+      _mm256_storeu_pd(ty + i, _mm256_mul_pd(rowTimes(m, 1, x4, y4, z4), d));
+      _mm256_storeu_pd(tz + i, _mm256_mul_pd(rowTimes(m, 2, x4, y4, z4), d));
+   }
+   transformLosScalar(n - i, m, x + i, y + i, z + i, tx + i, ty + i, tz + i);
+}
+
+#else
+
+bool Tdb::isAvx2LosAvailable()
+{
+   return false;
+}
+
+void Tdb::normalizeLosAvx2(
+      const unsigned int n,
+      double* const x, double* const y, double* const z,
+      const double* const vx, const double* const vy, const double* const vz,
+      double* const rng, double* const rdot)
+{
+   normalizeLosScalar(n, x, y, z, vx, vy, vz, rng, rdot);
+}
+
+void Tdb::transformLosAvx2(
+      const unsigned int n,
+      const base::Matrixd& m,
+      const double* const x, const double* const y, const double* const z,
+      double* const tx, double* const ty, double* const tz)
+{
+   transformLosScalar(n, m, x, y, z, tx, ty, tz);
+}
+
+#endif
+
 //------------------------------------------------------------------------------
 // Sets our Gimbal
 //------------------------------------------------------------------------------
@@ -0,0 +1,78 @@
+
+#include "mixr/models/UniformGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace mixr {
+namespace models {
+
+//------------------------------------------------------------------------------
+// Grid functions
+//------------------------------------------------------------------------------
+void UniformGrid::set(const double lo1, const double hi1, const double lo2, const double hi2, const double res)
+{
+   ax1.set(lo1, hi1, res);
+   ax2.set(lo2, hi2, res);
+   values.assign(ax1.n * ax2.n, 0.0);
+}
+
+void UniformGrid::clear()
+{
+   values.clear();
+}
+
+double UniformGrid::lookup(const double x) const
+{
+   unsigned int i{};
+   double t{};
+   ax1.locate(x, &i, &t);
+   const double* const v{&values[i]};
+   return v[0] + t * (v[1] - v[0]);
+}
+
+double UniformGrid::lookup(const double x, const double y) const
+{
+   unsigned int i{}, j{};
+   double t{}, u{};
+   ax1.locate(x, &i, &t);
+   ax2.locate(y, &j, &u);
+   const double* const v0{&values[j * ax1.n + i]};
+   const double* const v1{v0 + ax1.n};
+   const double a{v0[0] + t * (v0[1] - v0[0])};
+   const double b{v1[0] + t * (v1[1] - v1[0])};
+   return a + u * (b - a);
+}
+
+//------------------------------------------------------------------------------
+// Axis functions
+//------------------------------------------------------------------------------
+void UniformGrid::Axis::set(const double a, const double b, const double res)
+{
+   lo = a;
+   hi = b;
+   const double span{hi - lo};
+   if (span > 0.0 && res > 0.0) {
+      n = static_cast<unsigned int>(std::ceil(span / res)) + 1;
+      step = span / (n - 1);
+      invStep = 1.0 / step;
+   } else {
+      // A single node (duplicated, so the lookups always have a cell)
+      hi = lo;
+      n = 2;
+      step = 0.0;
+      invStep = 0.0;
+   }
+}
+
+void UniformGrid::Axis::locate(const double x, unsigned int* const i, double* const t) const
+{
+   const double u{(std::min(hi, std::max(lo, x)) - lo) * invStep};
+   unsigned int k{static_cast<unsigned int>(u)};
+   if (k > n - 2) k = n - 2;
+   *i = k;
+   *t = u - k;
+}
+
+}
+}
@@ -1,6 +1,11 @@
 
 #include "mixr/models/WorldModel.hpp"
 
+#include "mixr/models/ElevationBatch.hpp"
+#include "mixr/models/JammingModel.hpp"
+#include "mixr/models/PlayerIndex.hpp"
+#include "mixr/models/PlayerStateTable.hpp"
+
 #include "mixr/base/EarthModel.hpp"
 #include "mixr/base/Identifier.hpp"
 #include "mixr/base/LatLon.hpp"
@@ -11,6 +16,8 @@
 
 // environment models
 #include "mixr/models/environment/AbstractAtmosphere.hpp"
+#include "mixr/terrain/LosCache.hpp"
+#include "mixr/terrain/Viewshed.hpp"
 #include "mixr/terrain/Terrain.hpp"
 
 #include <cmath>
@@ -36,6 +43,11 @@ BEGIN_SLOTTABLE(WorldModel)
 
    "terrain",                 //  6) Terrain elevation database
    "atmosphere",              //  7) Atmospheric model
+   "playerIndexCellSize",     //  8) Player index cell size, or zero to disable the index
+   "terrainLosCache",         //  9) Terrain line-of-sight cache
+   "terrainViewshed",         // 10) Viewshed parameters of the stationary players
+   "terrainElevationBatch",   // 11) Batch the players' terrain elevations
+   "jammingModel",            // 12) Aggregated noise jamming model
 END_SLOTTABLE(WorldModel)
 
 BEGIN_SLOT_MAP(WorldModel)
@@ -54,6 +66,13 @@ BEGIN_SLOT_MAP(WorldModel)
 
     ON_SLOT( 6, setSlotTerrain,              terrain::Terrain)
     ON_SLOT( 7, setSlotAtmosphere,           AbstractAtmosphere)
+
+    ON_SLOT( 8, setSlotPlayerIndexCellSize,  base::Distance)
+
+    ON_SLOT( 9, setSlotTerrainLosCache,      terrain::LosCache)
+    ON_SLOT(10, setSlotTerrainViewshed,      terrain::Viewshed)
+    ON_SLOT(11, setSlotTerrainElevationBatch, base::Number)
+    ON_SLOT(12, setSlotJammingModel,         JammingModel)
 END_SLOT_MAP()
 
 WorldModel::WorldModel()
@@ -65,6 +84,7 @@ WorldModel::WorldModel()
 void WorldModel::initData()
 {
    base::nav::computeWorldMatrix(refLat, refLon, &wm);
+   playerIndexCellSize = PlayerIndex::DEFAULT_CELL_SIZE;
 }
 
 void WorldModel::copyData(const WorldModel& org, const bool cc)
@@ -83,6 +103,12 @@ void WorldModel::copyData(const WorldModel& org, const bool cc)
    gaUseEmFlg = org.gaUseEmFlg;
    wm = org.wm;
 
+   playerIndexCellSize = org.playerIndexCellSize;
+   playerIndex = nullptr;
+   playerStates = nullptr;
+   elevationBatch = nullptr;
+   batchElevations = org.batchElevations;
+
 
    if (org.terrain != nullptr) {
       terrain::Terrain* copy = org.terrain->clone();
@@ -93,6 +119,33 @@ void WorldModel::copyData(const WorldModel& org, const bool cc)
       setSlotTerrain(nullptr);
    }
 
+   if (org.losCache != nullptr) {
+      terrain::LosCache* copy = org.losCache->clone();
+      setSlotTerrainLosCache( copy );
+      copy->unref();
+   }
+   else {
+      setSlotTerrainLosCache(nullptr);
+   }
+
+   if (org.viewshed != nullptr) {
+      terrain::Viewshed* copy = org.viewshed->clone();
+      setSlotTerrainViewshed( copy );
+      copy->unref();
+   }
+   else {
+      setSlotTerrainViewshed(nullptr);
+   }
+
+   if (org.jammingModel != nullptr) {
+      JammingModel* copy = org.jammingModel->clone();
+      setSlotJammingModel( copy );
+      copy->unref();
+   }
+   else {
+      setSlotJammingModel(nullptr);
+   }
+
    if (org.atmosphere != nullptr) {
       AbstractAtmosphere* copy = org.atmosphere->clone();
       setSlotAtmosphere( copy );
@@ -107,6 +160,12 @@ void WorldModel::deleteData()
 {
    setSlotAtmosphere( nullptr );
    setSlotTerrain( nullptr );
+   setSlotTerrainLosCache( nullptr );
+   setSlotTerrainViewshed( nullptr );
+   setSlotJammingModel( nullptr );
+   playerIndex = nullptr;
+   playerStates = nullptr;
+   elevationBatch = nullptr;
 }
 
 void WorldModel::reset()
@@ -122,10 +181,123 @@ void WorldModel::reset()
       std::cout << "Finished!" << std::endl;
    }
 
+   // ---
+   // Clear the terrain line-of-sight cache
+   // ---
+   if (losCache != nullptr) losCache->clear();
+
+   // ---
+   // Clear the jamming model's jammers
+   // ---
+   if (jammingModel != nullptr) jammingModel->clear();
+
    // ---
    // Reset atmospheric model
    // ---
    if (atmosphere != nullptr) atmosphere->reset();
+
+   // ---
+   // Index the reset player list and take a snapshot of their states
+   // ---
+   base::PairStream* playerList{getPlayers()};
+   updatePlayerStateTable(playerList);
+   updatePlayerIndex(playerList);
+   prefetchTerrain();
+   if (playerList != nullptr) playerList->unref();
+}
+
+//------------------------------------------------------------------------------
+// phaseCompleted() -- the players have moved at the end of the dynamics phase,
+//                     so rebuild the player state table and index; the jammers
+//                     have registered at the end of the transmit phase, so
+//                     bin them before the receive phase
+//------------------------------------------------------------------------------
+void WorldModel::phaseCompleted(base::PairStream* const playerList, const unsigned int p)
+{
+   BaseClass::phaseCompleted(playerList, p);
+   if (p == 0) {
+      updatePlayerStateTable(playerList);
+      updatePlayerIndex(playerList);
+      prefetchTerrain();
+   }
+   else if (p == 1 && jammingModel != nullptr) {
+      jammingModel->build();
+   }
+}
+
+//------------------------------------------------------------------------------
+// bgBatchStarted() -- gathers the players' terrain elevation queries
+//------------------------------------------------------------------------------
+bool WorldModel::bgBatchStarted(base::PairStream* const playerList, const double dt)
+{
+   bool batch{BaseClass::bgBatchStarted(playerList, dt)};
+   if (isTerrainElevationBatched()) {
+      if (elevationBatch == nullptr) {
+         const auto p = new ElevationBatch();
+         elevationBatch = p;
+         p->unref();
+      }
+      elevationBatch->build(playerList);
+      batch = true;
+   }
+   return batch;
+}
+
+//------------------------------------------------------------------------------
+// updateBgBatch() -- looks up our part of the players' terrain elevations
+//------------------------------------------------------------------------------
+void WorldModel::updateBgBatch(const unsigned int idx, const unsigned int n)
+{
+   BaseClass::updateBgBatch(idx, n);
+   if (isTerrainElevationBatched() && elevationBatch != nullptr) {
+      elevationBatch->evaluate(terrain, idx, n);
+   }
+}
+
+//------------------------------------------------------------------------------
+// prefetchTerrain() -- hints the terrain database with the players' positions
+//                      so it can load the terrain around them
+//------------------------------------------------------------------------------
+void WorldModel::prefetchTerrain()
+{
+   if (terrain != nullptr && playerStates != nullptr) {
+      const PlayerStateTable* const t{playerStates};
+      terrain->prefetch(t->getColumn(PlayerStateTable::LATITUDE),
+                        t->getColumn(PlayerStateTable::LONGITUDE),
+                        t->getNumPlayers());
+   }
+}
+
+//------------------------------------------------------------------------------
+// updatePlayerStateTable() -- builds a new player state table; readers that
+//                             are still using the old table keep it
+//------------------------------------------------------------------------------
+void WorldModel::updatePlayerStateTable(base::PairStream* const playerList)
+{
+   if (playerList != nullptr) {
+      const auto p = new PlayerStateTable();
+      p->build(playerList, getExecTimeSec());
+      playerStates = p;
+      p->unref();
+   } else {
+      playerStates = nullptr;
+   }
+}
+
+//------------------------------------------------------------------------------
+// updatePlayerIndex() -- builds a new player index; queries that are still
+//                        using the old index keep it until they're done
+//------------------------------------------------------------------------------
+void WorldModel::updatePlayerIndex(base::PairStream* const playerList)
+{
+   if (playerIndexCellSize > 0.0 && playerList != nullptr) {
+      const auto p = new PlayerIndex(playerIndexCellSize);
+      p->build(playerList, getExecTimeSec());
+      playerIndex = p;
+      p->unref();
+   } else {
+      playerIndex = nullptr;
+   }
 }
 
 bool WorldModel::shutdownNotification()
@@ -141,6 +313,11 @@ bool WorldModel::shutdownNotification()
    if (atmosphere != nullptr) atmosphere->event(SHUTDOWN_EVENT);
    if (terrain != nullptr) terrain->event(SHUTDOWN_EVENT);
 
+   // Release the players held by the index, state table and elevation batch
+   playerIndex = nullptr;
+   playerStates = nullptr;
+   elevationBatch = nullptr;
+
    return true;
 }
 
@@ -196,6 +373,24 @@ const base::Matrixd& WorldModel::getWorldMat() const
    return wm;
 }
 
+// Returns the player index; pre-ref()'d (or nullptr if disabled)
+const PlayerIndex* WorldModel::getPlayerIndex() const
+{
+   return playerIndex.getRefPtr();
+}
+
+// Player index cell size (meters) or zero if disabled
+double WorldModel::getPlayerIndexCellSize() const
+{
+   return playerIndexCellSize;
+}
+
+// Returns the player state table; pre-ref()'d (or nullptr)
+const PlayerStateTable* WorldModel::getPlayerStateTable() const
+{
+   return playerStates.getRefPtr();
+}
+
 //------------------------------------------------------------------------------
 // Data set routines
 //------------------------------------------------------------------------------
@@ -255,6 +450,25 @@ bool WorldModel::setMaxRefRange(const double v)
    return ok;
 }
 
+// Sets the player index cell size (meters) or zero to disable the index
+bool WorldModel::setPlayerIndexCellSize(const double v)
+{
+   bool ok{v >= 0};
+   if (ok) {
+      playerIndexCellSize = v;
+      if (v == 0) playerIndex = nullptr;
+   }
+   return ok;
+}
+
+// Sets the batched terrain elevations flag
+bool WorldModel::setTerrainElevationBatch(const bool flg)
+{
+   batchElevations = flg;
+   if (!flg) elevationBatch = nullptr;
+   return true;
+}
+
 //------------------------------------------------------------------------------
 // Set Slot routines
 //------------------------------------------------------------------------------
@@ -304,6 +518,15 @@ bool WorldModel::setSlotGamingAreaRange(const base::Distance* const msg)
    return ok;
 }
 
+bool WorldModel::setSlotPlayerIndexCellSize(const base::Distance* const msg)
+{
+   bool ok{};
+   if (msg != nullptr) {
+      ok = setPlayerIndexCellSize( base::Meters::convertStatic(*msg) );
+   }
+   return ok;
+}
+
 bool WorldModel::setSlotEarthModel(const base::EarthModel* const msg)
 {
    return setEarthModel(msg);
@@ -337,6 +560,15 @@ bool WorldModel::setSlotGamingAreaEarthModel(const base::Number* const msg)
    return ok;
 }
 
+bool WorldModel::setSlotTerrainElevationBatch(const base::Number* const msg)
+{
+   bool ok{};
+   if (msg != nullptr) {
+      ok = setTerrainElevationBatch(msg->getBoolean());
+   }
+   return ok;
+}
+
 // returns the terrain elevation database
 const terrain::Terrain* WorldModel::getTerrain() const
 {
@@ -348,6 +580,30 @@ terrain::Terrain* WorldModel::getTerrain()
    return terrain;
 }
 
+// returns the terrain line-of-sight cache
+terrain::LosCache* WorldModel::getTerrainLosCache() const
+{
+   return losCache;
+}
+
+// returns the stationary players' viewshed parameters
+const terrain::Viewshed* WorldModel::getTerrainViewshed() const
+{
+   return viewshed;
+}
+
+// true if the players' terrain elevations are batched
+bool WorldModel::isTerrainElevationBatched() const
+{
+   return batchElevations && terrain != nullptr;
+}
+
+// returns the aggregated jamming model
+JammingModel* WorldModel::getJammingModel() const
+{
+   return jammingModel;
+}
+
 // returns the atmosphere model
 AbstractAtmosphere* WorldModel::getAtmosphere()
 {
@@ -365,6 +621,10 @@ bool WorldModel::setSlotTerrain(terrain::Terrain* const msg)
    if (terrain != nullptr) terrain->unref();
    terrain = msg;
    if (terrain != nullptr) terrain->ref();
+
+   // The cached results are keyed by the terrain's address, which a new
+   // terrain could reuse
+   if (losCache != nullptr) losCache->clear();
    return true;
 }
 
@@ -376,5 +636,29 @@ bool WorldModel::setSlotAtmosphere(AbstractAtmosphere* const msg)
    return true;
 }
 
+bool WorldModel::setSlotTerrainLosCache(terrain::LosCache* const msg)
+{
+   if (losCache != nullptr) losCache->unref();
+   losCache = msg;
+   if (losCache != nullptr) losCache->ref();
+   return true;
+}
+
+bool WorldModel::setSlotTerrainViewshed(terrain::Viewshed* const msg)
+{
+   if (viewshed != nullptr) viewshed->unref();
+   viewshed = msg;
+   if (viewshed != nullptr) viewshed->ref();
+   return true;
+}
+
+bool WorldModel::setSlotJammingModel(JammingModel* const msg)
+{
+   if (jammingModel != nullptr) jammingModel->unref();
+   jammingModel = msg;
+   if (jammingModel != nullptr) jammingModel->ref();
+   return true;
+}
+
 }
 }
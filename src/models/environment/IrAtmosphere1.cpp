@@ -14,6 +14,7 @@
 
 #include "mixr/base/units/Distances.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 namespace mixr {
@@ -41,10 +42,26 @@ IrAtmosphere1::IrAtmosphere1()
 void IrAtmosphere1::copyData(const IrAtmosphere1& org, const bool)
 {
    BaseClass::copyData(org);
+
+   // the tables are immutable once loaded, so they're shared with the original
+   setSlotSolarRadiationTable(org.solarRadiationTable);
+   setSlotBackgroundRadiationTable(org.backgroundRadiationTable);
+   setSlotTransmissivityTable(org.transmissivityTable);
+
+   // and so are their slices
+   metaObject.addOwnedBytes( -static_cast<long>(sizeof(double) * (transSlices.size() + bgSlices.size() + solarSlices.size())) );
+   slicedCenters = org.slicedCenters;
+   slicedWidths = org.slicedWidths;
+   transSlices = org.transSlices;
+   bgSlices = org.bgSlices;
+   solarSlices = org.solarSlices;
+   metaObject.addOwnedBytes( static_cast<long>(sizeof(double) * (transSlices.size() + bgSlices.size() + solarSlices.size())) );
 }
 
 void IrAtmosphere1::deleteData()
 {
+   clearSlices();
+
    if (solarRadiationTable != nullptr) {
       solarRadiationTable->unref();
       solarRadiationTable = nullptr;
@@ -67,40 +84,39 @@ void IrAtmosphere1::deleteData()
 
 bool IrAtmosphere1::setSlotSolarRadiationTable(const base::Table2* const tbl)
 {
-   bool ok{};
-   if (tbl != nullptr) {
-      if (solarRadiationTable != nullptr) solarRadiationTable->unref();
-      tbl->ref();
-      solarRadiationTable = tbl;
-      ok = true;
-   }
-   return ok;
+   if (solarRadiationTable != nullptr) solarRadiationTable->unref();
+   solarRadiationTable = tbl;
+   if (solarRadiationTable != nullptr) solarRadiationTable->ref();
+   clearSlices();
+   return true;
 }
 
 bool IrAtmosphere1::setSlotBackgroundRadiationTable(const base::Table3* const tbl)
 {
-   bool ok{};
-   if (tbl != nullptr) {
-      if (backgroundRadiationTable != nullptr) backgroundRadiationTable->unref();
-      tbl->ref();
-      backgroundRadiationTable = tbl;
-      ok = true;
-   }
-   return ok;
+   if (backgroundRadiationTable != nullptr) backgroundRadiationTable->unref();
+   backgroundRadiationTable = tbl;
+   if (backgroundRadiationTable != nullptr) backgroundRadiationTable->ref();
+   clearSlices();
+   return true;
 }
 
 bool IrAtmosphere1::setSlotTransmissivityTable(const base::Table4* const tbl)
 {
-   bool ok{};
-   if (tbl != nullptr) {
-      if (transmissivityTable != nullptr) transmissivityTable->unref();
-      tbl->ref();
-      transmissivityTable = tbl;
-      ok = true;
-   }
-   return ok;
+   if (transmissivityTable != nullptr) transmissivityTable->unref();
+   transmissivityTable = tbl;
+   if (transmissivityTable != nullptr) transmissivityTable->ref();
+   clearSlices();
+   return true;
 }
 
+//------------------------------------------------------------------------------
+// reset() -- slices the tables at the wave band centers
+//------------------------------------------------------------------------------
+void IrAtmosphere1::reset()
+{
+   BaseClass::reset();
+   buildSlices();
+}
 
 bool IrAtmosphere1::calculateAtmosphereContribution(IrQueryMsg* const msg, double* totalSignal, double* totalBackground)
 {
@@ -128,6 +144,30 @@ bool IrAtmosphere1::calculateAtmosphereContribution(IrQueryMsg* const msg, doubl
    *totalSignal = 0.0;
    *totalBackground = 0.0;
 
+   const double ownAlt{static_cast<double>(ownship->getAltitudeM())};
+   const double tgtAlt{static_cast<double>(target->getAltitudeM())};
+
+   // Breakpoints of the query in the tables' slices, the same for all wave bands
+   const bool sliced{isSliced()};
+   Breakpoint bgAltBp, bgAngleBp;
+   if (sliced && !bgSlices.empty()) {
+      const bool eFlg{backgroundRadiationTable->isExtrapolationEnabled()};
+      bgAltBp = locate(ownAlt, backgroundRadiationTable->getYData(), backgroundRadiationTable->getNumYPoints(), eFlg);
+      bgAngleBp = locate(viewingAngle, backgroundRadiationTable->getZData(), backgroundRadiationTable->getNumZPoints(), eFlg);
+   }
+   Breakpoint solarAltBp;
+   if (sliced && !solarSlices.empty()) {
+      const bool eFlg{solarRadiationTable->isExtrapolationEnabled()};
+      solarAltBp = locate(tgtAlt, solarRadiationTable->getYData(), solarRadiationTable->getNumYPoints(), eFlg);
+   }
+   Breakpoint trOwnAltBp, trTgtAltBp, trRangeBp;
+   if (sliced && !transSlices.empty()) {
+      const bool eFlg{transmissivityTable->isExtrapolationEnabled()};
+      trOwnAltBp = locate(ownAlt, transmissivityTable->getYData(), transmissivityTable->getNumYPoints(), eFlg);
+      trTgtAltBp = locate(tgtAlt, transmissivityTable->getZData(), transmissivityTable->getNumZPoints(), eFlg);
+      trRangeBp = locate(range2D, transmissivityTable->getWData(), transmissivityTable->getNumWPoints(), eFlg);
+   }
+
    for (unsigned int i=0; i<getNumWaveBands(); i++) {
       const double lowerBandBound{centerWavelengths[i] - (widths[i] / 2.0)};
       const double upperBandBound{lowerBandBound + widths[i]};
@@ -148,11 +188,15 @@ bool IrAtmosphere1::calculateAtmosphereContribution(IrQueryMsg* const msg, doubl
       const double overlapRatio{(upperOverlap - lowerOverlap) / (upperBandBound - lowerBandBound)};
 
       // Get the background radiation given the sensor altitude and the viewing angle
-      double backgroundRadianceInBand{overlapRatio * getBackgroundRadiation(
-                                                lowerBandBound,
-                                                upperBandBound,
-                                                static_cast<double>(ownship->getAltitudeM()),
-                                                viewingAngle)};
+      double backgroundRadiation{};
+      if (sliced && !bgSlices.empty()) {
+         const unsigned int ny{backgroundRadiationTable->getNumYPoints()};
+         const unsigned int nz{backgroundRadiationTable->getNumZPoints()};
+         backgroundRadiation = interpolate(&bgSlices[static_cast<std::size_t>(i) * ny * nz], ny, bgAltBp, bgAngleBp);
+      } else {
+         backgroundRadiation = getBackgroundRadiation(lowerBandBound, upperBandBound, ownAlt, viewingAngle);
+      }
+      double backgroundRadianceInBand{overlapRatio * backgroundRadiation};
       double radiantIntensityInBin{};
       if (sigArray == nullptr) {
          // signature is a simple number
@@ -168,18 +212,28 @@ bool IrAtmosphere1::calculateAtmosphereContribution(IrQueryMsg* const msg, doubl
       }
 
       // add in reflected solar radiation
-      const double solarRadiationInBin{((1.0f - msg->getEmissivity()) * getSolarRadiation(centerWavelengths[i],
-                                    static_cast<double>(target->getAltitudeM())))};
+      double solarRadiation{};
+      if (sliced && !solarSlices.empty()) {
+         const unsigned int ny{solarRadiationTable->getNumYPoints()};
+         solarRadiation = interpolate(&solarSlices[static_cast<std::size_t>(i) * ny], solarAltBp);
+      } else {
+         solarRadiation = getSolarRadiation(centerWavelengths[i], tgtAlt);
+      }
+      const double solarRadiationInBin{((1.0f - msg->getEmissivity()) * solarRadiation)};
       radiantIntensityInBin += (solarRadiationInBin * overlapRatio);
 
       // Lookup the transmissivity in the wave band given the altitudes of sensor
       // and target and the ground range between the two
-      const double transmissivity{getTransmissivity(
-                                                lowerBandBound,
-                                                upperBandBound,
-                                                static_cast<double>(ownship->getAltitudeM()),
-                                                static_cast<double>(target->getAltitudeM()),
-                                                range2D)};
+      double transmissivity{};
+      if (sliced && !transSlices.empty()) {
+         const unsigned int ny{transmissivityTable->getNumYPoints()};
+         const unsigned int nz{transmissivityTable->getNumZPoints()};
+         const unsigned int nw{transmissivityTable->getNumWPoints()};
+         transmissivity = interpolate(&transSlices[static_cast<std::size_t>(i) * ny * nz * nw], ny, nz,
+                                      trOwnAltBp, trTgtAltBp, trRangeBp);
+      } else {
+         transmissivity = getTransmissivity(lowerBandBound, upperBandBound, ownAlt, tgtAlt, range2D);
+      }
 
       *totalSignal += radiantIntensityInBin * transmissivity;
 
@@ -191,6 +245,148 @@ bool IrAtmosphere1::calculateAtmosphereContribution(IrQueryMsg* const msg, doubl
    return true;
 }
 
+//------------------------------------------------------------------------------------------------------
+// buildSlices() -- Interpolates each table at the center of each wave band, at the table's breakpoints
+//        of its other independent variables.  The band centers are computed the same way as the
+//        getTransmissivity(), getSolarRadiation() and getBackgroundRadiation() lookups by
+//        calculateAtmosphereContribution().
+//------------------------------------------------------------------------------------------------------
+void IrAtmosphere1::buildSlices()
+{
+   clearSlices();
+
+   const unsigned int nb{getNumWaveBands()};
+   const double* centers{getWaveBandCenters()};
+   const double* widths{getWaveBandWidths()};
+   if (nb == 0 || centers == nullptr || widths == nullptr) return;
+
+   // Interpolates the table's 'rows' rows of X data at each band's center
+   const auto slice = [nb](const double* const wavelengths, const base::Table1& tbl, const unsigned int rows,
+                           std::vector<double>* const slices) {
+      const unsigned int nx{tbl.getNumXPoints()};
+      const double* xData{tbl.getXData()};
+      const double* aData{tbl.getDataTable()};
+      slices->resize(static_cast<std::size_t>(nb) * rows);
+      for (unsigned int b = 0; b < nb; b++) {
+         const Breakpoint bp{locate(wavelengths[b], xData, nx, tbl.isExtrapolationEnabled())};
+         double* const s{&(*slices)[static_cast<std::size_t>(b) * rows]};
+         for (unsigned int r = 0; r < rows; r++) {
+            const double* const a{&aData[static_cast<std::size_t>(r) * nx]};
+            s[r] = a[bp.i1] + bp.m * (a[bp.i2] - a[bp.i1]);
+         }
+      }
+   };
+
+   std::vector<double> bandCenters(nb);
+   for (unsigned int i = 0; i < nb; i++) {
+      const double lowerBandBound{centers[i] - (widths[i] / 2.0)};
+      const double upperBandBound{lowerBandBound + widths[i]};
+      bandCenters[i] = (upperBandBound + lowerBandBound) / 2.0;
+   }
+
+   if (transmissivityTable != nullptr && transmissivityTable->isValid()) {
+      const base::Table4& t{*transmissivityTable};
+      slice(bandCenters.data(), t, t.getNumYPoints() * t.getNumZPoints() * t.getNumWPoints(), &transSlices);
+   }
+   if (backgroundRadiationTable != nullptr && backgroundRadiationTable->isValid()) {
+      const base::Table3& t{*backgroundRadiationTable};
+      slice(bandCenters.data(), t, t.getNumYPoints() * t.getNumZPoints(), &bgSlices);
+   }
+   if (solarRadiationTable != nullptr && solarRadiationTable->isValid()) {
+      const base::Table2& t{*solarRadiationTable};
+      slice(centers, t, t.getNumYPoints(), &solarSlices);
+   }
+
+   slicedCenters.assign(centers, centers + nb);
+   slicedWidths.assign(widths, widths + nb);
+   metaObject.addOwnedBytes( static_cast<long>(sizeof(double) * (transSlices.size() + bgSlices.size() + solarSlices.size())) );
+}
+
+void IrAtmosphere1::clearSlices()
+{
+   metaObject.addOwnedBytes( -static_cast<long>(sizeof(double) * (transSlices.size() + bgSlices.size() + solarSlices.size())) );
+   std::vector<double>().swap(transSlices);
+   std::vector<double>().swap(bgSlices);
+   std::vector<double>().swap(solarSlices);
+   slicedCenters.clear();
+   slicedWidths.clear();
+}
+
+//------------------------------------------------------------------------------------------------------
+// isSliced() -- True if the slices were built for the current wave bands (same centers and widths)
+//------------------------------------------------------------------------------------------------------
+bool IrAtmosphere1::isSliced() const
+{
+   const unsigned int nb{getNumWaveBands()};
+   const double* centers{getWaveBandCenters()};
+   const double* widths{getWaveBandWidths()};
+   if (nb == 0 || nb != slicedCenters.size() || centers == nullptr || widths == nullptr) return false;
+
+   return std::equal(slicedCenters.begin(), slicedCenters.end(), centers) &&
+          std::equal(slicedWidths.begin(), slicedWidths.end(), widths);
+}
+
+//------------------------------------------------------------------------------------------------------
+// locate() -- Breakpoints and weight of 'v' along a table axis; same as base::lfi_1D()
+//------------------------------------------------------------------------------------------------------
+IrAtmosphere1::Breakpoint IrAtmosphere1::locate(const double v, const double* const data, const unsigned int n, const bool eFlg)
+{
+   Breakpoint bp;
+   if (n < 2) return bp;   // Only one point
+
+   // Increasing or decreasing breakpoints
+   unsigned int low{};
+   unsigned int high{n - 1};
+   int delta{1};
+   if (data[1] < data[0]) {
+      low = n - 1;
+      high = 0;
+      delta = -1;
+   }
+
+   unsigned int x2{};
+   if (v <= data[low]) {
+      if (!eFlg) { bp.i1 = low; bp.i2 = low; return bp; }
+      x2 = low + delta;
+   }
+   else if (v >= data[high]) {
+      if (!eFlg) { bp.i1 = high; bp.i2 = high; return bp; }
+      x2 = high;
+   }
+   else {
+      x2 = low + delta;
+      while (v > data[x2]) { x2 += delta; }
+   }
+
+   bp.i1 = x2 - delta;
+   bp.i2 = x2;
+   bp.m = (v - data[bp.i1]) / (data[bp.i2] - data[bp.i1]);
+   return bp;
+}
+
+//------------------------------------------------------------------------------------------------------
+// interpolate() -- Interpolates within a band's slice, in the same order as the table lookups
+//------------------------------------------------------------------------------------------------------
+double IrAtmosphere1::interpolate(const double* const a, const Breakpoint& y)
+{
+   return y.m * (a[y.i2] - a[y.i1]) + a[y.i1];
+}
+
+double IrAtmosphere1::interpolate(const double* const a, const unsigned int ny, const Breakpoint& y, const Breakpoint& z)
+{
+   const double a1{interpolate(&a[static_cast<std::size_t>(z.i1) * ny], y)};
+   const double a2{interpolate(&a[static_cast<std::size_t>(z.i2) * ny], y)};
+   return z.m * (a2 - a1) + a1;
+}
+
+double IrAtmosphere1::interpolate(const double* const a, const unsigned int ny, const unsigned int nz,
+                                  const Breakpoint& y, const Breakpoint& z, const Breakpoint& w)
+{
+   const double a1{interpolate(&a[static_cast<std::size_t>(w.i1) * ny * nz], ny, y, z)};
+   const double a2{interpolate(&a[static_cast<std::size_t>(w.i2) * ny * nz], ny, y, z)};
+   return w.m * (a2 - a1) + a1;
+}
+
 //------------------------------------------------------------------------------------------------------
 // getTransmissivity() --  Return the fraction of infrared radiation transmitted in the region
 //        of the spectrum defined by the upper and lower wavelengths as a function
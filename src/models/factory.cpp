@@ -106,6 +106,7 @@
 
 #include "mixr/models/IrShapes.hpp"
 #include "mixr/models/IrSignature.hpp"
+#include "mixr/models/JammingModel.hpp"
 #include "mixr/models/Signatures.hpp"
 
 #include "mixr/models/SimAgent.hpp"
@@ -267,6 +268,11 @@ base::Object* factory(const std::string& name)
       obj = new TargetData();
    }
 
+   // Jamming model
+   else if ( name == JammingModel::getFactoryName() ) {
+      obj = new JammingModel();
+   }
+
    // Bullseye
    else if ( name == Bullseye::getFactoryName() ) {
       obj = new Bullseye();
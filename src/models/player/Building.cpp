@@ -31,5 +31,11 @@ unsigned int Building::getMajorType() const
     return BUILDING;
 }
 
+// Buildings don't move
+bool Building::isStationary() const
+{
+    return true;
+}
+
 }
 }
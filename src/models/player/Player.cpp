@@ -23,6 +23,7 @@
 #include "mixr/models/IrSignature.hpp"
 
 #include "mixr/terrain/Terrain.hpp"
+#include "mixr/terrain/Viewshed.hpp"
 
 #include "mixr/simulation/AbstractDataRecorder.hpp"
 #include "mixr/simulation/AbstractNetIO.hpp"
@@ -334,6 +335,7 @@ void Player::copyData(const Player& org, const bool cc)
    tElevReq = org.tElevReq;
    interpTrrn = org.interpTrrn;
    tOffset = org.tOffset;
+   viewshed = nullptr;
 
    if (org.signature != nullptr) {
       RfSignature* copy = org.signature->clone();
@@ -408,6 +410,7 @@ void Player::deleteData()
    type = nullptr;
    signature = nullptr;
    irSignature = nullptr;
+   viewshed = nullptr;
    sim = nullptr;
 
 
@@ -514,6 +517,12 @@ void Player::reset()
       syncState2Ready = false;
    }
 
+   // Our viewshed is computed again at our reset position
+   viewshed = nullptr;
+
+   // Our RCS signature (e.g., compiles its RCS grids)
+   if (signature != nullptr) signature->reset();
+
    // ---
    // Reset our base class
    // -- Do this last because it sends reset pulses to our components and
@@ -629,6 +638,11 @@ void Player::updateData(const double dt)
       // ---
       updateElevation();
 
+      // ---
+      // Update the terrain viewshed
+      // ---
+      updateViewshed();
+
       // ---
       // Note: our subsystems in the components list (e.g., pilot, nav, sms and obc) are updated
       // by our call to BaseClass:updateData()
@@ -647,6 +661,18 @@ unsigned int Player::getMajorType() const
    return GENERIC;
 }
 
+// True if the player isn't moving; default: not a stationary player
+bool Player::isStationary() const
+{
+   return false;
+}
+
+// Terrain viewshed at our position; pre-ref()'d (or nullptr)
+const terrain::Viewshed* Player::getViewshed() const
+{
+   return viewshed.getRefPtr();
+}
+
 // Player's gross weight (lbs)
 double Player::getGrossWeight() const
 {
@@ -2600,6 +2626,17 @@ bool Player::onRfEmissionEventPlayer(Emission* const em)
       em->getGimbal()->event(RF_EMISSION_RETURN,em);
    }
 
+   // 6 & 7) Pass the emission to our antennas and reflections
+   passRfEmission(em);
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// passRfEmission() -- pass an R/F emission that has hit us
+//------------------------------------------------------------------------------
+void Player::passRfEmission(Emission* const em)
+{
    // 6) Pass the emission to our antennas
    {
       Gimbal* g{getGimbal()};
@@ -2614,8 +2651,6 @@ bool Player::onRfEmissionEventPlayer(Emission* const em)
    for (unsigned int i = 0; i < MAX_RF_REFLECTIONS; i++) {
       if (rfReflect[i] != nullptr) rfReflect[i]->event(RF_REFLECTED_EMISSION,em);
    }
-
-   return true;
 }
 
 //------------------------------------------------------------------------------
@@ -3196,9 +3231,10 @@ void Player::processComponents(
 void Player::updateElevation()
 {
    // Only if isTerrainElevationRequired() is false, otherwise the terrain
-   // elevation is from the IG system.
+   // elevation is from the IG system, and if the world model isn't looking
+   // up the players' elevations as a batch (see WorldModel).
    const WorldModel* s{getWorldModel()};
-   if (s != nullptr && !isTerrainElevationRequired()) {
+   if (s != nullptr && !isTerrainElevationRequired() && !s->isTerrainElevationBatched()) {
       const terrain::Terrain* terrain{s->getTerrain()};
       if (terrain != nullptr) {
          double el{};
@@ -3208,6 +3244,36 @@ void Player::updateElevation()
    }
 }
 
+//------------------------------------------------------------------------------
+// Compute our terrain viewshed, if we're a stationary local player and the
+// simulation has viewshed parameters, once at each position that we stop at
+//------------------------------------------------------------------------------
+void Player::updateViewshed()
+{
+   const WorldModel* s{getWorldModel()};
+   const terrain::Viewshed* params{};
+   const terrain::Terrain* terrain{};
+   if (s != nullptr && isLocalPlayer() && isStationary()) {
+      params = s->getTerrainViewshed();
+      terrain = s->getTerrain();
+   }
+
+   if (params == nullptr || terrain == nullptr) {
+      // Moving (or no viewsheds)
+      if (viewshed != nullptr) viewshed = nullptr;
+   }
+   else if (viewshed == nullptr || !viewshed->isAt(getLatitude(), getLongitude(), getAltitudeM())) {
+      // Stopped at a new position
+      terrain::Viewshed* vs{params->clone()};
+      if (vs->compute(terrain, getLatitude(), getLongitude(), getAltitudeM())) {
+         viewshed = vs;
+      } else {
+         viewshed = nullptr;
+      }
+      vs->unref();
+   }
+}
+
 //------------------------------------------------------------------------------
 // printTimingStats() -- Update time critical stuff here
 //------------------------------------------------------------------------------
@@ -16,5 +16,11 @@ GroundStation::GroundStation()
     setType(&generic);
 }
 
+// Ground stations don't move
+bool GroundStation::isStationary() const
+{
+    return true;
+}
+
 }
 }
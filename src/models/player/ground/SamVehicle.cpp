@@ -22,6 +22,7 @@ EMPTY_DELETEDATA(SamVehicle)
 //------------------------------------------------------------------------------
 static const double DEFAULT_MAX_LAUNCH_RANGE  {40000.0};     // Default max launch range (meters)
 static const double DEFAULT_MIN_LAUNCH_RANGE  {2000.0};     // Default min launch range (meters)
+static const double STATIONARY_SPEED          {0.1};        // Max ground speed of a stationary vehicle (meters/second)
 
 BEGIN_SLOTTABLE(SamVehicle)
     "minLaunchRange",         // 1: Min launch range (base::Distance)
@@ -113,6 +114,12 @@ bool SamVehicle::isLauncherReady() const
    return (getNumberOfMissiles() > 0);
 }
 
+bool SamVehicle::isStationary() const
+{
+   // We're stationary when we've stopped
+   return (getGroundSpeed() < STATIONARY_SPEED);
+}
+
 //------------------------------------------------------------------------------
 // Set functions
 //------------------------------------------------------------------------------
@@ -5,6 +5,7 @@
 #include "mixr/models/player/Player.hpp"
 #include "mixr/models/system/trackmanager/TrackManager.hpp"
 #include "mixr/models/Designator.hpp"
+#include "mixr/models/PlayerIndex.hpp"
 #include "mixr/models/system/Guns.hpp"
 #include "mixr/models/system/Stores.hpp"
 #include "mixr/models/Track.hpp"
@@ -24,6 +25,9 @@
 
 #include "mixr/base/util/nav_utils.hpp"
 
+#include <algorithm>
+#include <vector>
+
 namespace mixr {
 namespace models {
 
@@ -388,28 +392,32 @@ void AbstractWeapon::checkDetonationEffect()
       double maxRng{10.0 * getMaxBurstRng()};
 
       // Find our target (if any)
-      const Player* tgt{getTargetPlayer()};
+      Player* tgt{getTargetPlayer()};
       if (tgt == nullptr) {
-         const Track* trk{getTargetTrack()};
+         Track* trk{getTargetTrack()};
          if (trk != nullptr) tgt = trk->getTarget();
       }
 
       base::PairStream* plist{s->getPlayers()};
       if (plist != nullptr) {
-         base::List::Item* item{plist->getFirstItem()};
+         // Candidate players from the player index; our target is
+         // processed at any range, so make sure it's a candidate.
+         std::vector<Player*> candidates;
+         std::vector<unsigned int> slots;
+         const PlayerIndex* index{s->getPlayerIndex()};
+         PlayerIndex::findPlayers(index, plist, getPosition(), maxRng, false, s->getExecTimeSec(), candidates, slots);
+         if (index != nullptr) index->unref();
+         if (tgt != nullptr && std::find(candidates.begin(), candidates.end(), tgt) == candidates.end()) {
+            candidates.push_back(tgt);
+         }
 
          // Process the detonation for all local, in-range players
-         bool finished{};
-         while (item != nullptr && !finished) {
-            base::Pair* pair{static_cast<base::Pair*>(item->getValue())};
-            Player* p{static_cast<Player*>(pair->object())};
-            finished = p->isNetworkedPlayer();  // local only
-            if (!finished && (p != this) ) {
+         for (Player* p : candidates) {
+            if (!p->isNetworkedPlayer() && (p != this) ) {  // local only
                base::Vec3d dpos{p->getPosition() - getPosition()};
                const double rng{dpos.length()};
                if ( (rng <= maxRng) || (p == tgt) ) p->processDetonation(rng, this);
             }
-            item = item->getNext();
          }
 
          // cleanup
@@ -3,6 +3,8 @@
 #include "mixr/models/player/Player.hpp"
 #include "mixr/models/system/RfSystem.hpp"
 #include "mixr/models/Emission.hpp"
+#include "mixr/models/GainPatternGrid.hpp"
+#include "mixr/models/Signatures.hpp"
 #include "mixr/models/Tdb.hpp"
 
 #include "mixr/base/functors/Func1.hpp"
@@ -34,6 +36,8 @@ BEGIN_SLOTTABLE(Antenna)
     "gainPatternDeg",       //  5: Gain pattern in degrees flag (true: degrees, false(default): radians)
     "recycle",              //  6: Recycle emissions flag (default: true)
     "beamWidth",            //  7: Beam Width              (Angle) or (Number: Radian)
+    "gainPatternResolution",//  8: Gain pattern grid's max node spacing (Angle) or (Number: Radian)
+    "batchInteractions",    //  9: Batched R/F interactions flag (default: false)
 END_SLOTTABLE(Antenna)
 
 BEGIN_SLOT_MAP(Antenna)
@@ -45,6 +49,9 @@ BEGIN_SLOT_MAP(Antenna)
     ON_SLOT(6,  setSlotRecycleFlg,        base::Number)
     ON_SLOT(7,  setSlotBeamWidth,         base::Angle)      // Check for base::Angle before base::Number
     ON_SLOT(7,  setSlotBeamWidth,         base::Number)
+    ON_SLOT(8,  setSlotGainPatternResolution, base::Angle)  // Check for base::Angle before base::Number
+    ON_SLOT(8,  setSlotGainPatternResolution, base::Number)
+    ON_SLOT(9,  setSlotBatchInteractions, base::Number)
 END_SLOT_MAP()
 
 BEGIN_EVENT_HANDLER(Antenna)
@@ -88,22 +95,23 @@ void Antenna::copyData(const Antenna& org, const bool)
    gain = org.gain;
    gainPatternDeg = org.gainPatternDeg;
 
-   if (org.gainPattern != nullptr) {
-      base::Function* copy{org.gainPattern->clone()};
-      setSlotGainPattern( copy );
-      copy->unref();
-   } else {
-      setSlotGainPattern(nullptr);
-   }
+   // the gain pattern is immutable once loaded, so it's shared with the original
+   setSlotGainPattern(org.gainPattern);
 
    recycle = org.recycle;
    beamWidth = org.beamWidth;
+   batch = org.batch;
+
+   // the compiled gain pattern is also shared
+   gainPatternRes = org.gainPatternRes;
+   gainGrid = static_cast<const GainPatternGrid*>(org.gainGrid);
 }
 
 void Antenna::deleteData()
 {
    setSystem(nullptr);
    setSlotGainPattern(nullptr);
+   gainGrid = nullptr;
 
    clearQueues();
 }
@@ -112,6 +120,41 @@ void Antenna::reset()
 {
     BaseClass::reset();
     clearQueues();
+
+    // pre-size the emission lists to the peak number of emissions in use
+    freeEmissions.reserve(emPoolPeak);
+    inUseEmissions.reserve(emPoolPeak);
+
+    // pre-size the rfTransmit() work arrays for our players of interest
+    const unsigned int n{getMaxPlayersOfInterest()};
+    gainTgtBuf.reserve(n);
+    gainTgt0Buf.reserve(n);
+    aeGainBuf.reserve(n);
+    erpBuf.reserve(n);
+
+    // compile the gain pattern (unless we already have, or share, its grid)
+    if (gainPattern != nullptr && gainPatternRes > 0.0) {
+       if (gainGrid == nullptr || !gainGrid->isBuiltFrom(gainPattern, gainPatternDeg, gainPatternRes)) {
+          const auto grid = new GainPatternGrid();
+          if (grid->build(gainPattern, gainPatternDeg, gainPatternRes)) {
+             gainGrid = grid;
+             if (isMessageEnabled(MSG_INFO)) {
+                std::cout << "Antenna::reset(): gain pattern grid: " << grid->getNumPoints() << " points, ";
+                std::cout << (grid->getResolution() * base::angle::R2DCC) << " deg resolution; max error ";
+                std::cout << grid->getMaxError() << " dB at ( " << (grid->getMaxErrorAngle1() * base::angle::R2DCC);
+                std::cout << ", " << (grid->getMaxErrorAngle2() * base::angle::R2DCC) << " ) deg" << std::endl;
+             }
+          } else {
+             gainGrid = nullptr;
+             if (isMessageEnabled(MSG_WARNING)) {
+                std::cerr << "Antenna::reset(): unable to build the gain pattern grid" << std::endl;
+             }
+          }
+          grid->unref();
+       }
+    } else {
+       gainGrid = nullptr;
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -134,32 +177,27 @@ void Antenna::process(const double dt)
 
    // ---
    // Recycle emissions ...
-   // Update emission queues: from 'in-use' to 'free'
+   // Update emission lists: from 'in-use' to 'free'
    // ---
-   if (recycle) {
-      unsigned int n{inUseEmQueue.entries()};
-
-      for (unsigned int i = 0; i < n; i++) {
-
-         base::lock(inUseEmLock);
-         Emission* em{inUseEmQueue.get()};
-         base::unlock(inUseEmLock);
-
-         if (em != nullptr && em->getRefCount() > 1) {
-            // Others are still referencing the emission, put back on in-use queue
-            base::lock(inUseEmLock);
-            inUseEmQueue.put(em);
-            base::unlock(inUseEmLock);
-         } else if (em != nullptr && em->getRefCount() <= 1) {
-            // No one else is referencing the emission, push to the free stack
-            em->clear();
-            base::lock(freeEmLock);
-            if (freeEmStack.isNotFull()) freeEmStack.push(em);
-            else em->unref();
-            base::unlock(freeEmLock);
-         }
+   const unsigned int n{static_cast<unsigned int>(inUseEmissions.size())};
+   if (n > emPoolPeak) emPoolPeak = n;
+
+   unsigned int k{};
+   for (unsigned int i = 0; i < n; i++) {
+      Emission* const em{inUseEmissions[i]};
+      if (em->getRefCount() > 1) {
+         // Others are still referencing the emission, keep it on the in-use list
+         inUseEmissions[k++] = em;
+      } else if (recycle && freeEmissions.size() < emPoolPeak) {
+         // No one else is referencing the emission, move it to the free list
+         em->clear();
+         freeEmissions.push_back(em);
+      } else {
+         // We have enough free emissions
+         em->unref();
       }
    }
+   inUseEmissions.resize(k);
 }
 
 //------------------------------------------------------------------------------
@@ -174,25 +212,19 @@ bool Antenna::setSystem(RfSystem* const s)
 }
 
 //------------------------------------------------------------------------------
-// clearQueues() -- clear out all queues
+// clearQueues() -- clear out the free and in-use emission lists
 //------------------------------------------------------------------------------
 void Antenna::clearQueues()
 {
-   base::lock(freeEmLock);
-   Emission* em{freeEmStack.pop()};
-   while (em != nullptr) {
+   for (Emission* em : freeEmissions) {
       em->unref();
-      em = freeEmStack.pop();
    }
-   base::unlock(freeEmLock);
+   freeEmissions.clear();
 
-   base::lock(inUseEmLock);
-   em = inUseEmQueue.get();
-   while (em != nullptr) {
+   for (Emission* em : inUseEmissions) {
       em->unref();
-      em = inUseEmQueue.get();
    }
-   base::unlock(inUseEmLock);
+   inUseEmissions.clear();
 }
 
 //------------------------------------------------------------------------------
@@ -253,14 +285,17 @@ bool Antenna::setGain(const base::Number* const g)
 }
 
 //------------------------------------------------------------------------------
-// setSlotGainPattern() -- sets our gain pattern
+// setSlotGainPattern() -- sets our gain pattern (its grid is rebuilt on reset)
 //------------------------------------------------------------------------------
-bool Antenna::setGainPattern(base::Function* const tbl)
+bool Antenna::setGainPattern(const base::Function* const tbl)
 {
     bool ok{true};
     if (gainPattern != nullptr) gainPattern->unref();
     gainPattern = tbl;
     if (gainPattern != nullptr) gainPattern->ref();
+    gainFunc1 = dynamic_cast<const base::Func1*>(gainPattern);
+    gainFunc2 = dynamic_cast<const base::Func2*>(gainPattern);
+    gainGrid = nullptr;
     return ok;
 }
 
@@ -272,6 +307,7 @@ bool Antenna::setGainPatternDeg(const base::Number* const msg)
     bool ok{true};
     if (msg != nullptr) {
         gainPatternDeg = msg->getBoolean();
+        gainGrid = nullptr;
         ok = true;
     }
     return ok;
@@ -289,6 +325,18 @@ bool Antenna::setRecycleFlg(const base::Number* const msg)
     return ok;
 }
 
+//------------------------------------------------------------------------------
+// setSlotBatchInteractions() -- sets the batched R/F interactions flag
+//------------------------------------------------------------------------------
+bool Antenna::setBatchInteractionsFlag(const base::Number* const msg)
+{
+    bool ok{true};
+    if (msg != nullptr) {
+        ok = setBatchInteractionsFlag( msg->getBoolean() );
+    }
+    return ok;
+}
+
 //------------------------------------------------------------------------------
 // Sets beam width as an base::Angle
 //------------------------------------------------------------------------------
@@ -321,6 +369,36 @@ bool Antenna::setBeamWidth(const base::Number* const msg)
    return ok;
 }
 
+//------------------------------------------------------------------------------
+// Sets the gain pattern grid's resolution as an base::Angle
+//------------------------------------------------------------------------------
+bool Antenna::setGainPatternResolution(const base::Angle* const msg)
+{
+   bool ok{};
+   if (msg != nullptr) {
+      ok = setGainPatternResolution( base::Radians::convertStatic( *msg ) );
+      if (!ok) {
+         std::cerr << "Antenna::setSlotGainPatternResolution: Error setting gain pattern resolution!" << std::endl;
+      }
+   }
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// Sets the gain pattern grid's resolution in radians
+//------------------------------------------------------------------------------
+bool Antenna::setGainPatternResolution(const base::Number* const msg)
+{
+   bool ok{};
+   if (msg != nullptr) {
+      ok = setGainPatternResolution( msg->getDouble() );
+      if (!ok) {
+         std::cerr << "Antenna::setSlotGainPatternResolution: Error setting gain pattern resolution!" << std::endl;
+      }
+   }
+   return ok;
+}
+
 //------------------------------------------------------------------------------
 // setThreshold() - sets our antenna threshold
 //------------------------------------------------------------------------------
@@ -356,6 +434,15 @@ bool Antenna::setEmissionRecycleFlag(const bool enable)
    return true;
 }
 
+//------------------------------------------------------------------------------
+// setBatchInteractionsFlag: sets the batched R/F interactions flag
+//------------------------------------------------------------------------------
+bool Antenna::setBatchInteractionsFlag(const bool enable)
+{
+   batch = enable;
+   return true;
+}
+
 //------------------------------------------------------------------------------
 // Sets the beam width (radians; must be greater than 0)
 //------------------------------------------------------------------------------
@@ -369,6 +456,21 @@ bool Antenna::setBeamWidth(const double radians)
    return ok;
 }
 
+//------------------------------------------------------------------------------
+// Sets the gain pattern grid's max node spacing (radians; zero for no grid);
+// the grid is built on reset()
+//------------------------------------------------------------------------------
+bool Antenna::setGainPatternResolution(const double radians)
+{
+   bool ok{};
+   if (radians >= 0.0) {
+      gainPatternRes = radians;
+      gainGrid = nullptr;
+      ok = true;
+   }
+   return ok;
+}
+
 //------------------------------------------------------------------------------
 // TRANSMIT AND RECEIVE FUNCTION (SENSOR STUFF)
 //------------------------------------------------------------------------------
@@ -390,8 +492,7 @@ void Antenna::rfTransmit(Emission* const xmit)
    // ---
    // Compute gimbal boresight data for our targets
    // ---
-   unsigned int ntgts{tdb->computeBoresightData()};
-   if (ntgts > MAX_PLAYERS) ntgts = MAX_PLAYERS;
+   const unsigned int ntgts{tdb->computeBoresightData()};
 
    // ---
    // If we have targets
@@ -399,15 +500,32 @@ void Antenna::rfTransmit(Emission* const xmit)
    const base::Vec3d* losG{tdb->getGimbalLosVectors()};
    if (ntgts > 0 && losG != nullptr) {
 
+      // Size our per-target work arrays (they only grow)
+      if (ntgts > gainTgtBuf.size()) {
+         gainTgtBuf.resize(ntgts);
+         gainTgt0Buf.resize(ntgts);
+         aeGainBuf.resize(ntgts);
+         erpBuf.resize(ntgts);
+      }
+
       // ---
       // Lookup gain from antenna gain pattern, compute antenna
       // effective gain and effective radiated power.
       // ---
       bool haveGainTgt{};
-      double gainTgt[MAX_PLAYERS]{};
-      if (gainPattern != nullptr) {
-         const auto gainFunc1 = dynamic_cast<base::Func1*>(gainPattern);
-         const auto gainFunc2 = dynamic_cast<base::Func2*>(gainPattern);
+      double* const gainTgt{gainTgtBuf.data()};
+      const GainPatternGrid* const grid{gainGrid};
+      if (grid != nullptr) {
+         // ---
+         // Compiled antenna pattern: linear gains, so no conversion from dB
+         // ---
+         if (grid->is2D()) {
+            grid->getGains(tdb->getBoresightAzimuthErrors(), tdb->getBoresightElevationErrors(), gainTgt, ntgts);
+         } else {
+            grid->getGains(tdb->getBoresightErrorAngles(), gainTgt, ntgts);
+         }
+         haveGainTgt = true;
+      } else if (gainPattern != nullptr) {
          if (gainFunc2 != nullptr) {
             // ---
             // Antenna pattern: 2D table (az & el off antenna boresight)
@@ -420,7 +538,7 @@ void Antenna::rfTransmit(Emission* const xmit)
             const double* aelr{tdb->getBoresightElevationErrors()};
 
             // Lookup gain in 2D table and convert from dB
-            double gainTgt0[MAX_PLAYERS]{};
+            double* const gainTgt0{gainTgt0Buf.data()};
             if (gainPatternDeg) {
                for (unsigned int i1 = 0; i1 < ntgts; i1++) {
                   gainTgt0[i1] = gainFunc2->f( (aazr[i1] * base::angle::R2DCC), (aelr[i1] * base::angle::R2DCC) )/10.0;
@@ -441,7 +559,7 @@ void Antenna::rfTransmit(Emission* const xmit)
             const double* aar{tdb->getBoresightErrorAngles()};
 
             // Lookup gain in 1D table and convert from dB
-            double gainTgt0[MAX_PLAYERS]{};
+            double* const gainTgt0{gainTgt0Buf.data()};
             if (gainPatternDeg) {
                for (unsigned int i2 = 0; i2 < ntgts; i2++) {
                   gainTgt0[i2] = gainFunc1->f( aar[i2] * base::angle::R2DCC )/10.0;
@@ -465,11 +583,11 @@ void Antenna::rfTransmit(Emission* const xmit)
       }
 
       // Compute antenna effective gain
-      double aeGain[MAX_PLAYERS]{};
+      double* const aeGain{aeGainBuf.data()};
       base::multArrayConst(gainTgt, getGain(), aeGain, ntgts);
 
       // Compute Effective Radiated Power (watts) (Equation 2-1)
-      double erp[MAX_PLAYERS]{};
+      double* const erp{erpBuf.data()};
       base::multArrayConst(aeGain, xmit->getPower(), erp, ntgts);
 
       // Fetch the required data arrays from the TargetDataBlock
@@ -479,20 +597,55 @@ void Antenna::rfTransmit(Emission* const xmit)
       const base::Vec3d* losT2O{tdb->getTargetLosVectors()};
       Player** targets{tdb->getTargets()};
 
+      // ---
+      // Batched interactions: compute the angles of incidence at the targets
+      // (same as Player::onRfEmissionEventPlayer())
+      // ---
+      if (batch) {
+         if (ntgts > aoiBuf.size()) {
+            aoiBuf.resize(ntgts);
+            aoiAzBuf.resize(ntgts);
+            aoiElBuf.resize(ntgts);
+         }
+         base::Vec4d* const aoi{aoiBuf.data()};
+         double* const aoiAz{aoiAzBuf.data()};
+         double* const aoiEl{aoiElBuf.data()};
+
+         // Transform the LOS vectors back to us to the targets' coordinates
+         for (unsigned int i = 0; i < ntgts; i++) {
+            const base::Vec4d los0( losT2O[i].x(), losT2O[i].y(), losT2O[i].z(), 0.0 );
+            aoi[i] = targets[i]->getRotMat() * los0;
+         }
+
+         // Azimuth and elevation angles of incidence
+         for (unsigned int i = 0; i < ntgts; i++) {
+            const double xa{aoi[i].x()};
+            const double ya{aoi[i].y()};
+            const double za{-aoi[i].z()};
+            aoiAz[i] = std::atan2(ya, xa);
+            const double ra{std::sqrt(xa*xa + ya*ya)};
+            aoiEl[i] = std::atan2(za,ra);
+         }
+      }
+
       // ---
       // Send emission packets to the targets
       // ---
       for (unsigned int i = 0; i < ntgts; i++) {
 
-         // Only of power exceeds an optional threshold
-         if (erp[i] > threshold) {
+         // Only of power exceeds an optional threshold (and, if batched,
+         // only to active targets; see Player::onRfEmissionEventPlayer())
+         if (erp[i] > threshold && (!batch || targets[i]->isMode(Player::ACTIVE))) {
 
             // Get a free emission packet
             Emission* em{};
             if (recycle) {
-               base::lock(freeEmLock);
-               em = freeEmStack.pop();
-               base::unlock(freeEmLock);
+               if (!freeEmissions.empty()) {
+                  em = freeEmissions.back();
+                  freeEmissions.pop_back();
+               } else {
+                  emPoolMisses++;
+               }
             }
 
             bool cloned{};
@@ -500,6 +653,7 @@ void Antenna::rfTransmit(Emission* const xmit)
                // Otherwise, clone a new one
                em = xmit->clone();
                cloned = true;
+               emClones++;
             }
 
             // Send the emission to the other player
@@ -526,24 +680,33 @@ void Antenna::rfTransmit(Emission* const xmit)
                em->setLocalPlayersOnly( isLocalPlayersOfInterestOnly() );
 
                // c) Send the emission to the target
-               targets[i]->event(RF_EMISSION, em);
-
-               // d) Recycle the emission (we don't bother)
-               //bool recycled = false;
-               //if (recycle) {
-               //   base::lock(inUseEmLock);
-               //   if (inUseEmQueue.isNotFull()) {
-                     // Store for future reference
-               //      inUseEmQueue.put(em);
-               //      recycled = true;
-               //   }
-               //   base::unlock(inUseEmLock);
-               //}
-
-               // or just forget it
-               //else {
+               if (batch) {
+                  // Interact with the target (see Player::onRfEmissionEventPlayer())
+                  em->setAoiVector(aoiBuf[i]);
+                  em->setAzimuthAoi(aoiAzBuf[i]);
+                  em->setElevationAoi(aoiElBuf[i]);
+
+                  // Target's RCS, and hold the return for our system
+                  if (em->isReturnRequested()) {
+                     RfSignature* const sig{targets[i]->getRFSignature()};
+                     em->setRCS( (sig != nullptr) ? sig->getRCS(em) : 0 );
+                     em->ref();
+                     retEmBuf.push_back(em);
+                  }
+
+                  // Pass the emission to the target's antennas
+                  targets[i]->passRfEmission(em);
+               } else {
+                  targets[i]->event(RF_EMISSION, em);
+               }
+
+               // d) Recycle the emission: hold it on the in-use list until the
+               //    receivers release it (see process()), or just forget it
+               if (recycle && (inUseEmissions.size() + freeEmissions.size()) < static_cast<unsigned int>(MAX_EMISSIONS)) {
+                  inUseEmissions.push_back(em);
+               } else {
                   em->unref();
-               //}
+               }
 
             } else {
                // When we couldn't get a free emission packet
@@ -554,6 +717,26 @@ void Antenna::rfTransmit(Emission* const xmit)
          }
 
       }
+
+      // ---
+      // Batched interactions: pass the returned emissions to our system
+      // (see onRfEmissionReturnEventAntenna())
+      // ---
+      const unsigned int nret{static_cast<unsigned int>(retEmBuf.size())};
+      if (nret > 0) {
+         RfSystem* const sys1{getSystem()};
+         if (sys1 != nullptr) {
+            retGainBuf.resize(nret);
+            for (unsigned int i = 0; i < nret; i++) {
+               retGainBuf[i] = getEffectiveArea(retEmBuf[i]->getGain(), retEmBuf[i]->getWavelength());
+            }
+            sys1->rfReceivedEmissions(retEmBuf.data(), this, retGainBuf.data(), nret);
+         }
+         for (unsigned int i = 0; i < nret; i++) {
+            retEmBuf[i]->unref();
+         }
+         retEmBuf.clear();
+      }
    }
 
    // Unref() the TDB
@@ -608,68 +791,9 @@ bool Antenna::onRfEmissionEvent(Emission* const em)
       if (ownship != nullptr && sys1 != nullptr) {
          sys1->ref();
 
-         // Line-Of-Sight (LOS) vectors back to the transmitter.
-         const base::Vec3d xlos{em->getTgtLosVec()};
-         const base::Vec4d los0( xlos.x(), xlos.y(), xlos.z(), 0.0);
-
-         // 2) Transform local NED LOS vectors to antenna coordinates
-         base::Matrixd mm{getRotMat()};
-         mm *= ownship->getRotMat();
-         base::Vec4d losA{mm * los0};
-
-         // ---
-         // Compute antenna gains in the direction of the transmitter
-         // ---
-         double rGainDb{};
-         if (gainPattern != nullptr) {
-
-            const auto gainFunc1 = dynamic_cast<base::Func1*>(gainPattern);
-            const auto gainFunc2 = dynamic_cast<base::Func2*>(gainPattern);
-            if (gainFunc2 != nullptr) {
-               // ---
-               // 3-a) Antenna pattern: 2D table (az & el off antenna boresight)
-               // ---
-
-               // Get component arrays and ground range squared
-               const double xa{losA.x()};
-               const double ya{losA.y()};
-               const double za{-losA.z()};
-               const double ra2{xa*xa + ya*ya};
-
-               // Compute range along antenna x-y plane
-               const double ra{std::sqrt(ra2)};
-
-               // Compute azimuth off boresight
-               const double aazr{std::atan2(ya,xa)};
-
-               // Compute elevation off boresight
-               const double aelr{std::atan2(za,ra)};
-
-               // Lookup gain in 2D table and convert from dB
-               if (gainPatternDeg)
-                  rGainDb = gainFunc2->f( aazr * base::angle::R2DCC, aelr * base::angle::R2DCC );
-               else
-                  rGainDb = gainFunc2->f( aazr, aelr );
-
-            } else if (gainFunc1 != nullptr) {
-               // ---
-               // 3-b) Antenna Pattern: 1D table (off antenna boresight only
-               // ---
-
-               // Compute angle off antenna boresight
-               const double aar{std::acos(losA.x())};
-
-               // Lookup gain in 1D table and convert from dB
-               if (gainPatternDeg)
-                  rGainDb = gainFunc1->f( aar * base::angle::R2DCC );
-               else
-                  rGainDb = gainFunc1->f(aar);
-
-            }
-         }
-
-         // Compute off-boresight gain
-         const double rGain{std::pow(10.0,rGainDb/10.0)};
+         // Compute antenna gains in the direction of the transmitter, along
+         // the Line-Of-Sight (LOS) vector back to the transmitter
+         const double rGain{getPatternGain(em->getTgtLosVec())};
 
          // Compute Antenna Effective Gain
          const double aeGain{rGain * getGain()};
@@ -689,6 +813,82 @@ bool Antenna::onRfEmissionEvent(Emission* const em)
    return BaseClass::onRfEmissionEvent(em);
 }
 
+//------------------------------------------------------------------------------
+// getPatternGain() -- gain pattern's gain (linear) in the direction of the NED
+// line-of-sight unit vector 'los' from our ownship
+//
+// 1) Transform the LOS vector to antenna coordinates
+//
+// 2) Compute the antenna gain in the direction of the LOS vector
+//------------------------------------------------------------------------------
+double Antenna::getPatternGain(const base::Vec3d& los) const
+{
+   const Player* ownship{getOwnship()};
+   if (gainPattern == nullptr || ownship == nullptr) return 1.0;
+
+   // 1) Transform local NED LOS vectors to antenna coordinates
+   const base::Vec4d los0( los.x(), los.y(), los.z(), 0.0);
+   base::Matrixd mm{getRotMat()};
+   mm *= ownship->getRotMat();
+   base::Vec4d losA{mm * los0};
+
+   // ---
+   // 2) Compute antenna gains in the direction of the LOS vector
+   // ---
+   double rGainDb{};
+   const GainPatternGrid* const grid{gainGrid};
+   if (gainFunc2 != nullptr) {
+      // ---
+      // 2-a) Antenna pattern: 2D table (az & el off antenna boresight)
+      // ---
+
+      // Get component arrays and ground range squared
+      const double xa{losA.x()};
+      const double ya{losA.y()};
+      const double za{-losA.z()};
+      const double ra2{xa*xa + ya*ya};
+
+      // Compute range along antenna x-y plane
+      const double ra{std::sqrt(ra2)};
+
+      // Compute azimuth off boresight
+      const double aazr{std::atan2(ya,xa)};
+
+      // Compute elevation off boresight
+      const double aelr{std::atan2(za,ra)};
+
+      // Lookup gain in 2D table and convert from dB
+      if (grid != nullptr) {
+         return grid->getGain(aazr, aelr);   // (linear)
+      } else if (gainPatternDeg) {
+         rGainDb = gainFunc2->f( aazr * base::angle::R2DCC, aelr * base::angle::R2DCC );
+      } else {
+         rGainDb = gainFunc2->f( aazr, aelr );
+      }
+
+   } else if (gainFunc1 != nullptr) {
+      // ---
+      // 2-b) Antenna Pattern: 1D table (off antenna boresight only
+      // ---
+
+      // Compute angle off antenna boresight
+      const double aar{std::acos(losA.x())};
+
+      // Lookup gain in 1D table and convert from dB
+      if (grid != nullptr) {
+         return grid->getGain(aar);          // (linear)
+      } else if (gainPatternDeg) {
+         rGainDb = gainFunc1->f( aar * base::angle::R2DCC );
+      } else {
+         rGainDb = gainFunc1->f(aar);
+      }
+
+   }
+
+   // Compute off-boresight gain
+   return std::pow(10.0,rGainDb/10.0);
+}
+
 //------------------------------------------------------------------------------
 // onRfEmissionReturnEventAntenna() -- process Returned RF Emission Events
 //------------------------------------------------------------------------------
@@ -2,6 +2,8 @@
 #include "mixr/models/system/CollisionDetect.hpp"
 #include "mixr/models/player/Player.hpp"
 #include "mixr/models/WorldModel.hpp"
+#include "mixr/models/PlayerIndex.hpp"
+#include "mixr/models/PlayerStateTable.hpp"
 
 #include "mixr/base/numeric/Number.hpp"
 #include "mixr/base/Pair.hpp"
@@ -186,35 +188,68 @@ void CollisionDetect::updateData(const double dt)
    }
 
    // ---
-   // Scan the player list ---
+   // Scan the players that could be in range (from the world's player index),
+   // using the world's player state table, if it's of the same player list
    // ---
    base::PairStream* plist{sim->getPlayers()};
    if (plist != nullptr) {
 
-      base::List::Item* item{plist->getFirstItem()};
+      const PlayerStateTable* states{sim->getPlayerStateTable()};
+      if (states != nullptr && states->getPlayers() != plist) {
+         states->unref();
+         states = nullptr;
+      }
+
+      std::vector<Player*>& candidates{candidateBuf};
+      std::vector<unsigned int>& slots{candidateSlotBuf};
+      candidates.clear();
+      slots.clear();
+      const PlayerIndex* index{sim->getPlayerIndex()};
+      PlayerIndex::findPlayers(index, plist, ownPos, maxRange2Players,
+                               usingEcefFlg, sim->getExecTimeSec(), candidates, slots);
+      if (index != nullptr) index->unref();
+
+      unsigned int k{};
       bool finished{};
-      while ( item != nullptr && !finished ) {
+      while ( k < candidates.size() && !finished ) {
 
          // Get the pointer to the target player
-         base::Pair* pair{static_cast<base::Pair*>(item->getValue())};
-         Player* target{static_cast<Player*>(pair->object())};
+         Player* target{candidates[k]};
+
+         // Target's state
+         const unsigned int slot{slots[k]};
+         bool networked{}, active{}, typeMatch{}, posValid{};
+         if (states != nullptr) {
+            networked = states->isNetworkedPlayer(slot);
+            active = states->isActive(slot);
+            typeMatch = states->isMajorType(slot, playerTypes);
+            posValid = states->isPositionVectorValid(slot);
+         } else {
+            networked = target->isNetworkedPlayer();
+            active = target->isActive();
+            typeMatch = target->isMajorType(playerTypes);
+            posValid = target->isPositionVectorValid();
+         }
 
          // Did we complete the local only players?
-         finished = localOnly && target->isNetworkedPlayer();
+         finished = localOnly && networked;
 
          // We should process this target if ...
          bool processTgt {
             !finished &&                                        // we're not finished AND
             target != ownship &&                                // its not our ownship AND
-            target->isActive() &&                               // the target is active AND
-            target->isMajorType(playerTypes) &&                 // the target is one of the selected types AND
-            (usingEcefFlg || target->isPositionVectorValid())}; // we're using ECEF or the target's gaming area position is valid
+            active &&                                           // the target is active AND
+            typeMatch &&                                        // the target is one of the selected types AND
+            (usingEcefFlg || posValid)};                        // we're using ECEF or the target's gaming area position is valid
 
          if ( processTgt ) {
 
             // Target position vector (ECEF or local gaming area NED)
             base::Vec3d tgtPos;
-            if (usingEcefFlg) {
+            if (states != nullptr) {
+               if (usingEcefFlg) tgtPos = states->getGeocPosition(slot);
+               else tgtPos = states->getPosition(slot);
+            } else if (usingEcefFlg) {
                tgtPos = target->getGeocPosition();
             } else {
                tgtPos = target->getPosition();
@@ -264,10 +299,11 @@ void CollisionDetect::updateData(const double dt)
          }
 
          // Next player ...
-         item = item->getNext();
+         k++;
       }
 
-      // Unref the player list
+      // Unref the state table and the player list
+      if (states != nullptr) states->unref();
       plist->unref();
    }
 
@@ -63,7 +63,7 @@ BEGIN_SLOTTABLE(Gimbal)
     "checkHorizon",                 // 29:  Enable horizon masking check (default: true)
     "playerOfInterestTypes",        // 30: Player of interest types (default: 0 )
                                     //     types: { "air" "ground" "weapon" "ship" "building" "lifeform" "space" }
-    "maxPlayersOfInterest",         // 31: Max number of players of interest (default: 0)
+    "maxPlayersOfInterest",         // 31: Max number of players of interest (default: 200)
     "maxRange2PlayersOfInterest",   // 32: Max range to players of interest or zero for all (default: 0)
     "maxAngle2PlayersOfInterest",   // 33: Max angle of gimbal boresight to players of interest or zero for all (default: 0)
     "localPlayersOfInterestOnly",   // 34: Sets the local only players of interest flag (default: false)
@@ -184,13 +184,16 @@ void Gimbal::copyData(const Gimbal& org, const bool cc)
    ownHeadingOnly = org.ownHeadingOnly;
    playerTypes = org.playerTypes;
    maxPlayers = org.maxPlayers;
+   poiOverflows = 0;
 
    tdb = nullptr;
+   if (spareTdb != nullptr) { spareTdb->unref(); spareTdb = nullptr; }
 }
 
 void Gimbal::deleteData()
 {
    tdb = nullptr;
+   if (spareTdb != nullptr) { spareTdb->unref(); spareTdb = nullptr; }
 }
 
 //------------------------------------------------------------------------------
@@ -201,6 +204,7 @@ void Gimbal::reset()
    pos = initPos;
    cmdRate = initCmdRate;
    cmdPos = initCmdPos;
+   poiOverflows = 0;
    updateMatrix();
    BaseClass::reset();
 }
@@ -211,6 +215,7 @@ void Gimbal::reset()
 bool Gimbal::shutdownNotification()
 {
     tdb = nullptr;
+    if (spareTdb != nullptr) { spareTdb->unref(); spareTdb = nullptr; }
 
     return BaseClass::shutdownNotification();
 }
@@ -1317,9 +1322,30 @@ void Gimbal::limitVec(base::Vec3d& vec, const base::Vec3d& ll, const base::Vec3d
 //------------------------------------------------------------------------------
 unsigned int Gimbal::processPlayersOfInterest(base::PairStream* const poi)
 {
-   const auto tdb0 = new Tdb(maxPlayers, this);
+   // Reuse our spare TDB if we're its only user and it's still the right
+   // size, otherwise start a new one
+   Tdb* tdb0{spareTdb};
+   spareTdb = nullptr;
+   if (tdb0 != nullptr && (tdb0->getRefCount() > 1 || tdb0->getMaxTargets() != maxPlayers)) {
+      tdb0->unref();
+      tdb0 = nullptr;
+   }
+   if (tdb0 == nullptr) tdb0 = new Tdb(maxPlayers, this);
 
    unsigned int ntgts{tdb0->processPlayers(poi)};
+
+   // Players of interest that didn't fit in our arrays
+   const unsigned int novf{tdb0->getNumberOfOverflows()};
+   if (novf > 0) {
+      if (poiOverflows == 0 && isMessageEnabled(MSG_WARNING)) {
+         std::cerr << "Gimbal::processPlayersOfInterest(): " << (ntgts + novf);
+         std::cerr << " players of interest exceed 'maxPlayersOfInterest' (" << maxPlayers << ")" << std::endl;
+      }
+      poiOverflows += novf;
+   }
+
+   // Swap: the new TDB becomes current, and the old one becomes our spare
+   spareTdb = tdb.getRefPtr();
    setCurrentTdb(tdb0);
    tdb0->unref();
 
@@ -192,7 +192,6 @@ void IrSeeker::irRequestSignature(IrQueryMsg* const irQuery)
 
    // FAB - cannot use ownHdgOnly
    unsigned int ntgts{tdb0->computeBoresightData()};
-   if (ntgts > MAX_PLAYERS) ntgts = MAX_PLAYERS;
 
    // ---
    // If we have targets
@@ -4,6 +4,8 @@
 #include "mixr/models/player/Player.hpp"
 #include "mixr/models/system/Antenna.hpp"
 #include "mixr/models/Emission.hpp"
+#include "mixr/models/JammingModel.hpp"
+#include "mixr/models/WorldModel.hpp"
 
 #include "mixr/base/PairStream.hpp"
 #include "mixr/base/Pair.hpp"
@@ -32,12 +34,22 @@ void Jammer::copyData(const Jammer& org, const bool)
 }
 
 //------------------------------------------------------------------------------
-// transmit() -- send jam emissions
+// transmit() -- send jam emissions, or register with the world model's
+//               aggregated jamming model
 //------------------------------------------------------------------------------
 void Jammer::transmit(const double)
 {
-    // Send the emission to the other player
     if ( !areEmissionsDisabled() && isTransmitting() ) {
+
+        // Register with the jamming model, which sums our noise for the receivers
+        const WorldModel* wm{getWorldModel()};
+        JammingModel* jm{(wm != nullptr) ? wm->getJammingModel() : nullptr};
+        if (jm != nullptr) {
+            jm->addJammer(this);
+            return;
+        }
+
+        // Send the emission to the other player
         const auto em = new Emission();
         em->setFrequency(getFrequency());
         const double p{getPeakPower()};
@@ -5,6 +5,8 @@
 #include "mixr/models/system/Antenna.hpp"
 #include "mixr/models/system/trackmanager/TrackManager.hpp"
 #include "mixr/models/Emission.hpp"
+#include "mixr/models/JammingModel.hpp"
+#include "mixr/models/WorldModel.hpp"
 
 #include "mixr/base/numeric/Integer.hpp"
 #include "mixr/base/Pair.hpp"
@@ -18,11 +20,13 @@ namespace models {
 IMPLEMENT_PARTIAL_SUBCLASS(Radar, "Radar")
 
 BEGIN_SLOTTABLE(Radar)
-   "igain",    //  1: RF: Integrator gain (dB or no units; def: 1.0)
+   "igain",       //  1: RF: Integrator gain (dB or no units; def: 1.0)
+   "maxReports",  //  2: Max number of reports per scan
 END_SLOTTABLE(Radar)
 
 BEGIN_SLOT_MAP(Radar)
-    ON_SLOT(1,  setSlotIGain, base::Number)
+    ON_SLOT(1,  setSlotIGain,      base::Number)
+    ON_SLOT(2,  setSlotMaxReports, base::Number)
 END_SLOT_MAP()
 
 Radar::Radar()
@@ -32,6 +36,9 @@ Radar::Radar()
    setTransmitterEnableFlag(true);
    setReceiverEnabledFlag(true);
    setTypeId("RADAR");
+
+   reports.resize(maxRpts, nullptr);
+   rptMaxSn.resize(maxRpts);
 }
 
 Radar::Radar(const Radar& org)
@@ -66,6 +73,8 @@ void Radar::copyData(const Radar& org, const bool)
    // ---
    clearTracksAndQueues();
    endOfScanFlg = false;
+   setMaxReports(org.maxRpts);
+   numRptOverflows = 0;
 
    for (unsigned int i = 0; i < NUM_SWEEPS; i++) clearSweep(i);
    csweep = 0;
@@ -98,7 +107,7 @@ void Radar::clearTracksAndQueues()
 {
    // Clear reports
    base::lock(myLock);
-   for (unsigned int i = 0; i < numReports && i < MAX_REPORTS; i++) {
+   for (unsigned int i = 0; i < numReports; i++) {
       if (reports[i] != nullptr) {
          reports[i]->unref();
          reports[i] = nullptr;
@@ -134,6 +143,7 @@ void Radar::reset()
 {
    BaseClass::reset();
    clearTracksAndQueues();
+   numRptOverflows = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -147,6 +157,23 @@ bool Radar::setIGain(const double g)
    return true;
 }
 
+// Sets the max number of reports (per scan); never below the current number of reports
+bool Radar::setMaxReports(const unsigned int n)
+{
+   bool ok{};
+   if (n > 0) {
+      base::lock(myLock);
+      if (n >= numReports) {
+         maxRpts = n;
+         reports.resize(maxRpts, nullptr);
+         rptMaxSn.resize(maxRpts);
+         ok = true;
+      }
+      base::unlock(myLock);
+   }
+   return ok;
+}
+
 //------------------------------------------------------------------------------
 // transmit() -- send radar emissions
 //------------------------------------------------------------------------------
@@ -192,6 +219,12 @@ void Radar::receive(const double dt)
    csweep = computeSweepIndex( static_cast<double>(base::angle::R2DCC * getAntenna()->getAzimuth()) );
    clearSweep(csweep);
 
+   // Noise jamming of the jammers that are registered with the world
+   // model's jamming model, instead of their emissions
+   const WorldModel* wm{getWorldModel()};
+   const JammingModel* jm{(wm != nullptr) ? wm->getJammingModel() : nullptr};
+   if (jm != nullptr) jamSignal += jm->getJamSignal(this);
+
    // Compute noise level
    // CGB moved here from RfSystem
    // Basically, we're simulation Hannen's S/I equation from page 356 of his notes.
@@ -206,112 +239,75 @@ void Radar::receive(const double dt)
    // Process Returned Emissions
    // ---
 
-   Emission* em{};
-   double signal{};
+   // Take all of the returned emissions at once
+   const unsigned int n{takeReceivedEmissions(&rcvEms, &rcvSignals)};
 
-   // Get an emission from the queue
-   base::lock(packetLock);
-   if (np > 0) {
-      np--; // Decrement 'np', now the array index
-      em = packets[np];
-      signal = signals[np];
-   }
-   base::unlock(packetLock);
+   // Max range and the S/N offset from S/I: 10*log10(signal/noise) = S/I(dB) + 10*log10(I/N)
+   const double maxRng{getRange() * base::distance::NM2M};
+   const double snOffsetDb{10.0 * std::log10(interference / noise)};
 
-   while (em != nullptr) {
+   // 1) Compute the returned signals and their S/I (dB); no locks needed
+   rcvSirDb.resize(n);
+   for (unsigned int i = 0; i < n; i++) {
+      const Emission* const em{rcvEms[i]};
+      double signal{};
 
       // exclude noise jammers (accounted for already in RfSystem::rfReceivedEmission)
       if (em->getTransmitter() == this || (em->isECM() && !em->isECMType(Emission::ECM_NOISE)) ) {
 
          // compute the return trip loss ...
 
-         // Compute signal received
-         double rcs{em->getRCS()};
-
          // Signal Equation (Equation 2-7)
-         double rl{em->getRangeLoss()};
-         signal *= (rcs * rl);
+         signal = rcvSignals[i] * (em->getRCS() * em->getRangeLoss());
 
          // Integration gain
          signal *= rfIGain;
+      }
 
-         // Range attenuation: we don't want the strong signal from short range targets
-         double maxRng{getRange() * base::distance::NM2M};
-         //double maxRng4 = (maxRng*maxRng*maxRng*maxRng);
-         //double rng = (em->getRange());
-
-         const double s1{1.0};
-         //if (rng > 0) {
-         //    double rng4 = (rng*rng*rng*rng);
-         //    s1 = (rng4/maxRng4);
-         //    if (s1 > 1.0f) s1 = 1.0f;
-         //}
-         signal *= s1;
-
-         if (signal > 0.0) {
-
-            // Signal/Noise  (Equation 2-9)
-            const double signalToInterferenceRatio{signal / interference};
-            const double signalToInterferenceRatioDbl{10.0f * std::log10(signalToInterferenceRatio)};
-            const double signalToNoiseRatio{signal / noise};
-            const double signalToNoiseRatioDbl{10.0f * std::log10(signalToNoiseRatio)};
-
-            //std::cout << "Radar::receive(" << em->getTarget() << "): ";
-            //std::cout << " pwr=" << em->getPower();
-            //std::cout << " gain=" << em->getGain();
-            //std::cout << " rl=" << rl;
-            //std::cout << " rcs=" << rcs;
-            //std::cout << " signal=" << signal;
-            //std::cout << " recvN=" << getRfRecvNoise();
-            //std::cout << " signalToInterferenceRatio=" << signalToInterferenceRatio;
-            //std::cout << " signalToInterferenceRatioDbl=" << signalToInterferenceRatioDbl;
-            //std::cout << " thrs=" << getRfThreshold();
-            //std::cout << std::endl;
-
-            // Is S/N above receiver threshold and within 125% of max range?
-            // CGB, if "signal <= 0.0", then "signalToInterferenceRatioDbl" is probably invalid
-            // we should probably do something smart with "signalToInterferenceRatioDbl" above as well.
-            base::lock(myLock);
-            if (signalToInterferenceRatioDbl >= getRfThreshold() && em->getRange() <= (maxRng*1.25) && rptQueue.isNotFull()) {
-
-               // send the report to the track manager
-               em->ref();
-               rptQueue.put(em);
-               rptSnQueue.put(signalToInterferenceRatioDbl);
+      // Signal/Interference  (Equation 2-9); emissions without a signal are skipped below
+      rcvSignals[i] = signal;
+      rcvSirDb[i] = (signal > 0.0) ? (signal / interference) : 1.0;
+   }
+   for (unsigned int i = 0; i < n; i++) {
+      rcvSirDb[i] = 10.0 * std::log10(rcvSirDb[i]);
+   }
 
-               //std::cout << " (" << em->getRange() << ", " << signalToInterferenceRatioDbl << ", " << signalToInterferenceRatio << ", " << signalToInterferenceRatioDbl << ")";
+   // 2) Queue the reports for the track manager; a single lock
+   base::lock(myLock);
+   for (unsigned int i = 0; i < n; i++) {
+      Emission* const em{rcvEms[i]};
 
-               // Save signal for real-beam display
-               const int iaz{csweep};
-               const unsigned int irng{computeRangeIndex( em->getRange() )};
-               sweeps[iaz][irng] += (signalToInterferenceRatioDbl/100.0f);
-               vclos[iaz][irng] = em->getRangeRate();
+      // CGB, if "signal <= 0.0", then "signalToInterferenceRatioDbl" is probably invalid
+      if (rcvSignals[i] > 0.0) {
+         const double signalToInterferenceRatioDbl{rcvSirDb[i]};
+         const double signalToNoiseRatioDbl{signalToInterferenceRatioDbl + snOffsetDb};
 
-            } else if (signalToInterferenceRatioDbl < getRfThreshold() && signalToNoiseRatioDbl >= getRfThreshold()) {
-               countNumJammedEm++;
-            }
-            base::unlock(myLock);
-         }
-      }
+         // Is S/N above receiver threshold and within 125% of max range?
+         if (signalToInterferenceRatioDbl >= getRfThreshold() && em->getRange() <= (maxRng*1.25) && rptQueue.isNotFull()) {
 
-      em->unref();   // this unref() undoes the ref() done by RfSystem::rfReceivedEmission
-      em = nullptr;
+            // send the report to the track manager
+            em->ref();
+            rptQueue.put(em);
+            rptSnQueue.put(signalToInterferenceRatioDbl);
 
-      //if (np >= 0 && np < MAX_EMISSIONS) {
-      //    packets[np] = 0;
-      //    signals[np] = 0;
-      //}
+            // Save signal for real-beam display
+            const int iaz{csweep};
+            const unsigned int irng{computeRangeIndex( em->getRange() )};
+            sweeps[iaz][irng] += (signalToInterferenceRatioDbl/100.0f);
+            vclos[iaz][irng] = em->getRangeRate();
 
-      // Get another emission from the queue
-      base::lock(packetLock);
-      if (np > 0) {
-         np--;
-         em = packets[np];
-         signal = signals[np];
+         } else if (signalToInterferenceRatioDbl < getRfThreshold() && signalToNoiseRatioDbl >= getRfThreshold()) {
+            countNumJammedEm++;
+         }
       }
-      base::unlock(packetLock);
    }
-   //std::cout << std::endl;
+   base::unlock(myLock);
+
+   // this unref() undoes the ref() done by RfSystem::rfReceivedEmission
+   for (unsigned int i = 0; i < n; i++) {
+      rcvEms[i]->unref();
+   }
+   rcvEms.clear();
 
    numberOfJammedEmissions = countNumJammedEm;
 
@@ -346,7 +342,7 @@ void Radar::process(const double dt)
       endOfScanFlg = false;
 
       base::lock(myLock);
-      for (unsigned int i = 0; i < numReports && i < MAX_REPORTS; i++) {
+      for (unsigned int i = 0; i < numReports; i++) {
          if (tm != nullptr) {
             tm->newReport(reports[i], rptMaxSn[i]);
          }
@@ -405,11 +401,16 @@ void Radar::process(const double dt)
          // 3) Create a new report entry for the unmatched emission
          // ---
 
-         if (matched < 0 && numReports < MAX_REPORTS) {
-            em->ref();
-            reports[numReports] = em;
-            rptMaxSn[numReports] = snDbl;
-            numReports++;
+         if (matched < 0) {
+            if (numReports < maxRpts) {
+               em->ref();
+               reports[numReports] = em;
+               rptMaxSn[numReports] = snDbl;
+               numReports++;
+            }
+            else {
+               numRptOverflows++;
+            }
          }
          // finished
          em->unref();
@@ -543,5 +544,21 @@ bool Radar::setSlotIGain(base::Number* const v)
    return ok;
 }
 
+// maxReports: Max number of reports per scan
+bool Radar::setSlotMaxReports(const base::Number* const num)
+{
+   bool ok{};
+   if (num != nullptr) {
+      const int max{num->getInt()};
+      if (max > 0) {
+         ok = setMaxReports(static_cast<unsigned int>(max));
+      }
+      if (!ok) {
+         std::cerr << "Radar::setSlotMaxReports: maxReports must be greater than zero" << std::endl;
+      }
+   }
+   return ok;
+}
+
 }
 }
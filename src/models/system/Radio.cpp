@@ -17,7 +17,7 @@ namespace models {
 IMPLEMENT_SUBCLASS(Radio, "Radio")
 
 BEGIN_SLOTTABLE(Radio)
-   "numChannels",       // 1: Number of channels (less than or equal MAX_CHANNELS)
+   "numChannels",       // 1: Number of channels [ 0 .. 65535 ]
    "channels",          // 2: Our channels (list of base::Frequency objects)
    "channel",           // 3: Channel number [ 1 .. numChanels ]
    "maxDetectRange",    // 4: maximum detection capability (NM) (def: 120NM)
@@ -163,8 +163,6 @@ bool Radio::setChannelFrequency(const unsigned short chan, const double freq)
 // Sets the number of channels; previous channels are lost!
 bool Radio::setNumberOfChannels(const unsigned short n)
 {
-   bool ok{true};
-
    // When 'n' is zero
    if (n == 0) {
       // delete the old table
@@ -175,21 +173,15 @@ bool Radio::setNumberOfChannels(const unsigned short n)
       }
    }
 
-   // When 'n' is less than or equal to the max
-   else if (n <= MAX_CHANNELS) {
+   // Otherwise, the table is sized to 'n' channels
+   else {
       // delete the old table and create a new one.
       if (chanFreqTbl != nullptr) delete[] chanFreqTbl;
       chanFreqTbl = new double[n];
       numChan = n;
    }
 
-   // default:
-   else {
-      // nothing done
-      ok = false;
-   }
-
-   return ok;
+   return true;
 }
 
 // setMaxDetectRange() -- set the max range (NM)
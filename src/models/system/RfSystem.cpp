@@ -207,51 +207,115 @@ void RfSystem::processPlayersOfInterest()
 void RfSystem::rfReceivedEmission(Emission* const em, Antenna* const, double raGain)
 {
    // Queue up emissions for receive() to process
-   if (em != nullptr && isReceiverEnabled()) {
-
-      // Test to make sure the received emission is in-band before proceeding
-      if (affectsRfSystem(em)) {
-
-         // Pulses this radar frame (from emission)
-         //double pulses = static_cast<double>( em->getPulses() );
-         //if (pulses <= 0) pulses = 1.0f;
-
-         // Compute signal losses
-         //    Basically, we're simulating Hannen's S/I equation from page 356 of his notes.
-         //    Where I is N + J. J is noise from jamming.
-         //    Receiver Loss affects the total I, so we have to wait until J is added to N in Radar.
-         double losses{getRfSignalProcessLoss() * em->getAtmosphericAttenuationLoss() * em->getTransmitLoss()};
-         if (losses < 1.0) losses = 1.0;
-
-         // Range loss
-         const double rl{em->getRangeLoss()};
-
-         // Signal Equation (one way signal)
-         // Signal Equation (Part of equation 2-7)
-         // Signal (equation 3-3)
-         const double signal{em->getPower() * rl * raGain / losses};
-
-         // Noise Jammer -- add this signal to the total interference signal (noise)
-         if ( em->isECMType(Emission::ECM_NOISE) ) {
-            // CGB part of the noise jamming equation says we're only affected by the ratio of the
-            // transmitter and receiver bandwidths.
-            // It's possible that we'll want to account for this in the signal calculation above.
-            // But, for now, it is sufficient right here.
-            jamSignal += (signal * getBandwidth() / em->getBandwidth());
-         }
-
-         // Save packet and signal for receive()
-         base::lock(packetLock);
-         if (np < MAX_EMISSIONS) {
-            em->ref();
-            packets[np] = em;
-            signals[np] = signal;
-            np++;
-         }
-         base::unlock(packetLock);
+   double signal{};
+   if (em != nullptr && isReceiverEnabled() && computeReceivedSignal(em, raGain, &signal)) {
+
+      // Save packet and signal for receive()
+      base::lock(packetLock);
+      if (np < MAX_EMISSIONS) {
+         em->ref();
+         packets[np] = em;
+         signals[np] = signal;
+         np++;
+      }
+      base::unlock(packetLock);
+
+   }
+}
+
+//------------------------------------------------------------------------------
+// rfReceivedEmissions() -- process 'n' returned RF Emissions at once
+//------------------------------------------------------------------------------
+void RfSystem::rfReceivedEmissions(Emission* const* const ems, Antenna* const, const double* const raGains, const unsigned int n)
+{
+   if (ems == nullptr || raGains == nullptr || n == 0 || !isReceiverEnabled()) return;
+
+   // Compute the signals
+   rcvPackets.clear();
+   rcvSignals.clear();
+   for (unsigned int i = 0; i < n; i++) {
+      double signal{};
+      if (ems[i] != nullptr && computeReceivedSignal(ems[i], raGains[i], &signal)) {
+         rcvPackets.push_back(ems[i]);
+         rcvSignals.push_back(signal);
+      }
+   }
+
+   // Save the packets and signals for receive()
+   const unsigned int nr{static_cast<unsigned int>(rcvPackets.size())};
+   if (nr > 0) {
+      base::lock(packetLock);
+      for (unsigned int i = 0; i < nr && np < MAX_EMISSIONS; i++) {
+         rcvPackets[i]->ref();
+         packets[np] = rcvPackets[i];
+         signals[np] = rcvSignals[i];
+         np++;
+      }
+      base::unlock(packetLock);
+   }
+}
+
+//------------------------------------------------------------------------------
+// takeReceivedEmissions() -- takes all of the packets waiting for receive()
+//------------------------------------------------------------------------------
+unsigned int RfSystem::takeReceivedEmissions(std::vector<Emission*>* const ems, std::vector<double>* const sigs)
+{
+   ems->clear();
+   sigs->clear();
+
+   base::lock(packetLock);
+   const unsigned int n{np};
+   ems->insert(ems->end(), packets.rbegin() + (MAX_EMISSIONS - n), packets.rend());
+   sigs->insert(sigs->end(), signals.rbegin() + (MAX_EMISSIONS - n), signals.rend());
+   np = 0;
+   base::unlock(packetLock);
 
+   return n;
+}
+
+//------------------------------------------------------------------------------
+// computeReceivedSignal() -- received signal of an emission
+//------------------------------------------------------------------------------
+bool RfSystem::computeReceivedSignal(Emission* const em, const double raGain, double* const signalOut)
+{
+   bool ok{};
+
+   // Test to make sure the received emission is in-band before proceeding
+   if (affectsRfSystem(em)) {
+
+      // Pulses this radar frame (from emission)
+      //double pulses = static_cast<double>( em->getPulses() );
+      //if (pulses <= 0) pulses = 1.0f;
+
+      // Compute signal losses
+      //    Basically, we're simulating Hannen's S/I equation from page 356 of his notes.
+      //    Where I is N + J. J is noise from jamming.
+      //    Receiver Loss affects the total I, so we have to wait until J is added to N in Radar.
+      double losses{getRfSignalProcessLoss() * em->getAtmosphericAttenuationLoss() * em->getTransmitLoss()};
+      if (losses < 1.0) losses = 1.0;
+
+      // Range loss
+      const double rl{em->getRangeLoss()};
+
+      // Signal Equation (one way signal)
+      // Signal Equation (Part of equation 2-7)
+      // Signal (equation 3-3)
+      const double signal{em->getPower() * rl * raGain / losses};
+
+      // Noise Jammer -- add this signal to the total interference signal (noise)
+      if ( em->isECMType(Emission::ECM_NOISE) ) {
+         // CGB part of the noise jamming equation says we're only affected by the ratio of the
+         // transmitter and receiver bandwidths.
+         // It's possible that we'll want to account for this in the signal calculation above.
+         // But, for now, it is sufficient right here.
+         jamSignal += (signal * getBandwidth() / em->getBandwidth());
       }
+
+      *signalOut = signal;
+      ok = true;
    }
+
+   return ok;
 }
 
 
@@ -38,6 +38,26 @@ void AirAngleOnlyTrkMgr::copyData(const AirAngleOnlyTrkMgr& org, const bool)
     BaseClass::copyData(org);
 }
 
+//------------------------------------------------------------------------------
+// sizeWorkArrays() -- (Re)size the work arrays used by processTrackList()
+//------------------------------------------------------------------------------
+void AirAngleOnlyTrkMgr::sizeWorkArrays()
+{
+    BaseClass::sizeWorkArrays();
+
+    if (newSignal.size() != maxRpts) {
+        newSignal.resize(maxRpts);
+        newElevation.resize(maxRpts);
+        newAzimuth.resize(maxRpts);
+    }
+    if (uAzimuth.size() != maxTrks) {
+        uAzimuth.resize(maxTrks);
+        uElevation.resize(maxTrks);
+        age.resize(maxTrks);
+        haveU.resize(maxTrks);
+    }
+}
+
 //------------------------------------------------------------------------------
 // processTrackList() -- process the track list
 //------------------------------------------------------------------------------
@@ -50,11 +70,6 @@ void AirAngleOnlyTrkMgr::processTrackList(const double dt)
     // Make sure we have the A and B matrix
     //if (!haveMatrixA) makeMatrixA(dt);   // not used
 
-    // Report to Track matching matrix
-    unsigned int report2TrackMatch[MAX_REPORTS][MAX_TRKS]{};    // Report/Track matched matrix
-    unsigned int reportNumMatches[MAX_REPORTS]{};               // Number of matches for each report
-    unsigned int trackNumMatches[MAX_TRKS]{};                   // Number of matcher for each track
-
     // ---
     // 1)Age the tracks by delta time
     // ---
@@ -74,12 +89,8 @@ void AirAngleOnlyTrkMgr::processTrackList(const double dt)
 
     // Get each new IR query message report from the queue
     unsigned int nReports{};
-    IrQueryMsg* queryMessages[MAX_REPORTS]{};
-    double newSignal[MAX_REPORTS]{};
-    double newElevation[MAX_REPORTS]{};
-    double newAzimuth[MAX_REPORTS]{};
     double tmp{};
-    for (IrQueryMsg* q = getQuery(&tmp); q != nullptr && nReports < MAX_REPORTS; q = getQuery(&tmp)) {
+    for (IrQueryMsg* q = getQuery(&tmp); q != nullptr && nReports < maxRpts; q = getQuery(&tmp)) {
         Player* tgt{q->getTarget()};
 
         bool dummy{};
@@ -108,6 +119,7 @@ void AirAngleOnlyTrkMgr::processTrackList(const double dt)
 
     // Clean out the rest of the queue, if we had more than the maximum IR query messages
     for (IrQueryMsg* q = getQuery(&tmp); q != nullptr; q = getQuery(&tmp)) {
+        numRptOverflows++;
         q->unref();
     }
 
@@ -142,10 +154,6 @@ void AirAngleOnlyTrkMgr::processTrackList(const double dt)
     // ---
     // 5) Create inputs for current tracks
     // ---
-    double uAzimuth[MAX_TRKS]{};
-    double uElevation[MAX_TRKS]{};
-    double age[MAX_TRKS]{};
-    bool haveU[MAX_TRKS]{};
     base::lock(trkListLock);
     for (unsigned int it = 0; it < nTrks; it++) {
         haveU[it] = false;
@@ -310,6 +318,10 @@ void AirAngleOnlyTrkMgr::processTrackList(const double dt)
 
             tracks[nTrks++] = newTrk;
         }
+        else if (reportNumMatches[i] == 0) {
+            // No room for a new track
+            numTrkOverflows++;
+        }
         // Free the IR query message report
         queryMessages[i]->unref();
     }
@@ -116,8 +116,6 @@ void AirAngleOnlyTrkMgrPT::processTrackList(const double dt)
     Player* ownship{getOwnship()};
     if (ownship == nullptr) return;
 
-    IrQueryMsg* queryMessages[MAX_REPORTS]{};
-    unsigned int reportNumMatches[MAX_REPORTS]{};               // Number of matches for each report
     unsigned int nReports{};
 
     // ---
@@ -131,7 +129,7 @@ void AirAngleOnlyTrkMgrPT::processTrackList(const double dt)
     // ---
     // Get each new IR query message report from the queue
     double tmp{};
-    for (IrQueryMsg* q = getQuery(&tmp); q != nullptr && nReports < MAX_REPORTS; q = getQuery(&tmp)) {
+    for (IrQueryMsg* q = getQuery(&tmp); q != nullptr && nReports < maxRpts; q = getQuery(&tmp)) {
         Player* tgt{q->getTarget()};
 
         bool dummy{};
@@ -155,14 +153,12 @@ void AirAngleOnlyTrkMgrPT::processTrackList(const double dt)
 
     // Clean out the rest of the queue, if we had more than the maximum IR query messages
     for (IrQueryMsg* q = getQuery(&tmp); q != nullptr; q = getQuery(&tmp)) {
+        numRptOverflows++;
         q->unref();
     }
 
 
     if (nTrks > 0) {
-        // Report to Track matching matrix
-        unsigned int report2TrackMatch[MAX_REPORTS][MAX_TRKS]{};    // Report/Track matched matrix
-        unsigned int trackNumMatches[MAX_TRKS]{};                   // Number of matcher for each track
 
         if (nReports > 0) {
 
@@ -434,6 +430,10 @@ void AirAngleOnlyTrkMgrPT::processTrackList(const double dt)
 
             tracks[nTrks++] = newTrk;
         }
+        else if (reportNumMatches[i] == 0) {
+            // No room for a new track
+            numTrkOverflows++;
+        }
         // Free the IR query message report
         queryMessages[i]->unref();
     }
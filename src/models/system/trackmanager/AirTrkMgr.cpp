@@ -18,6 +18,8 @@
 #include "mixr/simulation/AbstractDataRecorder.hpp"
 #include "mixr/models/WorldModel.hpp"
 
+#include <algorithm>
+
 namespace mixr {
 namespace models {
 
@@ -45,20 +47,6 @@ AirTrkMgr::AirTrkMgr()
 void AirTrkMgr::initData()
 {
    setType( Track::ONBOARD_SENSOR_BIT | Track::AIR_TRACK_BIT );
-
-   reportNumMatches = new unsigned int[MAX_REPORTS];
-   trackNumMatches = new unsigned int[MAX_TRKS];
-   report2TrackMatch = new bool*[MAX_REPORTS];
-   for (unsigned int i = 0; i < MAX_REPORTS; i++) {
-      reportNumMatches[i] = 0;
-      report2TrackMatch[i] = new bool[MAX_TRKS];
-      for (unsigned int j = 0; j < MAX_TRKS; j++) {
-         report2TrackMatch[i][j] = false;
-      }
-   }
-   for (unsigned int i = 0; i < MAX_TRKS; i++) {
-      trackNumMatches[i] = 0;
-   }
 }
 
 void AirTrkMgr::copyData(const AirTrkMgr& org, const bool cc)
@@ -69,39 +57,30 @@ void AirTrkMgr::copyData(const AirTrkMgr& org, const bool cc)
    posGate = org.posGate;
    rngGate = org.rngGate;
    velGate = org.velGate;
-
-   for (unsigned int i = 0; i < MAX_REPORTS; i++) {
-      reportNumMatches[i] = org.reportNumMatches[i];
-      for (unsigned int j = 0; j < MAX_TRKS; j++) {
-         report2TrackMatch[i][j] = org.report2TrackMatch[i][j];
-      }
-   }
-   for (unsigned int i = 0; i < MAX_TRKS; i++) {
-      trackNumMatches[i] = org.trackNumMatches[i];
-   }
 }
 
 void AirTrkMgr::deleteData()
 {
-   if (report2TrackMatch != nullptr) {
-      for (unsigned int i = 0; i < MAX_REPORTS; i++) {
-         if (report2TrackMatch[i] != nullptr) {
-            delete[] report2TrackMatch[i];
-            report2TrackMatch[i] = nullptr;
-         }
-      }
-      delete[] report2TrackMatch;
-      report2TrackMatch = nullptr;
-   }
+}
 
-   if (reportNumMatches != nullptr) {
-      delete[] reportNumMatches;
-      reportNumMatches = nullptr;
-   }
+//------------------------------------------------------------------------------
+// sizeWorkArrays() -- (Re)size the work arrays used by processTrackList()
+//------------------------------------------------------------------------------
+void AirTrkMgr::sizeWorkArrays()
+{
+   BaseClass::sizeWorkArrays();
 
-   if (trackNumMatches != nullptr) {
-      delete[] trackNumMatches;
-      trackNumMatches = nullptr;
+   if (emissions.size() != maxRpts) {
+      emissions.resize(maxRpts, nullptr);
+      newSignal.resize(maxRpts);
+      newRdot.resize(maxRpts);
+      tgtPos.resize(maxRpts);
+   }
+   if (u.size() != maxTrks) {
+      u.resize(maxTrks);
+      age.resize(maxTrks);
+      haveU.resize(maxTrks);
+      trkIndex.reserve(maxTrks);
    }
 }
 
@@ -140,14 +119,10 @@ void AirTrkMgr::processTrackList(const double dt)
 
    // Get each new emission report from the queue
    unsigned int nReports{};
-   Emission* emissions[MAX_REPORTS]{};
-   double newSignal[MAX_REPORTS]{};
-   double newRdot[MAX_REPORTS]{};
-   base::Vec3d tgtPos[MAX_REPORTS]{};
    double tmp{};
    for (Emission* em = getReport(&tmp); em != nullptr; em = getReport(&tmp)) {
 
-      if (nReports < MAX_REPORTS) {
+      if (nReports < maxRpts) {
 
       Player* tgt{em->getTarget()};
 
@@ -175,6 +150,7 @@ void AirTrkMgr::processTrackList(const double dt)
    }
       else {
          // ignore -- too many reports
+      numRptOverflows++;
       em->unref();
    }
    }
@@ -183,20 +159,32 @@ void AirTrkMgr::processTrackList(const double dt)
    // 3) Match current tracks to new reports (observations)
    // ---
    base::lock(trkListLock);
+
+   // Index the tracks by their target
+   trkIndex.clear();
    for (unsigned int it = 0; it < nTrks; it++) {
       trackNumMatches[it] = 0;
       const RfTrack* const trk{static_cast<const RfTrack*>(tracks[it])};  // we produce only RfTracks
-      const Player* const tgt{trk->getLastEmission()->getTarget()};
-      for (unsigned int ir = 0; ir < nReports; ir++) {
-         if (emissions[ir]->getTarget() == tgt) {
-            // We have a new report for the same target as this track ...
-            report2TrackMatch[ir][it] = true;
-            trackNumMatches[it]++;
-            reportNumMatches[ir]++;
-         }
-         else report2TrackMatch[ir][it] = false;
+      trkIndex.push_back( std::make_pair(trk->getLastEmission()->getTarget(), it) );
+   }
+   std::sort(trkIndex.begin(), trkIndex.end());
+
+   // Look up each report's target
+   matches.clear();
+   for (unsigned int ir = 0; ir < nReports; ir++) {
+      const Player* const tgt{emissions[ir]->getTarget()};
+      auto p = std::lower_bound(trkIndex.begin(), trkIndex.end(), std::make_pair(tgt, 0u));
+      for (; p != trkIndex.end() && p->first == tgt; ++p) {
+         // We have a new report for the same target as this track ...
+         matches.push_back( std::make_pair(p->second, ir) );
+         trackNumMatches[p->second]++;
+         reportNumMatches[ir]++;
       }
    }
+
+   // Each track's reports, in report order
+   std::sort(matches.begin(), matches.end());
+
    base::unlock(trkListLock);
 
    // ---
@@ -208,33 +196,28 @@ void AirTrkMgr::processTrackList(const double dt)
    // ---
    // 5) Create inputs for current tracks
    // ---
-   base::Vec3d u[MAX_TRKS];
-   double age[MAX_TRKS]{};
-   bool haveU[MAX_TRKS]{};
 
    base::lock(trkListLock);
    for (unsigned int it = 0; it < nTrks; it++) {
       u[it].set(0,0,0);
       haveU[it] = false;
-      if (trackNumMatches[it] > 0) {
-         for (unsigned int ir = 0; ir < nReports; ir++) {
-            if (report2TrackMatch[ir][it]) {
-               RfTrack* const trk{static_cast<RfTrack*>(tracks[it])};  // we produce only RfTracks
-
-               // Update the track's signal
-               trk->setSignal(newSignal[ir],emissions[ir]);
-
-               // Create a track input vector
-               u[it] = (tgtPos[ir] - trk->getPosition());
-
-               // Track age and flags
-               if (!haveU[it]) {
-                  age[it] = trk->getTrackAge();
-                  tracks[it]->resetTrackAge();
-                  haveU[it] = true;
-               }
-            }
-         }
+   }
+   for (const auto& m : matches) {
+      const unsigned int it{m.first};
+      const unsigned int ir{m.second};
+      RfTrack* const trk{static_cast<RfTrack*>(tracks[it])};  // we produce only RfTracks
+
+      // Update the track's signal
+      trk->setSignal(newSignal[ir],emissions[ir]);
+
+      // Create a track input vector
+      u[it] = (tgtPos[ir] - trk->getPosition());
+
+      // Track age and flags
+      if (!haveU[it]) {
+         age[it] = trk->getTrackAge();
+         tracks[it]->resetTrackAge();
+         haveU[it] = true;
       }
    }
    base::unlock(trkListLock);
@@ -352,6 +335,10 @@ void AirTrkMgr::processTrackList(const double dt)
 
          tracks[nTrks++] = newTrk;
       }
+      else if (reportNumMatches[i] == 0) {
+         // No room for a new track
+         numTrkOverflows++;
+      }
       // Free the emission report
       emissions[i]->unref();
    }
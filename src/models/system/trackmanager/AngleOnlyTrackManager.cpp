@@ -35,12 +35,12 @@ BEGIN_SLOT_MAP(AngleOnlyTrackManager)
     ON_SLOT(2, setSlotElevationBin, base::Number)
 END_SLOT_MAP()
 
-AngleOnlyTrackManager::AngleOnlyTrackManager() : queryQueue(MAX_TRKS)
+AngleOnlyTrackManager::AngleOnlyTrackManager()
 {
     STANDARD_CONSTRUCTOR()
 }
 
-AngleOnlyTrackManager::AngleOnlyTrackManager(const AngleOnlyTrackManager& org) : queryQueue(MAX_TRKS)
+AngleOnlyTrackManager::AngleOnlyTrackManager(const AngleOnlyTrackManager& org)
 {
     STANDARD_CONSTRUCTOR()
     copyData(org, true);
@@ -95,10 +95,11 @@ void AngleOnlyTrackManager::clearTracksAndQueues()
     // Clear out the queue(s)
     // ---
     base::lock(queueLock);
-    for (IrQueryMsg* q = queryQueue.get(); q != nullptr; q = queryQueue.get()) {
+    for (IrQueryMsg* q : queryQueue) {
         q->unref();     // unref() the IR query message
-        snQueue.get();  // and every IR query message had a S/N value
     }
+    queryQueue.clear();
+    snQueue.clear();    // and every IR query message had a S/N value
     base::unlock(queueLock);
 
     // ---
@@ -122,10 +123,15 @@ void AngleOnlyTrackManager::newReport(IrQueryMsg* q, double sn)
 {
     // Queue up IR query messages reports
     if (q != nullptr) {
-        q->ref();
         base::lock(queueLock);
-        queryQueue.put(q);
-        snQueue.put(sn);
+        if (queryQueue.size() < maxRpts) {
+            q->ref();
+            queryQueue.push_back(q);
+            snQueue.push_back(sn);
+        }
+        else {
+            numRptOverflows++;
+        }
         base::unlock(queueLock);
     }
 }
@@ -138,15 +144,29 @@ IrQueryMsg* AngleOnlyTrackManager::getQuery(double* const sn)
     IrQueryMsg* q{};
 
     base::lock(queueLock);
-    q = queryQueue.get();
-    if (q != nullptr) {
-        *sn = snQueue.get();
+    if (!queryQueue.empty()) {
+        q = queryQueue.front();
+        queryQueue.pop_front();
+        *sn = snQueue.front();
+        snQueue.pop_front();
     }
     base::unlock(queueLock);
 
     return q;
 }
 
+//------------------------------------------------------------------------------
+// sizeWorkArrays() -- (Re)size the work arrays used by processTrackList()
+//------------------------------------------------------------------------------
+void AngleOnlyTrackManager::sizeWorkArrays()
+{
+    BaseClass::sizeWorkArrays();
+
+    if (queryMessages.size() != maxRpts) {
+        queryMessages.resize(maxRpts, nullptr);
+    }
+}
+
 //------------------------------------------------------------------------------
 // addTrack() -- Add a track to the list
 //------------------------------------------------------------------------------
@@ -160,6 +180,9 @@ bool AngleOnlyTrackManager::addTrack(Track* const t)
         tracks[nTrks++] = t;
         ok = true;
     }
+    else {
+        numTrkOverflows++;
+    }
     base::unlock(trkListLock);
 
     return ok;
@@ -33,59 +33,35 @@ GmtiTrkMgr::GmtiTrkMgr()
 void GmtiTrkMgr::initData()
 {
    setType( Track::ONBOARD_SENSOR_BIT | Track::GND_TRACK_BIT );
-
-   reportNumMatches = new unsigned int[MAX_REPORTS];
-   trackNumMatches = new unsigned int[MAX_TRKS];
-   report2TrackMatch = new bool*[MAX_REPORTS];
-   for (unsigned int i = 0; i < MAX_REPORTS; i++) {
-      reportNumMatches[i] = 0;
-      report2TrackMatch[i] = new bool[MAX_TRKS];
-      for (unsigned int j = 0; j < MAX_TRKS; j++) {
-         report2TrackMatch[i][j] = false;
-      }
-   }
-   for (unsigned int i = 0; i < MAX_TRKS; i++) {
-      trackNumMatches[i] = 0;
-   }
 }
 
 void GmtiTrkMgr::copyData(const GmtiTrkMgr& org, const bool cc)
 {
    BaseClass::copyData(org);
    if (cc) initData();
-
-   for (unsigned int i = 0; i < MAX_REPORTS; i++) {
-      reportNumMatches[i] = org.reportNumMatches[i];
-      for (unsigned int j = 0; j < MAX_TRKS; j++) {
-         report2TrackMatch[i][j] = org.report2TrackMatch[i][j];
-      }
-   }
-   for (unsigned int i = 0; i < MAX_TRKS; i++) {
-      trackNumMatches[i] = org.trackNumMatches[i];
-   }
 }
 
 void GmtiTrkMgr::deleteData()
 {
-   if (report2TrackMatch != nullptr) {
-      for (unsigned int i = 0; i < MAX_REPORTS; i++) {
-         if (report2TrackMatch[i] != nullptr) {
-            delete[] report2TrackMatch[i];
-            report2TrackMatch[i] = nullptr;
-         }
-      }
-      delete[] report2TrackMatch;
-      report2TrackMatch = nullptr;
-   }
+}
 
-   if (reportNumMatches != nullptr) {
-      delete[] reportNumMatches;
-      reportNumMatches = nullptr;
-   }
+//------------------------------------------------------------------------------
+// sizeWorkArrays() -- (Re)size the work arrays used by processTrackList()
+//------------------------------------------------------------------------------
+void GmtiTrkMgr::sizeWorkArrays()
+{
+   BaseClass::sizeWorkArrays();
 
-   if (trackNumMatches != nullptr) {
-      delete[] trackNumMatches;
-      trackNumMatches = nullptr;
+   if (emissions.size() != maxRpts) {
+      emissions.resize(maxRpts, nullptr);
+      newSignal.resize(maxRpts);
+      newRdot.resize(maxRpts);
+      tgtPos.resize(maxRpts);
+   }
+   if (u.size() != maxTrks) {
+      u.resize(maxTrks);
+      age.resize(maxTrks);
+      haveU.resize(maxTrks);
    }
 }
 
@@ -120,13 +96,9 @@ void GmtiTrkMgr::processTrackList(const double dt)
 
    // Get each new emission report from the queue
    unsigned int nReports{};
-   Emission* emissions[MAX_REPORTS]{};
-   double newSignal[MAX_REPORTS]{};
-   double newRdot[MAX_REPORTS]{};
-   base::Vec3d tgtPos[MAX_REPORTS];
    double tmp{};
    for (Emission* em = getReport(&tmp); em != nullptr; em = getReport(&tmp)) {
-      if (nReports < MAX_REPORTS) {
+      if (nReports < maxRpts) {
       Player* tgt{em->getTarget()};
       if (tgt->isMajorType(Player::GROUND_VEHICLE)) {
          // Using only Ground vehicles
@@ -143,6 +115,7 @@ void GmtiTrkMgr::processTrackList(const double dt)
    }
       else {
          // ignore -- too many reports
+      numRptOverflows++;
       em->unref();
    }
    }
@@ -176,9 +149,6 @@ void GmtiTrkMgr::processTrackList(const double dt)
    // ---
    // 5) Create inputs for current tracks
    // ---
-   base::Vec3d u[MAX_TRKS];
-   double age[MAX_TRKS]{};
-   bool haveU[MAX_TRKS]{};
    base::lock(trkListLock);
    for (unsigned int it = 0; it < nTrks; it++) {
       u[it].set(0,0,0);
@@ -311,6 +281,10 @@ void GmtiTrkMgr::processTrackList(const double dt)
 
          tracks[nTrks++] = newTrk;
       }
+      else if (reportNumMatches[i] == 0) {
+         // No room for a new track
+         numTrkOverflows++;
+      }
       // Free the emission report
       emissions[i]->unref();
    }
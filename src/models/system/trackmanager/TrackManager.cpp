@@ -26,6 +26,7 @@ BEGIN_SLOTTABLE(TrackManager)
    "beta",             // 5: Beta
    "gamma",            // 6: Gamma
    "logTrackUpdates",  // 7: whether to log all updates to tracks (default: true)
+   "maxReports",       // 8: Maximum number of reports per frame
 END_SLOTTABLE(TrackManager)
 
 BEGIN_SLOT_MAP(TrackManager)
@@ -36,11 +37,14 @@ BEGIN_SLOT_MAP(TrackManager)
    ON_SLOT(5, setSlotBeta,            base::Number)
    ON_SLOT(6, setSlotGamma,           base::Number)
    ON_SLOT(7, setSlotLogTrackUpdates, base::Number)
+   ON_SLOT(8, setSlotMaxReports,      base::Number)
 END_SLOT_MAP()
 
 TrackManager::TrackManager()
 {
    STANDARD_CONSTRUCTOR()
+
+   tracks.resize(maxTrks, nullptr);
 }
 
 TrackManager::TrackManager(const TrackManager& org)
@@ -71,9 +75,12 @@ void TrackManager::copyData(const TrackManager& org, const bool)
 
    logTrackUpdates = org.logTrackUpdates;
 
-   maxTrks = org.maxTrks;
    maxTrackAge = org.maxTrackAge;
    clearTracksAndQueues();
+   setMaxTracks(org.maxTrks);
+   setMaxReports(org.maxRpts);
+   numRptOverflows = 0;
+   numTrkOverflows = 0;
 
    type = org.type;
    firstTrkId = org.firstTrkId;
@@ -106,10 +113,11 @@ void TrackManager::clearTracksAndQueues()
    // Clear out the queue(s)
    // ---
    base::lock(queueLock);
-   for (Emission* em = emQueue.get(); em != nullptr; em = emQueue.get()) {
+   for (Emission* em : emQueue) {
       em->unref();    // unref() the emission
-      snQueue.get();  // and every emission had a S/N value
    }
+   emQueue.clear();
+   snQueue.clear();   // and every emission had a S/N value
    base::unlock(queueLock);
 
    // ---
@@ -137,6 +145,8 @@ void TrackManager::reset()
 
    clearTracksAndQueues();
    nextTrkId = firstTrkId;
+   numRptOverflows = 0;
+   numTrkOverflows = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -154,6 +164,7 @@ bool TrackManager::shutdownNotification()
 //------------------------------------------------------------------------------
 void TrackManager::process(const double dt)
 {
+   sizeWorkArrays();
    processTrackList(dt);
    BaseClass::process(dt);
 }
@@ -176,6 +187,11 @@ unsigned int TrackManager::getNumTracks() const
    return nTrks;
 }
 
+unsigned int TrackManager::getMaxReports() const
+{
+   return maxRpts;
+}
+
 bool TrackManager::isType(const short t) const
 {
    return ((type & t) != 0);
@@ -201,6 +217,52 @@ bool TrackManager::getLogTrackUpdates() const
    return logTrackUpdates;
 }
 
+//------------------------------------------------------------------------------
+// setMaxTracks() -- Sets the maximum number of tracks; the track list is
+//                   resized, but never below the current number of tracks.
+//------------------------------------------------------------------------------
+bool TrackManager::setMaxTracks(const unsigned int n)
+{
+   bool ok{};
+   if (n > 0) {
+      base::lock(trkListLock);
+      if (n >= nTrks) {
+         maxTrks = n;
+         tracks.resize(maxTrks, nullptr);
+         ok = true;
+      }
+      base::unlock(trkListLock);
+   }
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// setMaxReports() -- Sets the maximum number of reports processed per frame
+//------------------------------------------------------------------------------
+bool TrackManager::setMaxReports(const unsigned int n)
+{
+   bool ok{};
+   if (n > 0) {
+      maxRpts = n;
+      ok = true;
+   }
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// sizeWorkArrays() -- (Re)size the report/track association work arrays
+//------------------------------------------------------------------------------
+void TrackManager::sizeWorkArrays()
+{
+   if (reportNumMatches.size() != maxRpts || trackNumMatches.size() != maxTrks) {
+      reportNumMatches.assign(maxRpts, 0);
+      trackNumMatches.assign(maxTrks, 0);
+      if (usesMatchMatrix()) {
+         report2TrackMatch.assign(maxRpts, std::vector<unsigned char>(maxTrks, 0));
+      }
+   }
+}
+
 bool TrackManager::setMaxTrackAge(const double s)
 {
    bool ok{};
@@ -303,10 +365,13 @@ void TrackManager::newReport(Emission* em, double sn)
    // Queue up emissions reports
    if (em != nullptr) {
       base::lock(queueLock);
-      if (emQueue.isNotFull()) {
-      em->ref();
-      emQueue.put(em);
-      snQueue.put(sn);
+      if (emQueue.size() < maxRpts) {
+         em->ref();
+         emQueue.push_back(em);
+         snQueue.push_back(sn);
+      }
+      else {
+         numRptOverflows++;
       }
       base::unlock(queueLock);
    }
@@ -320,9 +385,11 @@ Emission* TrackManager::getReport(double* const sn)
    Emission* em{};
 
    base::lock(queueLock);
-   em = emQueue.get();
-   if (em != nullptr) {
-      *sn = snQueue.get();
+   if (!emQueue.empty()) {
+      em = emQueue.front();
+      emQueue.pop_front();
+      *sn = snQueue.front();
+      snQueue.pop_front();
    }
    base::unlock(queueLock);
 
@@ -342,6 +409,9 @@ bool TrackManager::addTrack(Track* const t)
       tracks[nTrks++] = t;
       ok = true;
    }
+   else {
+      numTrkOverflows++;
+   }
    base::unlock(trkListLock);
 
    return ok;
@@ -379,11 +449,29 @@ bool TrackManager::setSlotMaxTracks(const base::Number* const num)
    bool ok{};
    if (num != nullptr) {
       const int max{num->getInt()};
-      if (max > 0 && max <= static_cast<int>(MAX_TRKS)) {
-         maxTrks = static_cast<unsigned int>(max);
-         ok = true;
-      } else {
-         std::cerr << "TrackManager::setMaxTracks: maxTracks is invalid, range: [1 .. " << MAX_TRKS << "]" << std::endl;
+      if (max > 0) {
+         ok = setMaxTracks(static_cast<unsigned int>(max));
+      }
+      if (!ok) {
+         std::cerr << "TrackManager::setMaxTracks: maxTracks is invalid, must be greater than zero" << std::endl;
+      }
+   }
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// setSlotMaxReports() -- Sets the maximum number of reports per frame
+//------------------------------------------------------------------------------
+bool TrackManager::setSlotMaxReports(const base::Number* const num)
+{
+   bool ok{};
+   if (num != nullptr) {
+      const int max{num->getInt()};
+      if (max > 0) {
+         ok = setMaxReports(static_cast<unsigned int>(max));
+      }
+      if (!ok) {
+         std::cerr << "TrackManager::setMaxReports: maxReports is invalid, must be greater than zero" << std::endl;
       }
    }
    return ok;
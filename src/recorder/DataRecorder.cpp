@@ -56,6 +56,7 @@ BEGIN_RECORDER_HANDLER_TABLE(DataRecorder)
    ON_RECORDER_EVENT_ID( REID_MARKER,            recordMarker )
    ON_RECORDER_EVENT_ID( REID_DI_EVENT,          recordDI )
    ON_RECORDER_EVENT_ID( REID_AI_EVENT,          recordAI )
+   ON_RECORDER_EVENT_ID( REID_CLASS_STATS,       recordClassStats )
 
    ON_RECORDER_EVENT_ID( REID_NEW_PLAYER,        recordNewPlayer )
    ON_RECORDER_EVENT_ID( REID_PLAYER_REMOVED,    recordPlayerRemoved )
@@ -250,6 +251,40 @@ bool DataRecorder::recordDI(const base::Object* objs[4], const double values[4])
 }
 
 
+//------------------------------------------------------------------------------
+// Class instance statistics handler
+//    objs[0]  => factory name
+//    value[0] => live instances
+//    value[1] => peak instances
+//    value[2] => approximate bytes
+//    value[3] => instances created per second
+//------------------------------------------------------------------------------
+bool DataRecorder::recordClassStats(const base::Object* objs[4], const double values[4])
+{
+   const auto name = dynamic_cast<const base::String*>( objs[0] );
+   if (name == nullptr) return false;
+
+   const auto msg = new pb::DataRecord();
+
+   // DataRecord header
+   timeStamp(msg);
+   msg->set_id( REID_CLASS_STATS );
+
+   // new Class Stats message
+   pb::ClassStatsMsg* statsMsg {msg->mutable_class_stats_msg()};
+   statsMsg->set_name( name->getString() );
+   statsMsg->set_live( static_cast<unsigned int>(base::nintd(values[0])) );
+   statsMsg->set_peak( static_cast<unsigned int>(base::nintd(values[1])) );
+   statsMsg->set_bytes( static_cast<unsigned long long>(values[2]) );
+   statsMsg->set_alloc_rate( values[3] );
+
+   // Send the message for processing
+   sendDataRecord(msg);
+
+   return true;
+}
+
+
 //------------------------------------------------------------------------------
 // New player event handler
 //    objs[0] => the new player
@@ -60,6 +60,7 @@ void TabPrinter::setMsgHeaders(const bool f)
    trackDataHdr = f;
    markerHdr = f;
    inputDeviceHdr = f;
+   classStatsHdr = f;
 
    playerHeader = f;
    weaponHeader = f;
@@ -318,6 +319,16 @@ void TabPrinter::processRecordImp(const DataRecordHandle* const handle)
          }
          break;
       }
+      case REID_CLASS_STATS: {
+         // Class instance statistics msg with name, counts, memory and time fields.
+         if (dataRecord->has_class_stats_msg()) {
+            if ((option == MsgHdrOptions::NEW_MSG) && (classStatsHdr)) printHeader = true;
+            classStatsHdr = false;
+            const pb::ClassStatsMsg* msg{&dataRecord->class_stats_msg()};
+            printClassStatsMsg(timeMsg, msg);
+         }
+         break;
+      }
       case REID_AI_EVENT: {
          // Analog Input device msg with ID, source, value, and time fields.
          if (dataRecord->has_input_device_msg()) {
@@ -1704,6 +1715,61 @@ void TabPrinter::printMarkerMsg(const pb::Time* const timeMsg, const pb::MarkerM
 }
 
 
+//------------------------------------------------------------------------------
+// printClassStatsMsg
+//------------------------------------------------------------------------------
+void TabPrinter::printClassStatsMsg(const pb::Time* const timeMsg, const pb::ClassStatsMsg* const msg)
+{
+   std::stringstream sout;
+
+   if (printHeader) {
+      sout << "CLASS STATS" << divider << "MESSAGE" << divider << "HEADER" << divider;
+      printTimeMsgHdr(sout);  // time header
+      sout << "CLASS" << divider << "LIVE" << divider << "PEAK" << divider << "BYTES" << divider << "ALLOCS/SEC" << divider;
+
+      printToOutput( sout.str().c_str() );
+      sout.str("");
+   }
+
+   sout << "CLASS STATS" << divider << "MESSAGE" << divider << "DATA" << divider;
+
+   printTimeMsg(sout, timeMsg);
+   if (msg != nullptr) {
+      sout << msg->name() << divider;
+
+      if (msg->has_live()) {
+         sout << msg->live() << divider;
+      }
+      else sout << divider;
+
+      if (msg->has_peak()) {
+         sout << msg->peak() << divider;
+      }
+      else sout << divider;
+
+      if (msg->has_bytes()) {
+         sout << msg->bytes() << divider;
+      }
+      else sout << divider;
+
+      if (msg->has_alloc_rate()) {
+         sout << msg->alloc_rate() << divider;
+      }
+      else sout << divider;
+   }
+   else {
+      // bad pointer; print spacers
+      sout <<  divider;    // CLASS
+      sout <<  divider;    // LIVE
+      sout <<  divider;    // PEAK
+      sout <<  divider;    // BYTES
+      sout <<  divider;    // ALLOCS/SEC
+   }
+
+   printToOutput( sout.str().c_str() );
+}
+
+
 //------------------------------------------------------------------------------
 // printInputDeviceMsg
 //------------------------------------------------------------------------------
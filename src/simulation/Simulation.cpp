@@ -575,6 +575,9 @@ void Simulation::updateTC(const double dt)
             std::cerr << "; numTcThreads = " << numTcThreads;
             std::cerr << std::endl;
          }
+
+         // All players have completed this phase
+         phaseCompleted(currentPlayerList, f);
       }
    }
 
@@ -634,11 +637,25 @@ void Simulation::updateData(const double dt)
     if (players != nullptr) {
          base::safe_ptr<base::PairStream> currentPlayerList = players;
 
+         // Batched work, which is completed before the players are updated
+         const bool batch{bgBatchStarted(currentPlayerList, dt0)};
+
          if (reqBgThreads == 1) {
             // Our single thread
+            if (batch) updateBgBatch(1, 1);
             updateBgPlayerList(currentPlayerList, dt0, 1, 1);
          } else if (numBgThreads > 0) {
             // multiple threads
+            if (batch) {
+               for (int i = 0; i < numBgThreads; i++) {
+                  unsigned int idx {static_cast<unsigned int>(i+1)};
+                  bgThreads[i]->startBatch(idx, reqBgThreads);
+               }
+               updateBgBatch(reqBgThreads, reqBgThreads);
+               base::SyncThread** pp = reinterpret_cast<base::SyncThread**>(&bgThreads[0]);
+               base::SyncThread::waitForAllCompleted(pp, numBgThreads);
+            }
+
             for (int i = 0; i < numBgThreads; i++) {
                // assign the threads from the pool
                unsigned int idx {static_cast<unsigned int>(i+1)};
@@ -688,6 +705,18 @@ void Simulation::updateBgPlayerList(
    }
 }
 
+//------------------------------------------------------------------------------
+// Background batched work: none by default
+//------------------------------------------------------------------------------
+bool Simulation::bgBatchStarted(base::PairStream* const, const double)
+{
+   return false;
+}
+
+void Simulation::updateBgBatch(const unsigned int, const unsigned int)
+{
+}
+
 //------------------------------------------------------------------------------
 // printTimingStats() -- Update time critical stuff here
 //------------------------------------------------------------------------------
@@ -1250,6 +1279,11 @@ void Simulation::setPhase(const unsigned int c)
    phaseCnt = c;
 }
 
+// Called after all players have completed a phase
+void Simulation::phaseCompleted(base::PairStream* const, const unsigned int)
+{
+}
+
 // Sets the simulation event ID counter
 void Simulation::setEventID(unsigned short id)
 {
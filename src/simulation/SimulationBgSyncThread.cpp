@@ -24,14 +24,36 @@ void SimulationBgSyncThread::start0(
    dt0 = dt1;
    idx0 = idx1;
    n0 = n1;
+   batch0 = false;
+
+   signalStart();
+}
+
+void SimulationBgSyncThread::startBatch(
+         const unsigned int idx1,
+         const unsigned int n1
+      )
+{
+   pl0 = nullptr;
+   idx0 = idx1;
+   n0 = n1;
+   batch0 = true;
 
    signalStart();
 }
 
 unsigned long SimulationBgSyncThread::userFunc()
 {
+   // Our part of the batch, if our index is valid ...
+   if (batch0) {
+      if (idx0 > 0 && idx0 <= n0) {
+         Simulation* sim{static_cast<Simulation*>(getParent())};
+         sim->updateBgBatch(idx0, n0);
+      }
+   }
+
    // Make sure we've a player list and our index is valid ...
-   if (pl0 != nullptr && idx0 > 0 && idx0 <= n0) {
+   else if (pl0 != nullptr && idx0 > 0 && idx0 <= n0) {
       // then call the simulation executives update TC player list functions
       Simulation* sim{static_cast<Simulation*>(getParent())};
       sim->updateBgPlayerList(pl0, dt0, idx0, n0);
@@ -25,6 +25,13 @@ public:
       const unsigned int n0
    );
 
+   // Parent thread signals start of this child thread's part of the batch
+   // (see Simulation::updateBgBatch())
+   void startBatch(
+      const unsigned int idx0,
+      const unsigned int n0
+   );
+
 private:
    // SyncTask class function -- our userFunc()
    unsigned long userFunc() final;
@@ -34,6 +41,7 @@ private:
    double dt0{};
    unsigned int idx0{};
    unsigned int n0{};
+   bool batch0{};
 };
 
 }
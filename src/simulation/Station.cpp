@@ -9,9 +9,11 @@
 #include "mixr/simulation/Simulation.hpp"
 
 #include "mixr/base/concepts/linkage/AbstractIoHandler.hpp"
+#include "mixr/base/MetaObject.hpp"
 #include "mixr/base/numeric/Number.hpp"
 #include "mixr/base/Pair.hpp"
 #include "mixr/base/PairStream.hpp"
+#include "mixr/base/String.hpp"
 #include "mixr/base/Timers.hpp"
 #include "mixr/base/units/Times.hpp"
 
@@ -47,8 +49,9 @@ BEGIN_SLOTTABLE(Station)
    "bgPriority",         // 14: Background thread priority
    "bgStackSize",        // 15: Background thread stack size (default: <system default size>)
    "startupResetTimer",  // 16: Startup (initial) RESET event timer value (base::Time) (default: no reset event)
-   "enableUpdateTimers", // 17: Enable calling base::Timers::updateTimers() from updateTC() (default: false)
+   "enableUpdateTimers", // 17: Enable calling base::Timers::updateTimers() from updateTC() and the background tasks (default: false)
    "dataRecorder",       // 18) Our Data Recorder
+   "classStatsPeriod",   // 19) Class statistics record period (base::Time) (default: 0 -- no records)
 END_SLOTTABLE(Station)
 
 BEGIN_SLOT_MAP(Station)
@@ -79,6 +82,7 @@ BEGIN_SLOT_MAP(Station)
    ON_SLOT(17, setSlotEnableUpdateTimers,    base::Number)
 
    ON_SLOT(18, setSlotDataRecorder,           AbstractDataRecorder)
+   ON_SLOT(19, setSlotClassStatsPeriod,       base::Time)
 END_SLOT_MAP()
 
 Station::Station()
@@ -161,6 +165,9 @@ void Station::copyData(const Station& org, const bool)
 
    startupResetTimer = org.startupResetTimer;
 
+   classStatsPeriod = org.classStatsPeriod;
+   classStatsTimer = 0.0;
+
    // Unref our old stuff (if any)
    if (ownshipName != nullptr)      { ownshipName->unref(); ownshipName = nullptr; }
    if (ownship != nullptr)          { ownship->unref(); ownship = nullptr; }
@@ -257,9 +264,9 @@ void Station::reset()
 //------------------------------------------------------------------------------
 void Station::updateTC(const double dt)
 {
-   // Update the base::Timers
+   // Update the time-critical thread's base::Timers
    if (isUpdateTimersEnabled()) {
-      base::Timer::updateTimers(dt);
+      base::Timer::updateTimers(dt, base::Timer::Wheel::TC);
    }
 
    // the I/O handler
@@ -518,6 +525,11 @@ void Station::processBackgroundTasks(const double dt)
    // Note: interoperability networks are handled by
    // processNetworkInputTasks() and processNetworkOutputTasks()
 
+   // Update the background thread's base::Timers
+   if (isUpdateTimersEnabled()) {
+      base::Timer::updateTimers(dt, base::Timer::Wheel::BG);
+   }
+
    // The I/O handlers
    if (ioHandler != nullptr) {
       ioHandler->updateData(dt);
@@ -526,6 +538,12 @@ void Station::processBackgroundTasks(const double dt)
    // Our simulation model
    if (sim != nullptr) sim->updateData(dt);
 
+   // Periodic class statistics records
+   classStatsTimer += dt;
+   if (classStatsPeriod > 0.0 && classStatsTimer >= classStatsPeriod) {
+      recordClassStatistics();
+   }
+
    // Our image generator host interfaces
    if (igHosts != nullptr) {
       base::List::Item* item{igHosts->getFirstItem()};
@@ -539,6 +557,38 @@ void Station::processBackgroundTasks(const double dt)
 }
 
 
+//------------------------------------------------------------------------------
+// printClassStatistics() -- prints the class instance and memory statistics
+//------------------------------------------------------------------------------
+void Station::printClassStatistics(std::ostream& sout)
+{
+   base::MetaObject::updateAllocationRates(classStatsTimer);
+   classStatsTimer = 0.0;
+   base::MetaObject::printStatistics(sout);
+}
+
+//------------------------------------------------------------------------------
+// recordClassStatistics() -- records the statistics of each class with live
+//                            instances to the data recorder
+//------------------------------------------------------------------------------
+void Station::recordClassStatistics()
+{
+   base::MetaObject::updateAllocationRates(classStatsTimer);
+   classStatsTimer = 0.0;
+
+   if (dataRecorder == nullptr) return;
+
+   for (const base::MetaObject* p = base::MetaObject::getFirst(); p != nullptr; p = p->getNext()) {
+      if (p->count > 0) {
+         const base::String name(p->getFactoryName());
+         BEGIN_RECORD_DATA_SAMPLE( dataRecorder, REID_CLASS_STATS )
+            SAMPLE_1_OBJECT( &name )
+            SAMPLE_4_VALUES( p->count, p->mc, static_cast<double>(p->getApproxBytes()), p->getAllocationRate() )
+         END_RECORD_DATA_SAMPLE()
+      }
+   }
+}
+
 //------------------------------------------------------------------------------
 // processNetworkInputTasks() -- Process network input tasks
 //------------------------------------------------------------------------------
@@ -1188,6 +1238,22 @@ bool Station::setSlotStartupResetTime(const base::Time* const num)
 }
 
 
+//------------------------------------------------------------------------------
+// setSlotClassStatsPeriod() -- Sets the class statistics record period
+//------------------------------------------------------------------------------
+bool Station::setSlotClassStatsPeriod(const base::Time* const x)
+{
+   bool ok{};
+   if (x != nullptr) {
+      const double t{base::Seconds::convertStatic(*x)};
+      if (t >= 0.0) {
+         classStatsPeriod = t;
+         ok = true;
+      }
+   }
+   return ok;
+}
+
 //------------------------------------------------------------------------------
 // Sets the fast forward rate
 //------------------------------------------------------------------------------
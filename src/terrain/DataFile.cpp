@@ -5,6 +5,9 @@
 #include "mixr/base/units/angle_utils.hpp"
 #include "mixr/base/units/distance_utils.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 namespace mixr {
 namespace terrain {
 
@@ -28,7 +31,7 @@ void DataFile::copyData(const DataFile& org, const bool)
    latSpacing = org.latSpacing;
    lonSpacing = org.lonSpacing;
 
-   if (org.columns != nullptr && org.nptlat > 0 && org.nptlong > 0) {
+   if (org.columns != nullptr && org.nptlat > 0 && org.nptlong > 0 && org.isColumnStorageOwned()) {
 
       // Allocate memory space for the elevation data and copy the data
       columns = new short*[nptlong];
@@ -43,6 +46,8 @@ void DataFile::copyData(const DataFile& org, const bool)
          }
       }
    } // end columns check
+
+   pyramid = org.pyramid;
 }
 
 void DataFile::deleteData()
@@ -50,6 +55,18 @@ void DataFile::deleteData()
     clearData();
 }
 
+//------------------------------------------------------------------------------
+// reset() -- loads the data, and then builds the elevation pyramid
+//------------------------------------------------------------------------------
+void DataFile::reset()
+{
+   BaseClass::reset();
+
+   if (isDataLoaded() && pyramid.empty()) {
+      buildPyramid();
+   }
+}
+
 //------------------------------------------------------------------------------
 // Access functions
 //------------------------------------------------------------------------------
@@ -311,6 +328,136 @@ bool DataFile::getElevation(
    return true;
 }
 
+//------------------------------------------------------------------------------
+// Min and max elevations of the posts that lookups within the box could use
+//------------------------------------------------------------------------------
+bool DataFile::getElevationBounds(
+      double* const minElev,  // Min elevation (meters)
+      double* const maxElev,  // Max elevation (meters)
+      bool* const complete,   // Elevations are found everywhere within the box
+      const double swLat,     // Southwest corner latitude (degs)
+      const double swLon,     // Southwest corner longitude (degs)
+      const double neLat,     // Northeast corner latitude (degs)
+      const double neLon      // Northeast corner longitude (degs)
+   ) const
+{
+   // Margin (points) for round off in the lookups' point computations
+   static const double EPS {1.0e-6};
+
+   if (minElev == nullptr || maxElev == nullptr || complete == nullptr || pyramid.empty()) return false;
+
+   // Upper limit points
+   const double maxLatPoint {static_cast<double>(nptlat-1)};
+   const double maxLonPoint {static_cast<double>(nptlong-1)};
+
+   // The box in points
+   const double lat0 {(swLat - getLatitudeSW()) / latSpacing};
+   const double lat1 {(neLat - getLatitudeSW()) / latSpacing};
+   const double lon0 {(swLon - getLongitudeSW()) / lonSpacing};
+   const double lon1 {(neLon - getLongitudeSW()) / lonSpacing};
+
+   // No data within the box
+   if (lat1 < -EPS || lat0 > (maxLatPoint + EPS) || lon1 < -EPS || lon0 > (maxLonPoint + EPS)) {
+      *minElev = 1.0;
+      *maxElev = 0.0;
+      *complete = false;
+      return true;
+   }
+
+   *complete = (lat0 > EPS && lat1 < (maxLatPoint - EPS) && lon0 > EPS && lon1 < (maxLonPoint - EPS));
+
+   // Posts that the nearest post or interpolated lookups could use, plus one
+   const unsigned int r0 {static_cast<unsigned int>(std::max(0.0, std::floor(lat0) - 1.0))};
+   const unsigned int r1 {static_cast<unsigned int>(std::min(maxLatPoint, std::ceil(lat1) + 1.0))};
+   const unsigned int c0 {static_cast<unsigned int>(std::max(0.0, std::floor(lon0) - 1.0))};
+   const unsigned int c1 {static_cast<unsigned int>(std::min(maxLonPoint, std::ceil(lon1) + 1.0))};
+
+   short lo {32767};
+   short hi {-32768};
+
+   if ((r1 - r0 + 1) * (c1 - c0 + 1) <= (4 * BLOCK_SIZE * BLOCK_SIZE)) {
+      // Small box -- check the posts
+      for (unsigned int icol = c0; icol <= c1; icol++) {
+         const short* const col {columns[icol]};
+         if (col == nullptr) continue;
+         for (unsigned int irow = r0; irow <= r1; irow++) {
+            lo = std::min(lo, col[irow]);
+            hi = std::max(hi, col[irow]);
+         }
+      }
+   }
+   else {
+      // Use the first level with no more than 4x4 blocks over the box
+      unsigned int k {};
+      unsigned int size {BLOCK_SIZE};
+      while ((k + 1) < pyramid.size() && ((r1 / size - r0 / size) >= 4 || (c1 / size - c0 / size) >= 4)) {
+         k++;
+         size *= 2;
+      }
+      const Level& level {pyramid[k]};
+      for (unsigned int icol = c0 / size; icol <= c1 / size; icol++) {
+         for (unsigned int irow = r0 / size; irow <= r1 / size; irow++) {
+            const unsigned int idx {icol * level.nrows + irow};
+            lo = std::min(lo, level.lo[idx]);
+            hi = std::max(hi, level.hi[idx]);
+         }
+      }
+   }
+
+   *minElev = static_cast<double>(lo);
+   *maxElev = static_cast<double>(hi);
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// buildPyramid() -- builds the min and max elevation pyramid
+//------------------------------------------------------------------------------
+void DataFile::buildPyramid()
+{
+   pyramid.clear();
+   if (!isDataLoaded() || nptlat == 0 || nptlong == 0) return;
+
+   // First level: blocks of posts
+   {
+      Level level;
+      level.nrows = (nptlat + BLOCK_SIZE - 1) / BLOCK_SIZE;
+      level.ncols = (nptlong + BLOCK_SIZE - 1) / BLOCK_SIZE;
+      level.lo.assign(level.nrows * level.ncols, 32767);
+      level.hi.assign(level.nrows * level.ncols, -32768);
+      for (unsigned int icol = 0; icol < nptlong; icol++) {
+         const short* const col {columns[icol]};
+         if (col == nullptr) continue;
+         short* const lo {&level.lo[(icol / BLOCK_SIZE) * level.nrows]};
+         short* const hi {&level.hi[(icol / BLOCK_SIZE) * level.nrows]};
+         for (unsigned int irow = 0; irow < nptlat; irow++) {
+            const unsigned int ib {irow / BLOCK_SIZE};
+            lo[ib] = std::min(lo[ib], col[irow]);
+            hi[ib] = std::max(hi[ib], col[irow]);
+         }
+      }
+      pyramid.push_back(level);
+   }
+
+   // Next levels: 2x2 blocks of the previous level, up to a single block
+   while (pyramid.back().nrows > 1 || pyramid.back().ncols > 1) {
+      const Level& prev {pyramid.back()};
+      Level level;
+      level.nrows = (prev.nrows + 1) / 2;
+      level.ncols = (prev.ncols + 1) / 2;
+      level.lo.assign(level.nrows * level.ncols, 32767);
+      level.hi.assign(level.nrows * level.ncols, -32768);
+      for (unsigned int icol = 0; icol < prev.ncols; icol++) {
+         for (unsigned int irow = 0; irow < prev.nrows; irow++) {
+            const unsigned int src {icol * prev.nrows + irow};
+            const unsigned int dst {(icol / 2) * level.nrows + (irow / 2)};
+            level.lo[dst] = std::min(level.lo[dst], prev.lo[src]);
+            level.hi[dst] = std::max(level.hi[dst], prev.hi[src]);
+         }
+      }
+      pyramid.push_back(level);
+   }
+}
+
 //------------------------------------------------------------------------------
 // Computes the nearest row index for the latitude (degs).
 // Returns true if the index is valid
@@ -417,6 +564,8 @@ void DataFile::clearData()
    nptlat = 0;
    nptlong = 0;
 
+   pyramid.clear();
+
    setLatitudeSW(0);
    setLongitudeSW(0);
    setLatitudeNE(0);
@@ -0,0 +1,301 @@
+
+#include "mixr/terrain/LosCache.hpp"
+#include "mixr/terrain/Terrain.hpp"
+
+#include "mixr/base/numeric/Integer.hpp"
+#include "mixr/base/units/Distances.hpp"
+#include "mixr/base/units/Times.hpp"
+#include "mixr/base/util/atomics.hpp"
+#include "mixr/base/units/angle_utils.hpp"
+#include "mixr/base/units/distance_utils.hpp"
+
+#include <cmath>
+
+namespace mixr {
+namespace terrain {
+
+IMPLEMENT_SUBCLASS(LosCache, "LosCache")
+
+BEGIN_SLOTTABLE(LosCache)
+   "cellSize",       // 1) Horizontal cell size
+   "altitudeBand",   // 2) Altitude band
+   "validityTime",   // 3) Max age of a saved result
+   "size",           // 4) Number of entries
+END_SLOTTABLE(LosCache)
+
+BEGIN_SLOT_MAP(LosCache)
+   ON_SLOT(1, setSlotCellSize,      base::Distance)
+   ON_SLOT(2, setSlotAltitudeBand,  base::Distance)
+   ON_SLOT(3, setSlotValidityTime,  base::Time)
+   ON_SLOT(4, setSlotSize,          base::Integer)
+END_SLOT_MAP()
+
+// Meters per degree of latitude
+static const double M_PER_DEG{60.0 * base::distance::NM2M};
+
+LosCache::LosCache()
+{
+   STANDARD_CONSTRUCTOR()
+   setEntries(DEFAULT_SIZE);
+}
+
+void LosCache::copyData(const LosCache& org, const bool)
+{
+   BaseClass::copyData(org);
+
+   cellSize = org.cellSize;
+   altBand = org.altBand;
+   validity = org.validity;
+
+   // same size, but empty
+   setEntries(org.getSize());
+}
+
+void LosCache::deleteData()
+{
+   setEntries(0);
+}
+
+//------------------------------------------------------------------------------
+// Set functions
+//------------------------------------------------------------------------------
+bool LosCache::setCellSize(const double meters)
+{
+   bool ok{};
+   if (meters > 0.0) {
+      cellSize = meters;
+      clear();
+      ok = true;
+   }
+   return ok;
+}
+
+bool LosCache::setAltitudeBand(const double meters)
+{
+   bool ok{};
+   if (meters > 0.0) {
+      altBand = meters;
+      clear();
+      ok = true;
+   }
+   return ok;
+}
+
+bool LosCache::setValidityTime(const double seconds)
+{
+   bool ok{};
+   if (seconds >= 0.0) {
+      validity = seconds;
+      clear();
+      ok = true;
+   }
+   return ok;
+}
+
+bool LosCache::setSize(const unsigned int n)
+{
+   bool ok{};
+   if (n > 0) {
+      setEntries(n);
+      ok = true;
+   }
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// setEntries() -- sizes the table to a power of two, at least 'n' (or zero)
+//------------------------------------------------------------------------------
+void LosCache::setEntries(const unsigned int n)
+{
+   metaObject.addOwnedBytes( -static_cast<long>(sizeof(Entry) * entries.size()) );
+
+   unsigned int size{};
+   if (n > 0) {
+      size = 1;
+      while (size < n && size < 0x80000000) size <<= 1;
+   }
+   std::vector<Entry>(size).swap(entries);
+   mask = (size > 0) ? (size - 1) : 0;
+
+   metaObject.addOwnedBytes( static_cast<long>(sizeof(Entry) * entries.size()) );
+
+   clear();
+}
+
+//------------------------------------------------------------------------------
+// clear() -- clears the saved results and the statistics
+//------------------------------------------------------------------------------
+void LosCache::clear()
+{
+   for (unsigned int s = 0; s < NUM_STRIPES; s++) {
+      base::lock(stripes[s].lock);
+      for (unsigned int i = s; i < entries.size(); i += NUM_STRIPES) {
+         entries[i].terrain = nullptr;
+      }
+      stripes[s].lookups.store(0, std::memory_order_relaxed);
+      stripes[s].hits.store(0, std::memory_order_relaxed);
+      base::unlock(stripes[s].lock);
+   }
+}
+
+//------------------------------------------------------------------------------
+// targetOcculting() -- cached Terrain::targetOcculting()
+//------------------------------------------------------------------------------
+bool LosCache::targetOcculting(
+      const Terrain* const terrain,
+      const double refLat,
+      const double refLon,
+      const double refAlt,
+      const double tgtLat,
+      const double tgtLon,
+      const double tgtAlt,
+      const double time
+   )
+{
+   if (terrain == nullptr) return false;
+   if (entries.empty()) {
+      return terrain->targetOcculting(refLat, refLon, refAlt, tgtLat, tgtLon, tgtAlt);
+   }
+
+   const Key key{computeKey(refLat, refLon, refAlt, tgtLat, tgtLon, tgtAlt)};
+   const unsigned int idx{computeIndex(key)};
+   Stripe& stripe{stripes[idx % NUM_STRIPES]};
+   Entry& entry{entries[idx]};
+
+   // ---
+   // Look for a saved result
+   // ---
+   bool hit{};
+   bool occulted{};
+   base::lock(stripe.lock);
+   stripe.lookups.fetch_add(1, std::memory_order_relaxed);
+   if (entry.terrain == terrain && entry.key == key && time >= entry.time && (time - entry.time) <= validity) {
+      occulted = entry.occulted;
+      stripe.hits.fetch_add(1, std::memory_order_relaxed);
+      hit = true;
+   }
+   base::unlock(stripe.lock);
+
+   // ---
+   // Compute and save the result
+   // ---
+   if (!hit) {
+      occulted = terrain->targetOcculting(refLat, refLon, refAlt, tgtLat, tgtLon, tgtAlt);
+
+      base::lock(stripe.lock);
+      entry.key = key;
+      entry.terrain = terrain;
+      entry.time = time;
+      entry.occulted = occulted;
+      base::unlock(stripe.lock);
+   }
+
+   return occulted;
+}
+
+//------------------------------------------------------------------------------
+// Statistics
+//------------------------------------------------------------------------------
+unsigned long LosCache::getNumLookups() const
+{
+   unsigned long n{};
+   for (const Stripe& s : stripes) { n += s.lookups.load(std::memory_order_relaxed); }
+   return n;
+}
+
+unsigned long LosCache::getNumHits() const
+{
+   unsigned long n{};
+   for (const Stripe& s : stripes) { n += s.hits.load(std::memory_order_relaxed); }
+   return n;
+}
+
+double LosCache::getHitRate() const
+{
+   const unsigned long n{getNumLookups()};
+   return (n > 0) ? (static_cast<double>(getNumHits()) / static_cast<double>(n)) : 0.0;
+}
+
+//------------------------------------------------------------------------------
+// Keys and indices
+//------------------------------------------------------------------------------
+bool LosCache::Key::operator==(const Key& k) const
+{
+   return v[0] == k.v[0] && v[1] == k.v[1] && v[2] == k.v[2] &&
+          v[3] == k.v[3] && v[4] == k.v[4] && v[5] == k.v[5];
+}
+
+LosCache::Key LosCache::computeKey(
+      const double refLat, const double refLon, const double refAlt,
+      const double tgtLat, const double tgtLon, const double tgtAlt) const
+{
+   // Cells of about 'cellSize' meters: the longitude cells are scaled by the
+   // cosine of the latitude of their row of cells
+   const double k{M_PER_DEG / cellSize};
+   const auto cell = [k](const double lat, const double lon, int* const ilat, int* const ilon) {
+      const double row{std::floor(lat * k)};
+      const double scale{std::cos( ((row + 0.5) / k) * base::angle::D2RCC )};
+      *ilat = static_cast<int>(row);
+      *ilon = static_cast<int>(std::floor(lon * k * scale));
+   };
+
+   Key key;
+   cell(refLat, refLon, &key.v[0], &key.v[1]);
+   key.v[2] = static_cast<int>(std::floor(refAlt / altBand));
+   cell(tgtLat, tgtLon, &key.v[3], &key.v[4]);
+   key.v[5] = static_cast<int>(std::floor(tgtAlt / altBand));
+   return key;
+}
+
+unsigned int LosCache::computeIndex(const Key& key) const
+{
+   unsigned long long h{0xcbf29ce484222325ULL};
+   for (unsigned int i = 0; i < 6; i++) {
+      h ^= static_cast<unsigned long long>(static_cast<unsigned int>(key.v[i]));
+      h *= 0x100000001b3ULL;
+      h ^= (h >> 29);
+   }
+   return static_cast<unsigned int>(h) & mask;
+}
+
+//------------------------------------------------------------------------------
+// Slot functions
+//------------------------------------------------------------------------------
+bool LosCache::setSlotCellSize(const base::Distance* const msg)
+{
+   bool ok{};
+   if (msg != nullptr) {
+      ok = setCellSize( base::Meters::convertStatic(*msg) );
+   }
+   return ok;
+}
+
+bool LosCache::setSlotAltitudeBand(const base::Distance* const msg)
+{
+   bool ok{};
+   if (msg != nullptr) {
+      ok = setAltitudeBand( base::Meters::convertStatic(*msg) );
+   }
+   return ok;
+}
+
+bool LosCache::setSlotValidityTime(const base::Time* const msg)
+{
+   bool ok{};
+   if (msg != nullptr) {
+      ok = setValidityTime( base::Seconds::convertStatic(*msg) );
+   }
+   return ok;
+}
+
+bool LosCache::setSlotSize(const base::Integer* const msg)
+{
+   bool ok{};
+   if (msg != nullptr && msg->getInt() > 0) {
+      ok = setSize( static_cast<unsigned int>(msg->getInt()) );
+   }
+   return ok;
+}
+
+}
+}
@@ -9,6 +9,8 @@
 #include "mixr/base/units/Angles.hpp"
 #include "mixr/base/units/Distances.hpp"
 
+#include <algorithm>
+
 namespace mixr {
 namespace terrain {
 
@@ -135,9 +137,49 @@ bool QuadMap::getElevation(
    return found;
 }
 
-
 //------------------------------------------------------------------------------
-// Initializes the channel array
+// Min and max elevations of all of the data files within the box
+//------------------------------------------------------------------------------
+bool QuadMap::getElevationBounds(
+      double* const minElev,  // Min elevation (meters)
+      double* const maxElev,  // Max elevation (meters)
+      bool* const complete,   // Elevations are found everywhere within the box
+      const double swLat,     // Southwest corner latitude (degs)
+      const double swLon,     // Southwest corner longitude (degs)
+      const double neLat,     // Northeast corner latitude (degs)
+      const double neLon      // Northeast corner longitude (degs)
+   ) const
+{
+   if ( !isDataLoaded() || minElev == nullptr || maxElev == nullptr || complete == nullptr ) return false;
+
+   double lo{1.0};
+   double hi{};
+   bool all{};
+   for (unsigned int i = 0; i < numDataFiles; i++) {
+      double fileMin{};
+      double fileMax{};
+      bool fileComplete{};
+      if ( !dataFiles[i]->getElevationBounds(&fileMin, &fileMax, &fileComplete, swLat, swLon, neLat, neLon) ) {
+         return false;
+      }
+      if (fileMin <= fileMax) {
+         if (lo > hi) {
+            lo = fileMin;
+            hi = fileMax;
+         } else {
+            lo = std::min(lo, fileMin);
+            hi = std::max(hi, fileMax);
+         }
+      }
+      all = all || fileComplete;
+   }
+
+   *minElev = lo;
+   *maxElev = hi;
+   *complete = all;
+   return true;
+}
+
 //------------------------------------------------------------------------------
 void QuadMap::findDataFiles()
 {
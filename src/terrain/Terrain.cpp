@@ -10,12 +10,21 @@
 #include "mixr/base/String.hpp"
 
 #include "mixr/base/util/nav_utils.hpp"
+#include "mixr/base/util/system_utils.hpp"
 
 #include "mixr/base/osg/Vec2d"
 #include "mixr/base/osg/Vec3d"
 
+#include <algorithm>
 #include <cmath>
 
+// AVX occulting check kernel (compiled for AVX, used when the CPU has it)
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MIXR_TERRAIN_AVX
+#include <immintrin.h>
+#include <cstring>
+#endif
+
 namespace mixr {
 namespace terrain {
 
@@ -225,6 +234,11 @@ bool Terrain::targetOcculting(
    // Get the elevations and check for target occulting
    if (numPts > 1) {
 
+      // Most lines of sight are clear of (or blocked by) the terrain by enough
+      // that the elevation bounds of a few segments of the profile decide
+      const BoundsCheck quick = boundsCheck(refLat, refLon, brgDeg, dist, numPts, refAlt, (tgtAlt - refAlt) / dist);
+      if (quick != UNKNOWN) return (quick == OCCULTED);
+
       // Arrays for the elevations
       double elevations[MAX_POINTS];
 
@@ -272,6 +286,10 @@ bool Terrain::targetOcculting2(
    // Get the elevations and check for target occulting
    if (numPts > 1) {
 
+      // Try the elevation bounds first (see targetOcculting())
+      const BoundsCheck quick = boundsCheck(refLat, refLon, truBrg, dist, numPts, refAlt, tanLookAng);
+      if (quick != UNKNOWN) return (quick == OCCULTED);
+
       // Arrays for the elevations
       double elevations[MAX_POINTS];
 
@@ -292,6 +310,216 @@ bool Terrain::targetOcculting2(
    return occulted;
 }
 
+//------------------------------------------------------------------------------
+// Bounds check: decides the occulting check of the profile's points [ 1 .. n-2 ]
+// (see occultCheck()) using the elevation bounds of segments of the profile.
+// A segment is clear if its max elevation is below the line of sight, and is
+// occulted if all of its points are found and its min elevation is above the
+// line of sight (where it's lowest); otherwise, it's split in two.  If a single
+// point isn't decided then UNKNOWN is returned, and the full resolution profile
+// must be checked.
+// The bounds cover all of the posts that the profile's points could use, so the
+// answer is the same as the full resolution check.
+//------------------------------------------------------------------------------
+Terrain::BoundsCheck Terrain::boundsCheck(
+      const double lat,          // Ref latitude (degs)
+      const double lon,          // Ref longitude (degs)
+      const double direction,    // True direction angle of the profile (degs)
+      const double maxRng,       // Range to the last point (meters)
+      const unsigned int n,      // Number of points in the profile
+      const double refAlt,       // Ref altitude (meters)
+      const double tanAng        // Tangent of the angle to the target (or look angle)
+   ) const
+{
+   // Margin (meters) for the round off of the full resolution check
+   static const double EPS = 0.001;
+
+   // Max depth of the segment stack (2 * log2(n) + 1)
+   static const unsigned int MAX_SEGMENTS = 64;
+
+   if (n < 3 || lat < -89.0 || lat > 89.0 || maxRng <= 0) return UNKNOWN;
+
+   // Spacing between points (same flat earth steps as DataFile::getElevations())
+   const double deltaRng = maxRng / (n - 1);
+   const double dirR = direction * base::angle::D2RCC;
+   const double deltaLat = (deltaRng * std::cos(dirR) * base::distance::M2NM) / 60.0;
+   const double deltaLon = (deltaRng * std::sin(dirR) * base::distance::M2NM) / (60.0 * std::cos(lat * base::angle::D2RCC));
+
+   // Segments [ a b ] to check, starting with all of the points between the
+   // ref point and the target; nearest segments first
+   unsigned int segA[MAX_SEGMENTS];
+   unsigned int segB[MAX_SEGMENTS];
+   unsigned int top = 0;
+   segA[top] = 1;
+   segB[top++] = n - 2;
+
+   while (top > 0) {
+      top--;
+      const unsigned int a = segA[top];
+      const unsigned int b = segB[top];
+
+      // Bounds of the segment's box
+      const double latA = lat + a * deltaLat;
+      const double latB = lat + b * deltaLat;
+      const double lonA = lon + a * deltaLon;
+      const double lonB = lon + b * deltaLon;
+      double minElev = 0;
+      double maxElev = 0;
+      bool complete = false;
+      if ( !getElevationBounds(&minElev, &maxElev, &complete,
+                               std::min(latA, latB), std::min(lonA, lonB),
+                               std::max(latA, latB), std::max(lonA, lonB)) ) return UNKNOWN;
+
+      // No points found -- no occulting
+      if (minElev > maxElev) continue;
+
+      // Height of the line of sight above the ref altitude at the segment's
+      // lowest point (the nearest point if looking up, else the farthest)
+      const double losHeight = tanAng * ((tanAng >= 0) ? a : b) * deltaRng;
+
+      // Clear: every point is below the line of sight
+      if ((maxElev - refAlt) < (losHeight - EPS)) continue;
+
+      // Occulted: every point is found, and the point at the line of sight's
+      // lowest height is below the terrain
+      if (complete && (minElev - refAlt) > (losHeight + EPS)) return OCCULTED;
+
+      // Undecided -- split the segment
+      if (a == b || (top + 2) > MAX_SEGMENTS) return UNKNOWN;
+      const unsigned int m = (a + b) / 2;
+      segA[top] = m + 1;
+      segB[top++] = b;
+      segA[top] = a;
+      segB[top++] = m;
+   }
+
+   return CLEAR;
+}
+
+//------------------------------------------------------------------------------
+// Occulting check kernel -- the AVX version tests four points at a time; the
+// ranges are accumulated one point at a time, as in the scalar version, so
+// the results are the same.
+//------------------------------------------------------------------------------
+bool Terrain::anyPointAbove(
+      const double* const elevations,  // The elevation array (meters)
+      const bool* const validFlags,    // (Optional) Valid elevation flag array
+      const unsigned int n,            // Size of the arrays
+      const double deltaRng,           // Range between points (meters)
+      const double refAlt,             // Ref altitude (meters)
+      const double tanAng)             // Tangent of the angle
+{
+   static const bool avx{isAvxOccultAvailable()};
+   if (avx) return anyPointAboveAvx(elevations, validFlags, n, deltaRng, refAlt, tanAng);
+   return anyPointAboveScalar(elevations, validFlags, n, deltaRng, refAlt, tanAng);
+}
+
+bool Terrain::anyPointAboveScalar(
+      const double* const elevations,
+      const bool* const validFlags,
+      const unsigned int n,
+      const double deltaRng,
+      const double refAlt,
+      const double tanAng)
+{
+   if (elevations == nullptr || n < 3) return false;
+
+   double currentRange = 0;
+   if (validFlags != nullptr) {
+      // with valid flags
+      for (unsigned int i = 1; i < (n - 1); i++) {
+         currentRange += deltaRng;
+         if (validFlags[i]) {
+            const double tstTan = (elevations[i] - refAlt) / currentRange;
+            if (tstTan >= tanAng) return true;
+         }
+      }
+   } else {
+      // without valid flags
+      for (unsigned int i = 1; i < (n - 1); i++) {
+         currentRange += deltaRng;
+         const double tstTan = (elevations[i] - refAlt) / currentRange;
+         if (tstTan >= tanAng) return true;
+      }
+   }
+   return false;
+}
+
+#ifdef MIXR_TERRAIN_AVX
+
+bool Terrain::isAvxOccultAvailable()
+{
+   return base::isCpuAvxSupported();
+}
+
+// Lane mask (all ones) of four flags that are true
+__attribute__((target("avx")))
+static inline __m256d flagMask(const bool* const flags)
+{
+   int bytes = 0;
+   std::memcpy(&bytes, flags, 4);
+   const __m128i v = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(bytes));
+   return _mm256_cmp_pd(_mm256_cvtepi32_pd(v), _mm256_setzero_pd(), _CMP_NEQ_OQ);
+}
+
+__attribute__((target("avx")))
+bool Terrain::anyPointAboveAvx(
+      const double* const elevations,
+      const bool* const validFlags,
+      const unsigned int n,
+      const double deltaRng,
+      const double refAlt,
+      const double tanAng)
+{
+   if (elevations == nullptr || n < 3) return false;
+
+   unsigned int i = 1;
+   double currentRange = 0;
+   const __m256d ref = _mm256_set1_pd(refAlt);
+   const __m256d tan = _mm256_set1_pd(tanAng);
+   for (; (i + 4) <= (n - 1); i += 4) {
+      const double r0 = currentRange + deltaRng;
+      const double r1 = r0 + deltaRng;
+      const double r2 = r1 + deltaRng;
+      currentRange = r2 + deltaRng;
+      const __m256d rng = _mm256_set_pd(currentRange, r2, r1, r0);
+      const __m256d tstTan = _mm256_div_pd(_mm256_sub_pd(_mm256_loadu_pd(elevations + i), ref), rng);
+      __m256d above = _mm256_cmp_pd(tstTan, tan, _CMP_GE_OQ);
+      if (validFlags != nullptr) above = _mm256_and_pd(above, flagMask(validFlags + i));
+      if (_mm256_movemask_pd(above) != 0) return true;
+   }
+
+   // (the rest of the points)
+   for (; i < (n - 1); i++) {
+      currentRange += deltaRng;
+      if (validFlags == nullptr || validFlags[i]) {
+         const double tstTan = (elevations[i] - refAlt) / currentRange;
+         if (tstTan >= tanAng) return true;
+      }
+   }
+   return false;
+}
+
+#else
+
+bool Terrain::isAvxOccultAvailable()
+{
+   return false;
+}
+
+bool Terrain::anyPointAboveAvx(
+      const double* const elevations,
+      const bool* const validFlags,
+      const unsigned int n,
+      const double deltaRng,
+      const double refAlt,
+      const double tanAng)
+{
+   return anyPointAboveScalar(elevations, validFlags, n, deltaRng, refAlt, tanAng);
+}
+
+#endif
+
 //------------------------------------------------------------------------------
 // Occulting check: returns true if a target at the altitude 'tgtAlt' and
 // range 'range' is occulted by the elevation points as seen from the
@@ -318,32 +546,9 @@ bool Terrain::occultCheck(
    // angle then the target is occulted by the terrain point
    const double tgtTan = (tgtAlt - refAlt) / range;
 
-   // Loop through all elevation points looking for an angle
+   // Look through all elevation points for an angle
    // that's greater than our ref angle
-   const double deltaRng = (range / (n - 1));
-   double currentRange = 0;
-   if (validFlags != nullptr) {
-      // with valid flags
-      for (unsigned int i = 1; i < (n-1) && !occulted; i++) {
-         currentRange += deltaRng;
-         if (validFlags[i]) {
-            const double tstTan = (elevations[i] - refAlt) / currentRange;
-            if (tstTan >= tgtTan) {
-               occulted = true;
-            }
-         }
-      }
-   }
-   else {
-      // without valid flags
-      for (unsigned int i = 1; i < (n-1) && !occulted; i++) {
-         currentRange += deltaRng;
-         const double tstTan = (elevations[i] - refAlt) / currentRange;
-         if (tstTan >= tgtTan) {
-            occulted = true;
-         }
-      }
-   }
+   occulted = anyPointAbove(elevations, validFlags, n, (range / (n - 1)), refAlt, tgtTan);
 
    return occulted;
 }
@@ -369,31 +574,9 @@ bool Terrain::occultCheck2(
          range <= 0                 // the range is less than or equal to zero
          ) return occulted;
 
-   // Loop through all elevation points looking for an angle
+   // Look through all elevation points for an angle
    // that's greater than our ref angle
-   const double deltaRng = (range / (n - 1));
-   double currentRange = 0;
-   if (validFlags != nullptr) {
-      // with valid flags
-      for (unsigned int i = 1; i < (n-1) && !occulted; i++) {
-         currentRange += deltaRng;
-         if (validFlags[i]) {
-            const double tstTan = (elevations[i] - refAlt) / currentRange;
-            if (tstTan >= tanLookAng) {
-               occulted = true;
-            }
-         }
-      }
-   } else {
-      // without valid flags
-      for (unsigned int i = 1; i < (n-1) && !occulted; i++) {
-         currentRange += deltaRng;
-         const double tstTan = (elevations[i] - refAlt) / currentRange;
-         if (tstTan >= tanLookAng) {
-            occulted = true;
-         }
-      }
-   }
+   occulted = anyPointAbove(elevations, validFlags, n, (range / (n - 1)), refAlt, tanLookAng);
 
    return occulted;
 }
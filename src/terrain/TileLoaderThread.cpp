@@ -0,0 +1,23 @@
+
+#include "TileLoaderThread.hpp"
+
+#include "mixr/terrain/TileManager.hpp"
+
+#include "mixr/base/Component.hpp"
+
+namespace mixr {
+namespace terrain {
+
+TileLoaderThread::TileLoaderThread(base::Component* const parent, const double rate): PeriodicThread(parent, rate)
+{
+}
+
+unsigned long TileLoaderThread::userFunc(const double)
+{
+   const auto manager = static_cast<TileManager*>(getParent());
+   manager->loadTiles();
+   return 0;
+}
+
+}
+}
@@ -0,0 +1,20 @@
+
+#ifndef __mixr_terrain_TileLoaderThread_H__
+#define __mixr_terrain_TileLoaderThread_H__
+
+#include "mixr/base/threads/PeriodicThread.hpp"
+
+namespace mixr {
+namespace base { class Component; }
+namespace terrain {
+
+class TileLoaderThread final : public base::PeriodicThread
+{
+   public: TileLoaderThread(base::Component* const parent, const double rate);
+   private: unsigned long userFunc(const double dt) final;
+};
+
+}
+}
+
+#endif
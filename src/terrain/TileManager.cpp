@@ -0,0 +1,649 @@
+
+#include "mixr/terrain/TileManager.hpp"
+
+#include "TileLoaderThread.hpp"
+
+#include "mixr/terrain/DataFile.hpp"
+#include "mixr/terrain/dted/DtedFile.hpp"
+#include "mixr/terrain/mapped/MappedFile.hpp"
+#include "mixr/terrain/srtm/SrtmHgtFile.hpp"
+
+#include "mixr/base/numeric/Number.hpp"
+#include "mixr/base/String.hpp"
+#include "mixr/base/units/Distances.hpp"
+#include "mixr/base/units/angle_utils.hpp"
+#include "mixr/base/units/distance_utils.hpp"
+#include "mixr/base/util/atomics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace mixr {
+namespace terrain {
+
+IMPLEMENT_SUBCLASS(TileManager, "TileManager")
+
+BEGIN_SLOTTABLE(TileManager)
+   "format",            // 1) Tile file format
+   "maxMemory",         // 2) Memory budget (megabytes)
+   "prefetchRadius",    // 3) Prefetch radius
+   "coarse",            // 4) Coarse terrain
+END_SLOTTABLE(TileManager)
+
+BEGIN_SLOT_MAP(TileManager)
+   ON_SLOT(1, setSlotFormat,           base::String)
+   ON_SLOT(2, setSlotMaxMemory,        base::Number)
+   ON_SLOT(3, setSlotPrefetchRadius,   base::Distance)
+   ON_SLOT(4, setSlotCoarse,           Terrain)
+END_SLOT_MAP()
+
+// Loader thread rate (Hz); each frame loads all of the requested tiles
+static const double LOADER_RATE{10.0};
+
+// Bytes per megabyte
+static const double MB{1024.0 * 1024.0};
+
+TileManager::TileManager()
+{
+   STANDARD_CONSTRUCTOR()
+   maxBytes = static_cast<std::size_t>(DEFAULT_MAX_MEMORY * MB);
+}
+
+void TileManager::copyData(const TileManager& org, const bool)
+{
+   BaseClass::copyData(org);
+
+   format = org.format;
+   maxBytes = org.maxBytes;
+   prefetchRadius = org.prefetchRadius;
+
+   if (org.coarse != nullptr) {
+      Terrain* copy = org.coarse->clone();
+      setCoarseTerrain( copy );
+      copy->unref();
+   } else {
+      setCoarseTerrain(nullptr);
+   }
+
+   // The copy streams its own tiles
+   loader = nullptr;
+   started = false;
+}
+
+void TileManager::deleteData()
+{
+   clearData();
+   setCoarseTerrain(nullptr);
+   loader = nullptr;
+}
+
+//------------------------------------------------------------------------------
+// reset() -- loads the coarse terrain, and starts the loader thread
+//------------------------------------------------------------------------------
+void TileManager::reset()
+{
+   if (coarse != nullptr) coarse->reset();
+
+   BaseClass::reset();
+}
+
+bool TileManager::shutdownNotification()
+{
+   if (coarse != nullptr) coarse->event(SHUTDOWN_EVENT);
+
+   // The loader thread stops when we're shutdown
+   return BaseClass::shutdownNotification();
+}
+
+//------------------------------------------------------------------------------
+// Access functions
+//------------------------------------------------------------------------------
+
+// Has the data been loaded (i.e., are we streaming tiles?)
+bool TileManager::isDataLoaded() const
+{
+   return started;
+}
+
+double TileManager::getMaxMemory() const
+{
+   return static_cast<double>(maxBytes) / MB;
+}
+
+unsigned int TileManager::getNumLoadedTiles() const
+{
+   unsigned int n{};
+   base::lock(tileLock);
+   for (const auto& t : tiles) {
+      if (t.second.state == LOADED) n++;
+   }
+   base::unlock(tileLock);
+   return n;
+}
+
+std::size_t TileManager::getLoadedBytes() const
+{
+   return loadedBytes;
+}
+
+//------------------------------------------------------------------------------
+// Set functions
+//------------------------------------------------------------------------------
+
+bool TileManager::setFormat(const std::string& fmt)
+{
+   bool ok = false;
+   if (fmt == "dt0" || fmt == "dt1" || fmt == "dt2" || fmt == "hgt" || fmt == "mtf") {
+      format = fmt;
+      ok = true;
+   }
+   return ok;
+}
+
+bool TileManager::setMaxMemory(const double megabytes)
+{
+   bool ok = false;
+   if (megabytes > 0.0) {
+      maxBytes = static_cast<std::size_t>(megabytes * MB);
+      ok = true;
+   }
+   return ok;
+}
+
+bool TileManager::setPrefetchRadius(const double meters)
+{
+   bool ok = false;
+   if (meters >= 0.0) {
+      prefetchRadius = meters;
+      ok = true;
+   }
+   return ok;
+}
+
+bool TileManager::setCoarseTerrain(Terrain* const msg)
+{
+   if (coarse != nullptr) coarse->unref();
+   coarse = msg;
+   if (coarse != nullptr) coarse->ref();
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// Locates an array of (at least two) elevation points (and sets valid flags if found)
+// returns the number of points found
+//------------------------------------------------------------------------------
+unsigned int TileManager::getElevations(
+      double* const elevations,     // The elevation array (meters)
+      bool* const validFlags,       // Valid elevation flag array (true if elevation was found)
+      const unsigned int n,         // Size of elevation and valdFlags arrays
+      const double lat,             // Starting latitude (degs)
+      const double lon,             // Starting longitude (degs)
+      const double direction,       // True direction (heading) angle of the data (degs)
+      const double maxRng,          // Range to last elevation point (meters)
+      const bool interp             // Interpolate between elevation posts (if true)
+   ) const
+{
+   unsigned int num{};
+
+   // Early out tests
+   if ( !isDataLoaded() ||             // We're not started, or
+        elevations == nullptr ||       // the elevation array wasn't provided, or
+        validFlags == nullptr ||       // the valid flag array wasn't provided, or
+        n < 2 ||                       // there are too few points, or
+        (lat < -89.0 || lat > 89.0) || // and we're not starting at the north or south poles
+        maxRng <= 0                    // the max range is less than or equal to zero
+      ) return num;
+
+   // ---
+   // The cells under the profile (same flat earth steps as DataFile)
+   // ---
+   const double dirR{direction * base::angle::D2RCC};
+   const double dLat{maxRng * std::cos(dirR) * base::distance::M2NM / 60.0};
+   const double dLon{maxRng * std::sin(dirR) * base::distance::M2NM / (60.0 * std::cos(lat * base::angle::D2RCC))};
+   const int lat0{std::max(-90, static_cast<int>(std::floor(std::min(lat, lat + dLat))))};
+   const int lat1{std::min( 89, static_cast<int>(std::floor(std::max(lat, lat + dLat))))};
+   const int lon0{static_cast<int>(std::floor(std::min(lon, lon + dLon)))};
+   const int lon1{static_cast<int>(std::floor(std::max(lon, lon + dLon)))};
+
+   // ---
+   // Each loaded tile fills in its points
+   // ---
+   for (int ilat = lat0; ilat <= lat1 && num < n; ilat++) {
+      for (int ilon = lon0; ilon <= lon1 && num < n; ilon++) {
+         DataFile* const file{acquireTile(ilat, ilon)};
+         if (file != nullptr) {
+            num += file->getElevations(elevations, validFlags, n, lat, lon, direction, maxRng, interp);
+            file->unref();
+         }
+      }
+   }
+
+   // ---
+   // and the coarse terrain fills in the rest
+   // ---
+   if (coarse != nullptr && num < n) {
+      num += coarse->getElevations(elevations, validFlags, n, lat, lon, direction, maxRng, interp);
+   }
+
+   return num;
+}
+
+//------------------------------------------------------------------------------
+// Locates an elevation value (meters) for a given reference point and returns
+// it in 'elev'.  Function returns true if successful, otherwise 'elev' is unchanged.
+//------------------------------------------------------------------------------
+bool TileManager::getElevation(
+      double* const elev,     // The elevation value (meters)
+      const double lat,       // Reference latitude (degs)
+      const double lon,       // Reference longitude (degs)
+      const bool interp       // Interpolate between elevation posts (if true)
+   ) const
+{
+   if (!isDataLoaded() || elev == nullptr) return false;
+
+   bool found{};
+   DataFile* const file{acquireTile(static_cast<int>(std::floor(lat)), static_cast<int>(std::floor(lon)))};
+   if (file != nullptr) {
+      found = file->getElevation(elev, lat, lon, interp);
+      file->unref();
+   }
+
+   if (!found && coarse != nullptr) {
+      found = coarse->getElevation(elev, lat, lon, interp);
+   }
+
+   return found;
+}
+
+//------------------------------------------------------------------------------
+// Min and max elevations within the box: of the loaded tiles, and of the
+// coarse terrain where the tiles aren't loaded
+//------------------------------------------------------------------------------
+bool TileManager::getElevationBounds(
+      double* const minElev,  // Min elevation (meters)
+      double* const maxElev,  // Max elevation (meters)
+      bool* const complete,   // Elevations are found everywhere within the box
+      const double swLat,     // Southwest corner latitude (degs)
+      const double swLon,     // Southwest corner longitude (degs)
+      const double neLat,     // Northeast corner latitude (degs)
+      const double neLon      // Northeast corner longitude (degs)
+   ) const
+{
+   if (!isDataLoaded() || minElev == nullptr || maxElev == nullptr || complete == nullptr) return false;
+
+   const int lat0{std::max(-90, static_cast<int>(std::floor(swLat)))};
+   const int lat1{std::min( 89, static_cast<int>(std::floor(neLat)))};
+   const int lon0{static_cast<int>(std::floor(swLon))};
+   const int lon1{static_cast<int>(std::floor(neLon))};
+
+   double lo{1.0};
+   double hi{};
+   bool all{};
+   bool useCoarse{};
+   const auto merge = [&lo, &hi](const double cellMin, const double cellMax) {
+      if (cellMin > cellMax) return;
+      if (lo > hi) {
+         lo = cellMin;
+         hi = cellMax;
+      } else {
+         lo = std::min(lo, cellMin);
+         hi = std::max(hi, cellMax);
+      }
+   };
+
+   for (int ilat = lat0; ilat <= lat1; ilat++) {
+      for (int ilon = lon0; ilon <= lon1; ilon++) {
+         DataFile* const file{acquireTile(ilat, ilon)};
+         if (file != nullptr) {
+            double cellMin{};
+            double cellMax{};
+            bool cellComplete{};
+            const bool ok{file->getElevationBounds(&cellMin, &cellMax, &cellComplete, swLat, swLon, neLat, neLon)};
+            file->unref();
+            if (!ok) return false;
+            merge(cellMin, cellMax);
+            // a single tile that covers the whole box
+            all = all || (cellComplete && lat0 == lat1 && lon0 == lon1);
+         } else {
+            // the coarse terrain is used for the cell's points
+            useCoarse = true;
+         }
+      }
+   }
+
+   if (useCoarse && coarse != nullptr) {
+      double coarseMin{};
+      double coarseMax{};
+      bool coarseComplete{};
+      if (!coarse->getElevationBounds(&coarseMin, &coarseMax, &coarseComplete, swLat, swLon, neLat, neLon)) {
+         return false;
+      }
+      merge(coarseMin, coarseMax);
+      all = all || coarseComplete;
+   }
+
+   *minElev = lo;
+   *maxElev = hi;
+   *complete = all;
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// prefetch() -- requests the tiles within the prefetch radius of the points,
+//               and marks the loaded ones as used
+//------------------------------------------------------------------------------
+void TileManager::prefetch(const double* const lats, const double* const lons, const unsigned int n)
+{
+   if (!isDataLoaded() || lats == nullptr || lons == nullptr) return;
+
+   // Cell keys within the radius of the points
+   std::vector<int> keys;
+   const double dLat{prefetchRadius * base::distance::M2NM / 60.0};
+   for (unsigned int i = 0; i < n; i++) {
+      const double lat{lats[i]};
+      const double lon{lons[i]};
+      if (lat < -89.0 || lat > 89.0) continue;
+      const double dLon{dLat / std::cos(lat * base::angle::D2RCC)};
+      const int lat0{std::max(-90, static_cast<int>(std::floor(lat - dLat)))};
+      const int lat1{std::min( 89, static_cast<int>(std::floor(lat + dLat)))};
+      const int lon0{static_cast<int>(std::floor(lon - dLon))};
+      const int lon1{static_cast<int>(std::floor(lon + dLon))};
+      for (int ilat = lat0; ilat <= lat1; ilat++) {
+         for (int ilon = lon0; ilon <= lon1; ilon++) {
+            keys.push_back(cellKey(ilat, ilon));
+         }
+      }
+   }
+   std::sort(keys.begin(), keys.end());
+   keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+   base::lock(tileLock);
+   for (const int key : keys) {
+      const auto it = tiles.find(key);
+      if (it == tiles.end()) {
+         request(key);
+      } else if (it->second.state == LOADED) {
+         it->second.lastUsed = ++useCount;
+      }
+   }
+   base::unlock(tileLock);
+
+   // No loader thread -- load them now
+   if (loader == nullptr) loadTiles();
+}
+
+//------------------------------------------------------------------------------
+// loadTiles() -- loads the requested tiles, and evicts the least recently used
+//                tiles that are over the memory budget
+//------------------------------------------------------------------------------
+void TileManager::loadTiles()
+{
+   std::vector<DataFile*> evicted;
+
+   bool done{};
+   while (!done && !isShutdown()) {
+
+      // Next request
+      int key{};
+      base::lock(tileLock);
+      done = requests.empty();
+      if (!done) {
+         key = requests.front();
+         requests.pop_front();
+      }
+      base::unlock(tileLock);
+
+      if (!done) {
+         // Load the tile (without the lock)
+         DataFile* file{loadTile(key)};
+
+         base::lock(tileLock);
+
+         const auto it = tiles.find(key);
+         if (it != tiles.end() && it->second.state == REQUESTED) {
+            Tile& t = it->second;
+            if (file != nullptr) {
+               t.file = file;
+               t.state = LOADED;
+               t.bytes = sizeof(short) * file->getNumLatPoints() * file->getNumLonPoints();
+               t.lastUsed = ++useCount;
+               loadedBytes += t.bytes;
+               numLoads++;
+               if (file->getMinElevation() < getMinElevation()) setMinElevation(file->getMinElevation());
+               if (file->getMaxElevation() > getMaxElevation()) setMaxElevation(file->getMaxElevation());
+               file = nullptr;
+            } else {
+               t.state = MISSING;
+            }
+         }
+
+         // Evict the least recently used tiles, but not this one
+         while (loadedBytes > maxBytes) {
+            auto lru = tiles.end();
+            for (auto jt = tiles.begin(); jt != tiles.end(); ++jt) {
+               if (jt->second.state == LOADED && jt->first != key &&
+                   (lru == tiles.end() || jt->second.lastUsed < lru->second.lastUsed)) {
+                  lru = jt;
+               }
+            }
+            if (lru == tiles.end()) break;
+            evicted.push_back(lru->second.file);
+            loadedBytes -= lru->second.bytes;
+            numEvictions++;
+            tiles.erase(lru);
+         }
+
+         base::unlock(tileLock);
+
+         // Not needed (the tile was cleared while loading)
+         if (file != nullptr) file->unref();
+
+         // The evicted tiles are deleted once their lookups are done
+         for (DataFile* const p : evicted) { p->unref(); }
+         evicted.clear();
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// acquireTile() -- returns the tile, ref()'d, if it's loaded; otherwise
+//                  requests the tile (if it hasn't been) and returns zero
+//------------------------------------------------------------------------------
+DataFile* TileManager::acquireTile(const int ilat, const int ilon) const
+{
+   if (ilat < -90 || ilat > 89) return nullptr;
+
+   const int key{cellKey(ilat, ilon)};
+   DataFile* file{};
+
+   base::lock(tileLock);
+   const auto it = tiles.find(key);
+   if (it == tiles.end()) {
+      request(key);
+   } else if (it->second.state == LOADED) {
+      file = it->second.file;
+      file->ref();
+      it->second.lastUsed = ++useCount;
+   }
+   base::unlock(tileLock);
+
+   return file;
+}
+
+// Requests the tile; the caller holds the lock
+void TileManager::request(const int key) const
+{
+   tiles[key] = Tile();
+   requests.push_back(key);
+}
+
+//------------------------------------------------------------------------------
+// loadTile() -- loads a tile; returns zero if it's missing or fails to load
+//------------------------------------------------------------------------------
+DataFile* TileManager::loadTile(const int key) const
+{
+   const int ilat{key / 360 - 90};
+   const int ilon{key % 360 - 180};
+
+   std::string filename;
+   const char* p{getPathname()};
+   if (p != nullptr) {
+      filename += p;
+      filename += '/';
+   }
+   filename += tileFilename(ilat, ilon);
+
+   // Quietly skip the cells that we don't have
+   {
+      std::ifstream in(filename.c_str(), std::ios::binary);
+      if (!in.good()) return nullptr;
+   }
+
+   DataFile* file{};
+   if (format == "hgt") file = new SrtmHgtFile();
+   else if (format == "mtf") file = new MappedFile();
+   else file = new DtedFile();
+
+   const auto name = new base::String(filename.c_str());
+   file->setFilename(name);
+   name->unref();
+
+   // Terrain::reset() loads the data
+   file->reset();
+   if (!file->isDataLoaded()) {
+      if (isMessageEnabled(MSG_WARNING)) {
+         std::cerr << "TileManager::loadTile(): unable to load tile: " << filename << std::endl;
+      }
+      file->unref();
+      file = nullptr;
+   }
+   return file;
+}
+
+//------------------------------------------------------------------------------
+// tileFilename() -- the tile's file name, relative to our path
+//------------------------------------------------------------------------------
+std::string TileManager::tileFilename(const int ilat, const int ilon) const
+{
+   const int alat{std::abs(ilat)};
+   const int alon{std::abs(ilon)};
+   char buff[32]{};
+   if (format == "hgt") {
+      std::snprintf(buff, sizeof(buff), "%c%02d%c%03d.hgt", (ilat >= 0 ? 'N' : 'S'), alat, (ilon >= 0 ? 'E' : 'W'), alon);
+   }
+   else if (format == "mtf") {
+      std::snprintf(buff, sizeof(buff), "%c%02d%c%03d.mtf", (ilat >= 0 ? 'n' : 's'), alat, (ilon >= 0 ? 'e' : 'w'), alon);
+   }
+   else {
+      std::snprintf(buff, sizeof(buff), "%c%03d/%c%02d.%s", (ilon >= 0 ? 'e' : 'w'), alon, (ilat >= 0 ? 'n' : 's'), alat, format.c_str());
+   }
+   return std::string(buff);
+}
+
+// Cell key of the one degree cell with the southwest corner [ ilat ilon ] (degs)
+int TileManager::cellKey(const int ilat, const int ilon)
+{
+   int lon{(ilon + 180) % 360};
+   if (lon < 0) lon += 360;
+   return (ilat + 90) * 360 + lon;
+}
+
+//------------------------------------------------------------------------------
+// loadData() -- starts the loader thread; the tiles are loaded on demand
+//------------------------------------------------------------------------------
+bool TileManager::loadData()
+{
+   if (!started) {
+      started = true;
+
+      loader = new TileLoaderThread(this, LOADER_RATE);
+      loader->unref(); // 'loader' is a safe_ptr<>
+
+      // Lowest priority
+      bool ok{loader->start(0.0)};
+      if (!ok) {
+         loader = nullptr;
+         if (isMessageEnabled(MSG_ERROR)) {
+            std::cerr << "TileManager::loadData(): ERROR, failed to create the loader thread;";
+            std::cerr << " loading tiles in prefetch()" << std::endl;
+         }
+      }
+   }
+
+   setLatitudeSW(-90.0);
+   setLongitudeSW(-180.0);
+   setLatitudeNE(90.0);
+   setLongitudeNE(180.0);
+   if (coarse != nullptr) {
+      setMinElevation(coarse->getMinElevation());
+      setMaxElevation(coarse->getMaxElevation());
+   }
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// clear our data
+//------------------------------------------------------------------------------
+void TileManager::clearData()
+{
+   std::vector<DataFile*> files;
+
+   base::lock(tileLock);
+   for (auto& t : tiles) {
+      if (t.second.file != nullptr) files.push_back(t.second.file);
+   }
+   tiles.clear();
+   requests.clear();
+   loadedBytes = 0;
+   base::unlock(tileLock);
+
+   for (DataFile* const p : files) { p->unref(); }
+}
+
+//------------------------------------------------------------------------------
+// Slot functions
+//------------------------------------------------------------------------------
+
+bool TileManager::setSlotFormat(const base::String* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      ok = setFormat( std::string(msg->getString()) );
+      if (!ok && isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "TileManager::setSlotFormat(): invalid format: " << *msg << std::endl;
+      }
+   }
+   return ok;
+}
+
+bool TileManager::setSlotMaxMemory(const base::Number* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      ok = setMaxMemory( msg->getReal() );
+   }
+   return ok;
+}
+
+bool TileManager::setSlotPrefetchRadius(const base::Distance* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      ok = setPrefetchRadius( base::Meters::convertStatic(*msg) );
+   }
+   return ok;
+}
+
+bool TileManager::setSlotCoarse(Terrain* const msg)
+{
+   return setCoarseTerrain(msg);
+}
+
+}
+}
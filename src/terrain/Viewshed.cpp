@@ -0,0 +1,253 @@
+
+#include "mixr/terrain/Viewshed.hpp"
+#include "mixr/terrain/Terrain.hpp"
+
+#include "mixr/base/numeric/Integer.hpp"
+#include "mixr/base/units/Distances.hpp"
+#include "mixr/base/units/distance_utils.hpp"
+#include "mixr/base/util/nav_utils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace mixr {
+namespace terrain {
+
+IMPLEMENT_SUBCLASS(Viewshed, "Viewshed")
+
+BEGIN_SLOTTABLE(Viewshed)
+   "azimuths",       // 1) Number of azimuth bins
+   "ranges",         // 2) Number of range rings
+   "maxRange",       // 3) Max range
+END_SLOTTABLE(Viewshed)
+
+BEGIN_SLOT_MAP(Viewshed)
+   ON_SLOT(1, setSlotNumAzimuths,   base::Integer)
+   ON_SLOT(2, setSlotNumRanges,     base::Integer)
+   ON_SLOT(3, setSlotMaxRange,      base::Distance)
+END_SLOT_MAP()
+
+// Horizon with no terrain
+static const float NO_TERRAIN{-std::numeric_limits<float>::max()};
+
+Viewshed::Viewshed()
+{
+   STANDARD_CONSTRUCTOR()
+}
+
+void Viewshed::copyData(const Viewshed& org, const bool)
+{
+   BaseClass::copyData(org);
+
+   numAzimuths = org.numAzimuths;
+   numRanges = org.numRanges;
+   maxRange = org.maxRange;
+
+   refLat = org.refLat;
+   refLon = org.refLon;
+   refAlt = org.refAlt;
+
+   metaObject.addOwnedBytes( -static_cast<long>(sizeof(float) * horizons.size()) );
+   horizons = org.horizons;
+   metaObject.addOwnedBytes( static_cast<long>(sizeof(float) * horizons.size()) );
+}
+
+void Viewshed::deleteData()
+{
+   clear();
+}
+
+//------------------------------------------------------------------------------
+// Set functions
+//------------------------------------------------------------------------------
+bool Viewshed::setNumAzimuths(const unsigned int n)
+{
+   bool ok = false;
+   if (n > 0) {
+      numAzimuths = n;
+      clear();
+      ok = true;
+   }
+   return ok;
+}
+
+bool Viewshed::setNumRanges(const unsigned int n)
+{
+   bool ok = false;
+   if (n > 0) {
+      numRanges = n;
+      clear();
+      ok = true;
+   }
+   return ok;
+}
+
+bool Viewshed::setMaxRange(const double meters)
+{
+   bool ok = false;
+   if (meters > 0.0) {
+      maxRange = meters;
+      clear();
+      ok = true;
+   }
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// clear() -- clears the horizons
+//------------------------------------------------------------------------------
+void Viewshed::clear()
+{
+   metaObject.addOwnedBytes( -static_cast<long>(sizeof(float) * horizons.size()) );
+   std::vector<float>().swap(horizons);
+}
+
+//------------------------------------------------------------------------------
+// compute() -- computes the horizons of an observer
+//------------------------------------------------------------------------------
+bool Viewshed::compute(
+      const Terrain* const terrain,
+      const double lat,
+      const double lon,
+      const double alt
+   )
+{
+   // Same sampling as Terrain::targetOcculting(): 100 meter points, up to 1200
+   static const unsigned int MAX_POINTS = 1200;
+
+   clear();
+   if (terrain == nullptr || !terrain->isDataLoaded()) return false;
+
+   refLat = lat;
+   refLon = lon;
+   refAlt = alt;
+
+   unsigned int numPts = static_cast<unsigned int>((maxRange / 100.0) + 0.5);
+   if (numPts > MAX_POINTS) numPts = MAX_POINTS;
+   if (numPts < 2) numPts = 2;
+
+   const double azWidth = 360.0 / static_cast<double>(numAzimuths);
+   const double ringWidth = maxRange / static_cast<double>(numRanges);
+   const double deltaRng = maxRange / static_cast<double>(numPts - 1);
+
+   std::vector<float> table(static_cast<std::size_t>(numAzimuths) * numRanges, NO_TERRAIN);
+
+   double elevations[MAX_POINTS];
+   bool validFlags[MAX_POINTS];
+
+   for (unsigned int az = 0; az < numAzimuths; az++) {
+      float* const rings = &table[static_cast<std::size_t>(az) * numRanges];
+
+      // Two rays, a quarter bin either side of the bin's center
+      for (unsigned int ray = 0; ray < 2; ray++) {
+         const double brg = (static_cast<double>(az) + 0.25 + 0.5 * ray) * azWidth;
+
+         for (unsigned int i = 0; i < numPts; i++) { validFlags[i] = false; }
+         terrain->getElevations(elevations, validFlags, numPts, lat, lon, brg, maxRange, false);
+
+         // Max tangent within each ring
+         for (unsigned int i = 1; i < numPts; i++) {
+            if (!validFlags[i]) continue;
+            const double rng = deltaRng * static_cast<double>(i);
+            unsigned int ring = static_cast<unsigned int>(std::ceil(rng / ringWidth));
+            ring = (ring > 0) ? (ring - 1) : 0;
+            if (ring >= numRanges) ring = numRanges - 1;
+            const float tanAng = static_cast<float>((elevations[i] - alt) / rng);
+            if (tanAng > rings[ring]) rings[ring] = tanAng;
+         }
+      }
+
+      // Max out to each ring
+      for (unsigned int ring = 1; ring < numRanges; ring++) {
+         rings[ring] = std::max(rings[ring], rings[ring - 1]);
+      }
+   }
+
+   horizons.swap(table);
+   metaObject.addOwnedBytes( static_cast<long>(sizeof(float) * horizons.size()) );
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// isAt() -- true if the viewshed was computed within 'tolerance' meters of the position
+//------------------------------------------------------------------------------
+bool Viewshed::isAt(const double lat, const double lon, const double alt, const double tolerance) const
+{
+   if (!isComputed() || std::fabs(alt - refAlt) > tolerance) return false;
+
+   double brg = 0.0;
+   double distNM = 0.0;
+   base::nav::fll2bd(refLat, refLon, lat, lon, &brg, &distNM);
+   return (distNM * base::distance::NM2M) <= tolerance;
+}
+
+//------------------------------------------------------------------------------
+// targetOcculting() -- terrain occulting check of a target within the viewshed
+//------------------------------------------------------------------------------
+bool Viewshed::targetOcculting(
+      bool* const occulted,
+      const double tgtLat,
+      const double tgtLon,
+      const double tgtAlt
+   ) const
+{
+   if (occulted == nullptr || !isComputed()) return false;
+
+   // Bearing and distance to the target (flat earth)
+   double brg = 0.0;
+   double distNM = 0.0;
+   base::nav::fll2bd(refLat, refLon, tgtLat, tgtLon, &brg, &distNM);
+   const double dist = distNM * base::distance::NM2M;
+   if (dist > maxRange) return false;
+
+   // Rings that are completely between us and the target
+   const double ringWidth = maxRange / static_cast<double>(numRanges);
+   const int ring = static_cast<int>(dist / ringWidth) - 1;
+   if (ring < 0) {
+      *occulted = false;
+      return true;
+   }
+
+   const double azWidth = 360.0 / static_cast<double>(numAzimuths);
+   int az = static_cast<int>(std::floor(brg / azWidth)) % static_cast<int>(numAzimuths);
+   if (az < 0) az += numAzimuths;
+
+   const float horizon = horizons[static_cast<std::size_t>(az) * numRanges + static_cast<unsigned int>(ring)];
+   *occulted = ((tgtAlt - refAlt) / dist) < horizon;
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// Slot functions
+//------------------------------------------------------------------------------
+bool Viewshed::setSlotNumAzimuths(const base::Integer* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr && msg->getInt() > 0) {
+      ok = setNumAzimuths( static_cast<unsigned int>(msg->getInt()) );
+   }
+   return ok;
+}
+
+bool Viewshed::setSlotNumRanges(const base::Integer* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr && msg->getInt() > 0) {
+      ok = setNumRanges( static_cast<unsigned int>(msg->getInt()) );
+   }
+   return ok;
+}
+
+bool Viewshed::setSlotMaxRange(const base::Distance* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      ok = setMaxRange( base::Meters::convertStatic(*msg) );
+   }
+   return ok;
+}
+
+}
+}
@@ -3,9 +3,13 @@
 
 #include "mixr/base/Object.hpp"
 
+#include "mixr/terrain/LosCache.hpp"
 #include "mixr/terrain/QuadMap.hpp"
+#include "mixr/terrain/TileManager.hpp"
+#include "mixr/terrain/Viewshed.hpp"
 #include "mixr/terrain/ded/DedFile.hpp"
 #include "mixr/terrain/dted/DtedFile.hpp"
+#include "mixr/terrain/mapped/MappedFile.hpp"
 #include "mixr/terrain/srtm/SrtmHgtFile.hpp"
 
 #include <string>
@@ -29,6 +33,18 @@ base::Object* factory(const std::string& name)
     else if ( name == SrtmHgtFile::getFactoryName() ) {
         obj = new SrtmHgtFile();
     }
+    else if ( name == MappedFile::getFactoryName() ) {
+        obj = new MappedFile();
+    }
+    else if ( name == TileManager::getFactoryName() ) {
+        obj = new TileManager();
+    }
+    else if ( name == LosCache::getFactoryName() ) {
+        obj = new LosCache();
+    }
+    else if ( name == Viewshed::getFactoryName() ) {
+        obj = new Viewshed();
+    }
 
     return obj;
 }
@@ -0,0 +1,264 @@
+
+#if defined(WIN32)
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "mixr/terrain/mapped/MappedFile.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace mixr {
+namespace terrain {
+
+//------------------------------------------------------------------------------
+// Maps the whole file, read only; returns true if successful
+//------------------------------------------------------------------------------
+static bool mapFile(const char* const filename, void** const view, std::size_t* const size)
+{
+#if defined(WIN32)
+   HANDLE file{CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr)};
+   if (file == INVALID_HANDLE_VALUE) return false;
+
+   LARGE_INTEGER fsize{};
+   bool ok{GetFileSizeEx(file, &fsize) != 0 && fsize.QuadPart > 0};
+   if (ok) {
+      // The view keeps the mapping open after the handles are closed
+      HANDLE mapping{CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr)};
+      ok = (mapping != nullptr);
+      if (ok) {
+         *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+         *size = static_cast<std::size_t>(fsize.QuadPart);
+         ok = (*view != nullptr);
+         CloseHandle(mapping);
+      }
+   }
+   CloseHandle(file);
+   return ok;
+#else
+   const int fd{open(filename, O_RDONLY)};
+   if (fd < 0) return false;
+
+   struct stat st{};
+   bool ok{fstat(fd, &st) == 0 && st.st_size > 0};
+   if (ok) {
+      // The mapping stays valid after the file is closed
+      void* const p{mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0)};
+      ok = (p != MAP_FAILED);
+      if (ok) {
+         *view = p;
+         *size = static_cast<std::size_t>(st.st_size);
+      }
+   }
+   close(fd);
+   return ok;
+#endif
+}
+
+static void unmapFile(void* const view, const std::size_t size)
+{
+#if defined(WIN32)
+   (void) size;
+   UnmapViewOfFile(view);
+#else
+   munmap(view, size);
+#endif
+}
+
+//==============================================================================
+// MappedFile class
+//==============================================================================
+
+IMPLEMENT_SUBCLASS(MappedFile, "MappedFile")
+EMPTY_SLOTTABLE(MappedFile)
+
+const char MappedFile::MAGIC[8]{'M', 'I', 'X', 'R', 'T', 'I', 'L', 'E'};
+
+MappedFile::MappedFile()
+{
+   static_assert(sizeof(Header) == 128, "MappedFile::Header must be 128 bytes");
+   STANDARD_CONSTRUCTOR()
+}
+
+void MappedFile::copyData(const MappedFile& org, const bool)
+{
+   // Unmap our file first, so that a copy of an unloaded file doesn't keep
+   // our columns (and view) with the other's sizes
+   clearData();
+
+   BaseClass::copyData(org);
+
+   // Map the same file (and share its pages)
+   if (org.isDataLoaded()) {
+      loadData();
+   }
+}
+
+void MappedFile::deleteData()
+{
+   clearData();
+}
+
+//------------------------------------------------------------------------------
+// Map the tile file
+//------------------------------------------------------------------------------
+bool MappedFile::loadData()
+{
+   // (a copy keeps the elevation pyramid that it copied)
+   if (view != nullptr) clearData();
+
+   // Compute the filename
+   std::string temp_filename;
+   const char* p {getPathname()};
+   if (p != nullptr) {
+      temp_filename += p;
+      temp_filename += '/';
+   }
+   p = getFilename();
+   if (p != nullptr)
+      temp_filename += p;
+
+   const char* filename {temp_filename.c_str()};
+   if ( !mapFile(filename, &view, &viewSize) ) {
+      view = nullptr;
+      viewSize = 0;
+      if (isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "MappedFile::loadData() ERROR, could not map file: " << filename << std::endl;
+      }
+      return false;
+   }
+
+   // ---
+   // Check the header
+   // ---
+   const Header* const hdr{static_cast<const Header*>(view)};
+   const char* error{};
+   if (viewSize < sizeof(Header) || std::memcmp(hdr->magic, MAGIC, sizeof(MAGIC)) != 0) {
+      error = "not a terrain tile file";
+   }
+   else if (hdr->byteOrder != BYTE_ORDER_MARK) {
+      error = "written with a different byte order; convert the source data again";
+   }
+   else if (hdr->version != VERSION) {
+      error = "unsupported version";
+   }
+   else if (hdr->nptlat < 2 || hdr->nptlong < 2 || hdr->latSpacing <= 0.0 || hdr->lonSpacing <= 0.0) {
+      error = "invalid header";
+   }
+   else if ((viewSize - sizeof(Header)) / sizeof(short) / hdr->nptlong < hdr->nptlat) {
+      error = "file is too short";
+   }
+
+   if (error != nullptr) {
+      if (isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "MappedFile::loadData() ERROR, " << error << ": " << filename << std::endl;
+      }
+      clearData();
+      return false;
+   }
+
+   // ---
+   // Point the columns at the mapped posts
+   // ---
+   nptlat = hdr->nptlat;
+   nptlong = hdr->nptlong;
+   latSpacing = hdr->latSpacing;
+   lonSpacing = hdr->lonSpacing;
+   voidValue = hdr->voidValue;
+
+   short* const posts{reinterpret_cast<short*>(static_cast<char*>(view) + sizeof(Header))};
+   columns = new short*[nptlong];
+   for (unsigned int i = 0; i < nptlong; i++) {
+      columns[i] = posts + static_cast<std::size_t>(i) * nptlat;
+   }
+
+   setLatitudeSW(hdr->swLat);
+   setLongitudeSW(hdr->swLon);
+   setLatitudeNE(hdr->neLat);
+   setLongitudeNE(hdr->neLon);
+   setMinElevation(hdr->minElev);
+   setMaxElevation(hdr->maxElev);
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// Unmap the tile file
+//------------------------------------------------------------------------------
+void MappedFile::clearData()
+{
+   // Only the array of column pointers is ours; the columns are in the view
+   if (columns != nullptr) {
+      delete[] columns;
+      columns = nullptr;
+   }
+
+   if (view != nullptr) {
+      unmapFile(view, viewSize);
+      view = nullptr;
+      viewSize = 0;
+   }
+
+   BaseClass::clearData();
+}
+
+//------------------------------------------------------------------------------
+// Writes the loaded data file to a tile file; returns true if successful
+//------------------------------------------------------------------------------
+bool MappedFile::write(const DataFile* const source, const std::string& filename)
+{
+   if (source == nullptr || !source->isDataLoaded()) {
+      std::cerr << "MappedFile::write() ERROR, no source data: " << filename << std::endl;
+      return false;
+   }
+
+   Header hdr{};
+   std::memcpy(hdr.magic, MAGIC, sizeof(MAGIC));
+   hdr.byteOrder = BYTE_ORDER_MARK;
+   hdr.version = VERSION;
+   hdr.nptlat = source->getNumLatPoints();
+   hdr.nptlong = source->getNumLonPoints();
+   hdr.swLat = source->getLatitudeSW();
+   hdr.swLon = source->getLongitudeSW();
+   hdr.neLat = source->getLatitudeNE();
+   hdr.neLon = source->getLongitudeNE();
+   hdr.latSpacing = source->getLatSpacing();
+   hdr.lonSpacing = source->getLonSpacing();
+   hdr.minElev = source->getMinElevation();
+   hdr.maxElev = source->getMaxElevation();
+   hdr.voidValue = source->getVoidValue();
+
+   std::ofstream out;
+   out.open(filename.c_str(), std::ios::binary | std::ios::trunc);
+   if ( out.fail() ) {
+      std::cerr << "MappedFile::write() ERROR, could not open file: " << filename << std::endl;
+      return false;
+   }
+
+   out.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
+
+   // Missing columns are written as voids
+   const std::vector<short> voids(hdr.nptlat, hdr.voidValue);
+   for (unsigned int i = 0; i < hdr.nptlong && !out.fail(); i++) {
+      const short* col{source->getColumn(i)};
+      if (col == nullptr) col = voids.data();
+      out.write(reinterpret_cast<const char*>(col), sizeof(short) * hdr.nptlat);
+   }
+
+   const bool ok{!out.fail()};
+   out.close();
+   if (!ok) {
+      std::cerr << "MappedFile::write() ERROR writing file: " << filename << std::endl;
+   }
+   return ok;
+}
+
+}
+}
@@ -0,0 +1,241 @@
+//------------------------------------------------------------------------------
+// R/F interactions regression test
+//
+//    Runs the same scenario with the antennas' 'batchInteractions' flag off
+//    (event path) and on (see Antenna, note 4), and compares the radars'
+//    report queues, frame by frame: the same targets, in the same order,
+//    with the same signal/noise and range.
+//
+//    Usage: rf_batch_interactions <event path EDL> <batched EDL> [ frames ]
+//------------------------------------------------------------------------------
+
+#include "mixr/models/factory.hpp"
+#include "mixr/models/Emission.hpp"
+#include "mixr/models/WorldModel.hpp"
+#include "mixr/models/player/Player.hpp"
+#include "mixr/models/system/Radar.hpp"
+
+#include "mixr/simulation/factory.hpp"
+
+#include "mixr/base/edl_parser.hpp"
+#include "mixr/base/factory.hpp"
+#include "mixr/base/Pair.hpp"
+#include "mixr/base/PairStream.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace mixr {
+namespace test {
+
+//------------------------------------------------------------------------------
+// Class: TestRadar
+// Description: Radar that records its report queue after each receive phase
+//
+// Factory name: TestRadar
+//------------------------------------------------------------------------------
+class TestRadar : public models::Radar
+{
+   DECLARE_SUBCLASS(TestRadar, models::Radar)
+
+public:
+   struct Report {
+      unsigned int frame {};        // Frame number
+      unsigned short target {};     // Target player ID
+      double sn {};                 // Signal/noise (dB)
+      double range {};              // Range (meters)
+   };
+
+public:
+   TestRadar();
+
+   const std::vector<Report>& getRecordedReports() const    { return recorded; }
+
+protected:
+   void receive(const double dt) override;
+
+private:
+   std::vector<Report> recorded;
+   unsigned int frames {};
+};
+
+IMPLEMENT_SUBCLASS(TestRadar, "TestRadar")
+EMPTY_SLOTTABLE(TestRadar)
+EMPTY_DELETEDATA(TestRadar)
+
+TestRadar::TestRadar()
+{
+   STANDARD_CONSTRUCTOR()
+}
+
+void TestRadar::copyData(const TestRadar& org, const bool)
+{
+   BaseClass::copyData(org);
+   recorded = org.recorded;
+   frames = org.frames;
+}
+
+void TestRadar::receive(const double dt)
+{
+   BaseClass::receive(dt);
+
+   // The queued reports, in the order that process() takes them
+   const unsigned int n{rptQueue.entries()};
+   for (unsigned int i = 0; i < n; i++) {
+      const models::Emission* const em{rptQueue.peek0(i)};
+      Report r;
+      r.frame = frames;
+      r.target = (em->getTarget() != nullptr) ? em->getTarget()->getID() : 0;
+      r.sn = rptSnQueue.peek0(i);
+      r.range = em->getRange();
+      recorded.push_back(r);
+   }
+   frames++;
+}
+
+//------------------------------------------------------------------------------
+// Test factory
+//------------------------------------------------------------------------------
+static base::Object* factory(const std::string& name)
+{
+   base::Object* obj{};
+
+   if ( name == TestRadar::getFactoryName() ) {
+      obj = new TestRadar();
+   }
+
+   if (obj == nullptr) obj = models::factory(name);
+   if (obj == nullptr) obj = simulation::factory(name);
+   if (obj == nullptr) obj = base::factory(name);
+   return obj;
+}
+
+// Each player's recorded reports (by player ID)
+struct Recording {
+   unsigned short player {};
+   std::vector<TestRadar::Report> reports;
+};
+
+//------------------------------------------------------------------------------
+// run() -- runs the scenario for 'frames' frames; returns false on error
+//------------------------------------------------------------------------------
+static bool run(const std::string& filename, const unsigned int frames, std::vector<Recording>* const results)
+{
+   int errors{};
+   base::Object* obj{base::edl_parser(filename, factory, &errors)};
+   if (errors > 0 || obj == nullptr) {
+      std::cerr << "rf_batch_interactions: errors parsing: " << filename << std::endl;
+      if (obj != nullptr) obj->unref();
+      return false;
+   }
+
+   // The file may contain a base::Pair
+   if (const auto pair = dynamic_cast<base::Pair*>(obj)) {
+      obj = pair->object();
+      obj->ref();
+      pair->unref();
+   }
+
+   const auto wm = dynamic_cast<models::WorldModel*>(obj);
+   if (wm == nullptr) {
+      std::cerr << "rf_batch_interactions: not a WorldModel: " << filename << std::endl;
+      obj->unref();
+      return false;
+   }
+
+   // Run the frames; single threaded, so the order is deterministic
+   const double dt{1.0 / 50.0};
+   wm->reset();
+   for (unsigned int i = 0; i < frames; i++) {
+      wm->updateTC(dt);
+      wm->updateData(dt);
+   }
+
+   // Collect the radars' recordings
+   results->clear();
+   base::PairStream* players{wm->getPlayers()};
+   if (players != nullptr) {
+      for (base::List::Item* item = players->getFirstItem(); item != nullptr; item = item->getNext()) {
+         const auto p = dynamic_cast<models::Player*>(static_cast<base::Pair*>(item->getValue())->object());
+         if (p == nullptr) continue;
+         const auto radar = dynamic_cast<const TestRadar*>(p->getSensor());
+         if (radar != nullptr) {
+            Recording r;
+            r.player = p->getID();
+            r.reports = radar->getRecordedReports();
+            results->push_back(r);
+         }
+      }
+      players->unref();
+   }
+
+   wm->unref();
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// compare() -- compares the recordings; returns the number of differences
+//------------------------------------------------------------------------------
+static unsigned int compare(const std::vector<Recording>& a, const std::vector<Recording>& b)
+{
+   if (a.size() != b.size()) {
+      std::cerr << "number of radars: " << a.size() << " vs " << b.size() << std::endl;
+      return 1;
+   }
+
+   unsigned int diffs{};
+   for (std::size_t i = 0; i < a.size(); i++) {
+      const std::vector<TestRadar::Report>& ra{a[i].reports};
+      const std::vector<TestRadar::Report>& rb{b[i].reports};
+      std::cout << "player " << a[i].player << ": " << ra.size() << " reports" << std::endl;
+      if (a[i].player != b[i].player || ra.size() != rb.size()) {
+         std::cerr << "player " << a[i].player << ": " << ra.size() << " vs "
+                   << rb.size() << " reports (player " << b[i].player << ")" << std::endl;
+         diffs++;
+         continue;
+      }
+      for (std::size_t j = 0; j < ra.size(); j++) {
+         if (ra[j].frame != rb[j].frame || ra[j].target != rb[j].target ||
+             ra[j].sn != rb[j].sn || ra[j].range != rb[j].range) {
+            std::cerr << "player " << a[i].player << ", report " << j << ": frame "
+                      << ra[j].frame << " vs " << rb[j].frame << ", target "
+                      << ra[j].target << " vs " << rb[j].target << ", S/N "
+                      << ra[j].sn << " vs " << rb[j].sn << std::endl;
+            diffs++;
+         }
+      }
+   }
+   return diffs;
+}
+
+}
+}
+
+int main(int argc, char* argv[])
+{
+   if (argc < 3) {
+      std::cerr << "usage: rf_batch_interactions <event path EDL> <batched EDL> [ frames ]" << std::endl;
+      return EXIT_FAILURE;
+   }
+   const unsigned int frames{(argc > 3) ? static_cast<unsigned int>(std::atoi(argv[3])) : 500};
+
+   std::vector<mixr::test::Recording> events;
+   std::vector<mixr::test::Recording> batched;
+   if (!mixr::test::run(argv[1], frames, &events) || !mixr::test::run(argv[2], frames, &batched)) {
+      return EXIT_FAILURE;
+   }
+
+   // Make sure that there's something to compare
+   std::size_t n{};
+   for (const mixr::test::Recording& r : events) n += r.reports.size();
+   if (n == 0) {
+      std::cerr << "rf_batch_interactions: no reports" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   const unsigned int diffs{mixr::test::compare(events, batched)};
+   std::cout << (diffs == 0 ? "PASSED" : "FAILED") << ": " << n << " reports, " << diffs << " differences" << std::endl;
+   return (diffs == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,174 @@
+//------------------------------------------------------------------------------
+// Tdb boresight kernels test and benchmark
+//
+//    Runs Tdb's AVX2 and scalar boresight kernels, normalizeLos() and
+//    transformLos(), over the same random LOS vectors, and checks that their
+//    results are the same, bit-for-bit, for 0 to 67 targets (all of the
+//    remainders) and for 1000, 2000 and 4096 targets.  Skipped (exit code 77)
+//    if the AVX2 kernels aren't available.
+//
+//    With 'benchmark', times both versions of the kernels, and the dispatched
+//    versions that computeBoresightData() uses, at 1000, 2000 and 4096 targets.
+//
+//    Usage: tdb_los_kernels [ benchmark ]
+//------------------------------------------------------------------------------
+
+#include "mixr/models/Tdb.hpp"
+
+#include "mixr/base/util/system_utils.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace mixr {
+namespace test {
+
+static const int SKIPPED{77};
+
+// Target arrays (inputs and outputs)
+struct Targets {
+   explicit Targets(const unsigned int n) : x(n), y(n), z(n), vx(n), vy(n), vz(n), rng(n), rdot(n), tx(n), ty(n), tz(n) {}
+   std::vector<double> x, y, z, vx, vy, vz, rng, rdot, tx, ty, tz;
+};
+
+// Random LOS vectors and relative velocities, with a few zero length vectors
+static void randomTargets(Targets* const t, std::mt19937* const gen)
+{
+   std::uniform_real_distribution<double> pos(-200000.0, 200000.0);
+   std::uniform_real_distribution<double> vel(-600.0, 600.0);
+   for (std::size_t i = 0; i < t->x.size(); i++) {
+      const bool zero{(i % 17) == 5};
+      t->x[i] = zero ? 0.0 : pos(*gen);
+      t->y[i] = zero ? 0.0 : pos(*gen);
+      t->z[i] = zero ? 0.0 : pos(*gen) * 0.05;
+      t->vx[i] = vel(*gen);
+      t->vy[i] = vel(*gen);
+      t->vz[i] = vel(*gen);
+   }
+}
+
+// An ECEF to NED like rotation, with a translation
+static base::Matrixd testMatrix()
+{
+   base::Matrixd m;
+   m.makeRotate(0.61, 0.0, 0.0, 1.0);
+   base::Matrixd r;
+   r.makeRotate(-1.13, 0.0, 1.0, 0.0);
+   m *= r;
+   m(0,3) = 1.5;
+   m(1,3) = -2.25;
+   m(2,3) = 0.125;
+   return m;
+}
+
+// Runs the kernels ('avx2' or scalar) on 't'
+static void runKernels(Targets* const t, const base::Matrixd& m, const bool avx2)
+{
+   const unsigned int n{static_cast<unsigned int>(t->x.size())};
+   if (avx2) {
+      models::Tdb::normalizeLosAvx2(n, t->x.data(), t->y.data(), t->z.data(), t->vx.data(), t->vy.data(), t->vz.data(), t->rng.data(), t->rdot.data());
+      models::Tdb::transformLosAvx2(n, m, t->x.data(), t->y.data(), t->z.data(), t->tx.data(), t->ty.data(), t->tz.data());
+   }
+   else {
+      models::Tdb::normalizeLosScalar(n, t->x.data(), t->y.data(), t->z.data(), t->vx.data(), t->vy.data(), t->vz.data(), t->rng.data(), t->rdot.data());
+      models::Tdb::transformLosScalar(n, m, t->x.data(), t->y.data(), t->z.data(), t->tx.data(), t->ty.data(), t->tz.data());
+   }
+}
+
+// Bit-for-bit comparison of two arrays
+static bool same(const std::vector<double>& a, const std::vector<double>& b)
+{
+   return a.size() == b.size() && (a.empty() || std::memcmp(a.data(), b.data(), a.size() * sizeof(double)) == 0);
+}
+
+//------------------------------------------------------------------------------
+// check() -- compares the AVX2 and scalar kernels; returns the number of
+// differences
+//------------------------------------------------------------------------------
+static unsigned int check()
+{
+   std::mt19937 gen(1234);
+   const base::Matrixd m{testMatrix()};
+
+   std::vector<unsigned int> sizes;
+   for (unsigned int n = 0; n < 68; n++) sizes.push_back(n);
+   sizes.push_back(1000);
+   sizes.push_back(2000);
+   sizes.push_back(4096);
+
+   unsigned int diffs{};
+   for (const unsigned int n : sizes) {
+      Targets a(n);
+      randomTargets(&a, &gen);
+      Targets b{a};
+      runKernels(&a, m, false);
+      runKernels(&b, m, true);
+      if (!same(a.x, b.x) || !same(a.y, b.y) || !same(a.z, b.z) || !same(a.rng, b.rng) ||
+          !same(a.rdot, b.rdot) || !same(a.tx, b.tx) || !same(a.ty, b.ty) || !same(a.tz, b.tz)) {
+         std::cerr << n << " targets: AVX2 and scalar results differ" << std::endl;
+         diffs++;
+      }
+   }
+   return diffs;
+}
+
+//------------------------------------------------------------------------------
+// benchmark() -- times the kernels
+//------------------------------------------------------------------------------
+static void benchmark()
+{
+   std::mt19937 gen(1234);
+   const base::Matrixd m{testMatrix()};
+   const unsigned int sizes[]{1000, 2000, 4096};
+   const char* const names[]{"scalar", "AVX2", "dispatched"};
+
+   for (const unsigned int n : sizes) {
+      Targets src(n);
+      randomTargets(&src, &gen);
+      const unsigned int reps{4000000 / n};
+      for (int k = 0; k < 3; k++) {
+         if (k == 1 && !models::Tdb::isAvx2LosAvailable()) continue;
+         Targets t{src};
+         const double start{base::getComputerTime()};
+         for (unsigned int r = 0; r < reps; r++) {
+            // Restore the inputs, as computeBoresightData() gathers them each frame
+            std::memcpy(t.x.data(), src.x.data(), n * sizeof(double));
+            std::memcpy(t.y.data(), src.y.data(), n * sizeof(double));
+            std::memcpy(t.z.data(), src.z.data(), n * sizeof(double));
+            if (k == 2) {
+               models::Tdb::normalizeLos(n, t.x.data(), t.y.data(), t.z.data(), t.vx.data(), t.vy.data(), t.vz.data(), t.rng.data(), t.rdot.data());
+               models::Tdb::transformLos(n, m, t.x.data(), t.y.data(), t.z.data(), t.tx.data(), t.ty.data(), t.tz.data());
+            }
+            else {
+               runKernels(&t, m, (k == 1));
+            }
+         }
+         const double ns{(base::getComputerTime() - start) * 1.0e9 / (static_cast<double>(reps) * n)};
+         std::cout << n << " targets, " << names[k] << ": " << ns << " ns/target" << std::endl;
+      }
+   }
+}
+
+}
+}
+
+int main(int argc, char* argv[])
+{
+   if (argc > 1 && std::string(argv[1]) == "benchmark") {
+      mixr::test::benchmark();
+      return EXIT_SUCCESS;
+   }
+
+   if (!mixr::models::Tdb::isAvx2LosAvailable()) {
+      std::cout << "SKIPPED: the AVX2 kernels aren't available" << std::endl;
+      return mixr::test::SKIPPED;
+   }
+
+   const unsigned int diffs{mixr::test::check()};
+   std::cout << (diffs == 0 ? "PASSED" : "FAILED") << ": " << diffs << " differences" << std::endl;
+   return (diffs == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
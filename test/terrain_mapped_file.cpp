@@ -0,0 +1,205 @@
+//------------------------------------------------------------------------------
+// Tile file round trip test
+//
+//    Writes a SRTM3 file, N36W118.hgt, to the work directory, converts it to
+//    a tile file, n36w118.mtf, using MappedFile::write(), and reads the tile
+//    file back using MappedFile and a TileManager ("mtf" format).  The header
+//    values, all of the posts and the elevation lookups must match the SRTM
+//    file's.
+//
+//    Usage: terrain_mapped_file <work directory>
+//------------------------------------------------------------------------------
+
+#include "mixr/terrain/mapped/MappedFile.hpp"
+#include "mixr/terrain/srtm/SrtmHgtFile.hpp"
+#include "mixr/terrain/TileManager.hpp"
+
+#include "mixr/base/String.hpp"
+#include "mixr/base/util/system_utils.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace mixr {
+namespace test {
+
+// SRTM3: 1201 x 1201 posts, three arc seconds apart
+static const unsigned int NPTS{1201};
+
+// Test elevation (meters) of post [ lat lon ], counted from the southwest corner
+static short testElevation(const unsigned int lat, const unsigned int lon)
+{
+   return static_cast<short>((lat * 7 + lon * 13) % 4000) - 200;
+}
+
+//------------------------------------------------------------------------------
+// writeHgt() -- writes the SRTM3 file; returns false on error
+//------------------------------------------------------------------------------
+static bool writeHgt(const std::string& filename)
+{
+   std::ofstream out(filename.c_str(), std::ios::binary | std::ios::trunc);
+   if (out.fail()) return false;
+
+   // Rows from the north, high byte first, sign and magnitude
+   for (unsigned int i = 0; i < NPTS; i++) {
+      const unsigned int lat{NPTS - i - 1};
+      for (unsigned int lon = 0; lon < NPTS; lon++) {
+         const short h{testElevation(lat, lon)};
+         const unsigned int mag{static_cast<unsigned int>(h < 0 ? -h : h)};
+         const char values[2]{
+            static_cast<char>(((mag >> 8) & 0177) | (h < 0 ? 0200 : 0)),
+            static_cast<char>(mag & 0377)
+         };
+         out.write(values, sizeof(values));
+      }
+   }
+   return !out.fail();
+}
+
+// Sets the terrain's file name and loads it
+static void load(terrain::Terrain* const terrain, const std::string& filename)
+{
+   const auto name = new base::String(filename.c_str());
+   terrain->setFilename(name);
+   name->unref();
+   terrain->reset();
+}
+
+//------------------------------------------------------------------------------
+// compareFiles() -- compares the tile file with its source; returns the
+// number of differences
+//------------------------------------------------------------------------------
+static unsigned int compareFiles(const terrain::DataFile* const a, const terrain::DataFile* const b)
+{
+   unsigned int diffs{};
+   if (a->getNumLatPoints() != b->getNumLatPoints() || a->getNumLonPoints() != b->getNumLonPoints()) {
+      std::cerr << "posts: " << a->getNumLonPoints() << " x " << a->getNumLatPoints() << " vs "
+                << b->getNumLonPoints() << " x " << b->getNumLatPoints() << std::endl;
+      return 1;
+   }
+   if (a->getLatitudeSW() != b->getLatitudeSW() || a->getLongitudeSW() != b->getLongitudeSW() ||
+       a->getLatitudeNE() != b->getLatitudeNE() || a->getLongitudeNE() != b->getLongitudeNE() ||
+       a->getLatSpacing() != b->getLatSpacing() || a->getLonSpacing() != b->getLonSpacing()) {
+      std::cerr << "corners or spacing differ" << std::endl;
+      diffs++;
+   }
+   if (a->getMinElevation() != b->getMinElevation() || a->getMaxElevation() != b->getMaxElevation() ||
+       a->getVoidValue() != b->getVoidValue()) {
+      std::cerr << "min/max elevations or void value differ" << std::endl;
+      diffs++;
+   }
+
+   for (unsigned int i = 0; i < a->getNumLonPoints(); i++) {
+      const short* const ca{a->getColumn(i)};
+      const short* const cb{b->getColumn(i)};
+      for (unsigned int j = 0; j < a->getNumLatPoints(); j++) {
+         if (ca[j] != cb[j] || ca[j] != testElevation(j, i)) {
+            if (diffs < 10) {
+               std::cerr << "post [ " << j << " " << i << " ]: " << ca[j] << " vs " << cb[j] << std::endl;
+            }
+            diffs++;
+         }
+      }
+   }
+   return diffs;
+}
+
+//------------------------------------------------------------------------------
+// compareLookups() -- compares the elevation lookups; returns the number of
+// differences
+//------------------------------------------------------------------------------
+static unsigned int compareLookups(const terrain::Terrain* const a, const terrain::Terrain* const b)
+{
+   unsigned int diffs{};
+   for (unsigned int i = 0; i <= 100; i++) {
+      for (unsigned int j = 0; j <= 100; j++) {
+         const double lat{36.0 + i * 0.00999};
+         const double lon{-118.0 + j * 0.00999};
+         for (int interp = 0; interp < 2; interp++) {
+            double ea{};
+            double eb{};
+            const bool fa{a->getElevation(&ea, lat, lon, interp != 0)};
+            const bool fb{b->getElevation(&eb, lat, lon, interp != 0)};
+            if (fa != fb || ea != eb) {
+               if (diffs < 10) {
+                  std::cerr << "elevation at [ " << lat << " " << lon << " ]: " << ea << " vs " << eb << std::endl;
+               }
+               diffs++;
+            }
+         }
+      }
+   }
+   return diffs;
+}
+
+}
+}
+
+int main(int argc, char* argv[])
+{
+   if (argc < 2) {
+      std::cerr << "usage: terrain_mapped_file <work directory>" << std::endl;
+      return EXIT_FAILURE;
+   }
+   const std::string dir{argv[1]};
+   const std::string hgtFilename{dir + "/N36W118.hgt"};
+   const std::string mtfFilename{dir + "/n36w118.mtf"};
+
+   if (!mixr::test::writeHgt(hgtFilename)) {
+      std::cerr << "terrain_mapped_file: unable to write: " << hgtFilename << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   // Convert
+   const auto srtm = new mixr::terrain::SrtmHgtFile();
+   mixr::test::load(srtm, hgtFilename);
+   if (!srtm->isDataLoaded() || !mixr::terrain::MappedFile::write(srtm, mtfFilename)) {
+      std::cerr << "terrain_mapped_file: unable to convert: " << hgtFilename << std::endl;
+      srtm->unref();
+      return EXIT_FAILURE;
+   }
+
+   // Read back, directly ...
+   unsigned int diffs{};
+   const auto mapped = new mixr::terrain::MappedFile();
+   mixr::test::load(mapped, mtfFilename);
+   if (!mapped->isDataLoaded()) {
+      std::cerr << "terrain_mapped_file: unable to load: " << mtfFilename << std::endl;
+      diffs++;
+   }
+   else {
+      diffs += mixr::test::compareFiles(srtm, mapped);
+      diffs += mixr::test::compareLookups(srtm, mapped);
+   }
+   mapped->unref();
+
+   // ... and as a tile
+   const auto tiles = new mixr::terrain::TileManager();
+   const auto path = new mixr::base::String(dir.c_str());
+   tiles->setPathname(path);
+   path->unref();
+   tiles->setFormat("mtf");
+   tiles->reset();
+
+   // The lookups don't wait for the tile, so wait for the loader (10 seconds, max)
+   double elev{};
+   tiles->getElevation(&elev, 36.5, -117.5);
+   for (unsigned int i = 0; i < 1000 && tiles->getNumLoadedTiles() == 0; i++) {
+      mixr::base::msleep(10);
+   }
+   if (tiles->getNumLoadedTiles() != 1) {
+      std::cerr << "terrain_mapped_file: TileManager didn't load: " << mtfFilename << std::endl;
+      diffs++;
+   }
+   else {
+      diffs += mixr::test::compareLookups(srtm, tiles);
+   }
+   tiles->event(mixr::base::Component::SHUTDOWN_EVENT);
+   tiles->unref();
+   srtm->unref();
+
+   std::cout << (diffs == 0 ? "PASSED" : "FAILED") << ": " << diffs << " differences" << std::endl;
+   return (diffs == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,167 @@
+//------------------------------------------------------------------------------
+// Terrain occulting check kernel test and benchmark
+//
+//    Runs Terrain's AVX and scalar occulting check kernels, anyPointAbove(),
+//    over the same random elevation profiles, with and without valid flags,
+//    and checks that their results are the same for 0 to 67 points (all of
+//    the remainders) and for 1000, 2000 and 4096 points.  Each profile is
+//    checked at angles just below, at and just above its highest point, so
+//    both results, and the boundary, are covered.  Skipped (exit code 77) if
+//    the AVX kernel isn't available.
+//
+//    With 'benchmark', times both versions of the kernel, and the dispatched
+//    version that occultCheck() uses, over whole profiles (no early out) of
+//    1000, 2000 and 4096 points.
+//
+//    Usage: terrain_occult_kernels [ benchmark ]
+//------------------------------------------------------------------------------
+
+#include "mixr/terrain/Terrain.hpp"
+
+#include "mixr/base/util/system_utils.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace mixr {
+namespace test {
+
+static const int SKIPPED{77};
+
+// Elevation profile
+struct Profile {
+   explicit Profile(const unsigned int n) : elevations(n), valid(n) {}
+   std::vector<double> elevations;
+   std::vector<char> valid;         // (bools; std::vector<bool> has no data())
+   double deltaRng {30.0};
+   double refAlt {1500.0};
+};
+
+static const bool* validFlags(const Profile& p)
+{
+   return reinterpret_cast<const bool*>(p.valid.data());
+}
+
+// Random profile, with about one in eight points not valid
+static void randomProfile(Profile* const p, std::mt19937* const gen)
+{
+   std::uniform_real_distribution<double> elev(0.0, 3000.0);
+   std::uniform_int_distribution<int> flag(0, 7);
+   for (std::size_t i = 0; i < p->elevations.size(); i++) {
+      p->elevations[i] = elev(*gen);
+      p->valid[i] = (flag(*gen) != 0) ? 1 : 0;
+   }
+}
+
+// Highest tangent of the angle to the points [ 1 .. n-2 ], using the kernel's arithmetic
+static double maxTangent(const Profile& p, const bool useFlags)
+{
+   double maxTan{-std::numeric_limits<double>::infinity()};
+   double currentRange{};
+   for (std::size_t i = 1; i + 1 < p.elevations.size(); i++) {
+      currentRange += p.deltaRng;
+      if (useFlags && p.valid[i] == 0) continue;
+      const double tstTan{(p.elevations[i] - p.refAlt) / currentRange};
+      if (tstTan > maxTan) maxTan = tstTan;
+   }
+   return maxTan;
+}
+
+//------------------------------------------------------------------------------
+// check() -- compares the AVX and scalar kernels; returns the number of
+// differences
+//------------------------------------------------------------------------------
+static unsigned int check()
+{
+   std::mt19937 gen(4321);
+
+   std::vector<unsigned int> sizes;
+   for (unsigned int n = 0; n < 68; n++) sizes.push_back(n);
+   sizes.push_back(1000);
+   sizes.push_back(2000);
+   sizes.push_back(4096);
+
+   unsigned int diffs{};
+   for (const unsigned int n : sizes) {
+      Profile p(n);
+      randomProfile(&p, &gen);
+      for (int f = 0; f < 2; f++) {
+         const bool* const flags{(f != 0) ? validFlags(p) : nullptr};
+         const double maxTan{maxTangent(p, flags != nullptr)};
+         const double angles[]{
+            std::nextafter(maxTan, -1.0e9), maxTan, std::nextafter(maxTan, 1.0e9), -10.0, 10.0
+         };
+         for (const double tanAng : angles) {
+            const bool a{terrain::Terrain::anyPointAboveScalar(p.elevations.data(), flags, n, p.deltaRng, p.refAlt, tanAng)};
+            const bool b{terrain::Terrain::anyPointAboveAvx(p.elevations.data(), flags, n, p.deltaRng, p.refAlt, tanAng)};
+            if (a != b) {
+               std::cerr << n << " points" << (flags != nullptr ? " (valid flags)" : "") << ", tangent "
+                         << tanAng << ": scalar " << a << " vs AVX " << b << std::endl;
+               diffs++;
+            }
+         }
+      }
+   }
+   return diffs;
+}
+
+//------------------------------------------------------------------------------
+// benchmark() -- times the kernel
+//------------------------------------------------------------------------------
+static void benchmark()
+{
+   std::mt19937 gen(4321);
+   const unsigned int sizes[]{1000, 2000, 4096};
+   const char* const names[]{"scalar", "AVX", "dispatched"};
+
+   for (const unsigned int n : sizes) {
+      Profile p(n);
+      randomProfile(&p, &gen);
+      const double tanAng{1000.0};  // never above; every point is checked
+      const unsigned int reps{20000000 / n};
+      for (int k = 0; k < 3; k++) {
+         if (k == 1 && !terrain::Terrain::isAvxOccultAvailable()) continue;
+         for (int f = 0; f < 2; f++) {
+            const bool* const flags{(f != 0) ? validFlags(p) : nullptr};
+            unsigned int found{};
+            const double start{base::getComputerTime()};
+            for (unsigned int r = 0; r < reps; r++) {
+               bool above{};
+               if (k == 0) above = terrain::Terrain::anyPointAboveScalar(p.elevations.data(), flags, n, p.deltaRng, p.refAlt, tanAng);
+               else if (k == 1) above = terrain::Terrain::anyPointAboveAvx(p.elevations.data(), flags, n, p.deltaRng, p.refAlt, tanAng);
+               else above = terrain::Terrain::anyPointAbove(p.elevations.data(), flags, n, p.deltaRng, p.refAlt, tanAng);
+               if (above) found++;
+            }
+            const double secs{base::getComputerTime() - start};
+            const double rate{(static_cast<double>(reps) * n) / secs / 1.0e6};
+            std::cout << n << " points" << (flags != nullptr ? " (valid flags)" : "") << ", " << names[k]
+                      << ": " << rate << " M points/s" << (found != 0 ? " (?)" : "") << std::endl;
+         }
+      }
+   }
+}
+
+}
+}
+
+int main(int argc, char* argv[])
+{
+   if (argc > 1 && std::string(argv[1]) == "benchmark") {
+      mixr::test::benchmark();
+      return EXIT_SUCCESS;
+   }
+
+   if (!mixr::terrain::Terrain::isAvxOccultAvailable()) {
+      std::cout << "SKIPPED: the AVX kernel isn't available" << std::endl;
+      return mixr::test::SKIPPED;
+   }
+
+   const unsigned int diffs{mixr::test::check()};
+   std::cout << (diffs == 0 ? "PASSED" : "FAILED") << ": " << diffs << " differences" << std::endl;
+   return (diffs == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,170 @@
+//------------------------------------------------------------------------------
+// Uniform grid test
+//
+//    Checks UniformGrid's axes, including single point axes (lo == hi), which
+//    must have a zero step and keep the lookups finite, its linear and
+//    bilinear lookups, and a 1D gain pattern grid (GainPatternGrid), which
+//    uses a single point second axis.
+//
+//    Usage: uniform_grid
+//------------------------------------------------------------------------------
+
+#include "mixr/models/GainPatternGrid.hpp"
+#include "mixr/models/UniformGrid.hpp"
+
+#include "mixr/base/functors/Func1.hpp"
+#include "mixr/base/util/constants.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace mixr {
+namespace test {
+
+//------------------------------------------------------------------------------
+// Class: TestPattern
+// Description: 1D gain pattern: -6 dB per radian off boresight
+//------------------------------------------------------------------------------
+class TestPattern : public base::Func1
+{
+   DECLARE_SUBCLASS(TestPattern, base::Func1)
+
+public:
+   TestPattern();
+
+   double f(const double iv1, base::FStorage* const s = nullptr) const override   { return -6.0 * iv1; }
+};
+
+IMPLEMENT_SUBCLASS(TestPattern, "TestPattern")
+EMPTY_SLOTTABLE(TestPattern)
+EMPTY_COPYDATA(TestPattern)
+EMPTY_DELETEDATA(TestPattern)
+
+TestPattern::TestPattern()
+{
+   STANDARD_CONSTRUCTOR()
+}
+
+static unsigned int errors{};
+
+static void expect(const bool ok, const std::string& what)
+{
+   if (!ok) {
+      std::cerr << "FAILED: " << what << std::endl;
+      errors++;
+   }
+}
+
+static bool near(const double a, const double b)
+{
+   return std::fabs(a - b) <= 1.0e-12 * (1.0 + std::fabs(b));
+}
+
+//------------------------------------------------------------------------------
+// Axes
+//------------------------------------------------------------------------------
+static void testAxes()
+{
+   unsigned int i{};
+   double t{};
+
+   // Single point: the node twice, zero step, and every lookup on the node
+   models::UniformGrid::Axis a;
+   a.set(0.25, 0.25, 0.1);
+   expect(a.n == 2 && a.step == 0.0 && a.invStep == 0.0, "single point axis: two nodes, zero step");
+   expect(a.node(0) == 0.25 && a.node(1) == 0.25, "single point axis: nodes");
+   const double xs[]{-1.0, 0.25, 5.0};
+   for (const double x : xs) {
+      a.locate(x, &i, &t);
+      expect(i == 0 && t == 0.0, "single point axis: locate() clamps to the node");
+   }
+
+   // Uniform: no more than 'resolution' apart, ends on the nodes
+   models::UniformGrid::Axis b;
+   b.set(-1.0, 1.0, 0.3);
+   expect(b.n == 8 && b.step <= 0.3 && near(b.node(b.n - 1), 1.0), "uniform axis: nodes");
+   b.locate(-2.0, &i, &t);
+   expect(i == 0 && t == 0.0, "uniform axis: clamped below");
+   b.locate(2.0, &i, &t);
+   expect(i == b.n - 2 && near(t, 1.0), "uniform axis: clamped above");
+   b.locate(b.node(3) + 0.25 * b.step, &i, &t);
+   expect(i == 3 && near(t, 0.25), "uniform axis: cell and fraction");
+}
+
+//------------------------------------------------------------------------------
+// Grids
+//------------------------------------------------------------------------------
+static void testGrids()
+{
+   // Single point second axis (1D): value = first axis coordinate
+   models::UniformGrid g1;
+   g1.set(0.0, 1.0, 0.5, 0.5, 0.25);
+   expect(g1.getNumPoints() == 10 && g1.getNumBytes() == 10 * sizeof(double), "1D grid: size");
+   for (unsigned int j = 0; j < g1.getAxis2().n; j++) {
+      for (unsigned int i = 0; i < g1.getAxis1().n; i++) {
+         g1.value(i, j) = g1.getAxis1().node(i);
+      }
+   }
+   expect(near(g1.lookup(0.3), 0.3) && near(g1.lookup(0.3, 7.0), 0.3), "1D grid: lookups");
+   expect(std::isfinite(g1.lookup(0.6, 0.5)) && near(g1.lookup(2.0, -3.0), 1.0), "1D grid: clamped lookups");
+
+   // Single point grid
+   models::UniformGrid g0;
+   g0.set(2.0, 2.0, 3.0, 3.0, 0.1);
+   for (unsigned int j = 0; j < 2; j++) {
+      for (unsigned int i = 0; i < 2; i++) g0.value(i, j) = 5.0;
+   }
+   expect(g0.lookup(-1.0, 10.0) == 5.0 && g0.lookup(2.0, 3.0) == 5.0, "single point grid: lookups");
+
+   // 2D: value = x + 10 y is bilinear, so the lookups are exact
+   models::UniformGrid g2;
+   g2.set(-1.0, 1.0, 0.0, 2.0, 0.3);
+   for (unsigned int j = 0; j < g2.getAxis2().n; j++) {
+      for (unsigned int i = 0; i < g2.getAxis1().n; i++) {
+         g2.value(i, j) = g2.getAxis1().node(i) + 10.0 * g2.getAxis2().node(j);
+      }
+   }
+   expect(near(g2.lookup(0.123, 1.456), 0.123 + 14.56), "2D grid: bilinear lookup");
+
+   g2.clear();
+   expect(g2.isEmpty() && g2.getNumBytes() == 0, "cleared grid");
+}
+
+//------------------------------------------------------------------------------
+// 1D gain pattern grid (single point elevation axis)
+//------------------------------------------------------------------------------
+static void testGainPattern()
+{
+   const auto pattern = new TestPattern();
+   const auto grid = new models::GainPatternGrid();
+   expect(grid->build(pattern, false, 0.01), "1D gain pattern: build()");
+   expect(!grid->is2D() && grid->getNumPoints() > 0, "1D gain pattern: size");
+   expect(std::isfinite(grid->getMaxError()) && grid->getMaxError() < 0.01, "1D gain pattern: max error");
+
+   const double angles[]{0.0, 0.5, 1.0, base::PI};
+   for (const double x : angles) {
+      const double g{grid->getGain(x)};
+      const double exact{std::pow(10.0, pattern->f(x) / 10.0)};
+      expect(std::isfinite(g) && std::fabs(10.0 * std::log10(g / exact)) < 0.01, "1D gain pattern: lookups");
+   }
+   expect(near(grid->getGain(-1.0), 1.0), "1D gain pattern: clamped lookup");
+
+   grid->unref();
+   pattern->unref();
+}
+
+}
+}
+
+int main(int, char*[])
+{
+   mixr::test::testAxes();
+   mixr::test::testGrids();
+   mixr::test::testGainPattern();
+
+   const unsigned int errors{mixr::test::errors};
+   std::cout << (errors == 0 ? "PASSED" : "FAILED") << ": " << errors << " errors" << std::endl;
+   return (errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,85 @@
+//------------------------------------------------------------------------------
+// Tile file converter
+//
+//    Converts a terrain data file (DTED, SRTM or DED) to a tile file, which
+//    MappedFile and TileManager's "mtf" format read (see MappedFile).  The
+//    input's format is found from its file name extension:
+//
+//       .dt0, .dt1, .dt2     DTED (DtedFile)
+//       .hgt                 SRTM (SrtmHgtFile)
+//       .ded                 DED (DedFile)
+//
+//    Usage: mixr_mtfconvert <input file> <output file>
+//
+//    For use with TileManager, name the output using the tile's southwest
+//    corner, e.g., n36w118.mtf
+//------------------------------------------------------------------------------
+
+#include "mixr/terrain/ded/DedFile.hpp"
+#include "mixr/terrain/dted/DtedFile.hpp"
+#include "mixr/terrain/mapped/MappedFile.hpp"
+#include "mixr/terrain/srtm/SrtmHgtFile.hpp"
+
+#include "mixr/base/String.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace mixr {
+namespace tools {
+
+//------------------------------------------------------------------------------
+// createDataFile() -- creates the data file for the input file's extension
+//------------------------------------------------------------------------------
+static terrain::DataFile* createDataFile(const std::string& filename)
+{
+   const std::string::size_type dot{filename.rfind('.')};
+   if (dot == std::string::npos) return nullptr;
+   const std::string ext{filename.substr(dot + 1)};
+
+   terrain::DataFile* file{};
+   if (ext == "dt0" || ext == "dt1" || ext == "dt2") file = new terrain::DtedFile();
+   else if (ext == "hgt") file = new terrain::SrtmHgtFile();
+   else if (ext == "ded") file = new terrain::DedFile();
+   return file;
+}
+
+}
+}
+
+int main(int argc, char* argv[])
+{
+   if (argc != 3) {
+      std::cerr << "usage: mixr_mtfconvert <input file> <output file>" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   mixr::terrain::DataFile* const source{mixr::tools::createDataFile(argv[1])};
+   if (source == nullptr) {
+      std::cerr << "mixr_mtfconvert: unknown input format: " << argv[1] << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   const auto name = new mixr::base::String(argv[1]);
+   source->setFilename(name);
+   name->unref();
+
+   // Terrain::reset() loads the data
+   source->reset();
+   bool ok{source->isDataLoaded()};
+   if (!ok) {
+      std::cerr << "mixr_mtfconvert: unable to load: " << argv[1] << std::endl;
+   }
+   else {
+      ok = mixr::terrain::MappedFile::write(source, argv[2]);
+   }
+   if (ok) {
+      std::cout << argv[2] << ": " << source->getNumLonPoints() << " x " << source->getNumLatPoints()
+                << " posts, [ " << source->getLatitudeSW() << " " << source->getLongitudeSW() << " ] to [ "
+                << source->getLatitudeNE() << " " << source->getLongitudeNE() << " ]" << std::endl;
+   }
+
+   source->unref();
+   return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}